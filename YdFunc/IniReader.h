@@ -15,25 +15,25 @@ class IniReader {
 public:
     IniReader() = default;
 
-    // ز INI ļ
+    // 加载并解析 INI 文件
     bool load(const std::string& filename) {
         std::ifstream file(filename);
         if (!file.is_open()) return false;
 
         std::string line, currentSection = "default";
         while (std::getline(file, line)) {
-            // 1. ȥβո
+            // 1. 去除首尾空格
             trim(line);
 
-            // 2. кע
+            // 2. 跳过空行和注释
             if (line.empty() || line[0] == ';' || line[0] == '#') continue;
 
-            // 3.  Section [section_name]
+            // 3. 处理 Section [section_name]
             if (line[0] == '[' && line.back() == ']') {
                 currentSection = line.substr(1, line.length() - 2);
                 trim(currentSection);
             }
-            // 4.  Key=Value
+            // 4. 处理 Key=Value
             else {
                 size_t delimiterPos = line.find('=');
                 if (delimiterPos != std::string::npos) {
@@ -49,25 +49,25 @@ public:
         return true;
     }
 
-    // ĸĽ optional
+    // 核心改进：返回 optional
     std::optional<std::string> getString(const std::string& section, const std::string& key) const {
         auto secIt = settings.find(section);
         if (secIt != settings.end()) {
             auto keyIt = secIt->second.find(key);
             if (keyIt != secIt->second.end()) {
-                return keyIt->second; // ɹȡֵ
+                return keyIt->second; // 成功取值
             }
         }
-        return std::nullopt; // ֵԲ
+        return std::nullopt; // 键值对不存在
     }
 
 
 
 private:
-    // 洢ṹMap<Section, Map<Key, Value>>
+    // 存储结构：Map<Section, Map<Key, Value>>
     std::map<std::string, std::map<std::string, std::string>> settings;
 
-    // ȥַβո
+    // 辅助函数：去除字符串首尾空格
     void trim(std::string& s) const {
         if (s.empty()) return;
         s.erase(0, s.find_first_not_of(" \t\r\n"));
@@ -1,9 +1,16 @@
 #include "LMDBClient.h"
+#include "block_bitmap.h"
 #include <filesystem>
 #include <cstring>
 #include <stdexcept>
 #include <iostream>
 #include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <charconv>
+#include <map>
+#include <string_view>
+#include <thread>
 
 #ifdef _WIN32
 #include <io.h>
@@ -15,7 +22,7 @@ void CreateDirIfNotExists(const std::string& path) {
     std::filesystem::create_directories(path);
 }
 
-// ===  ( SSO ŻСַѷ) ===
+// === 辅助函数 (保持 SSO 优化，小字符串无需堆分配) ===
 std::string LMDBClient::DoubleToBytes(double value) {
     std::string buf(sizeof(double), '\0');
     std::memcpy(buf.data(), &value, sizeof(double));
@@ -23,7 +30,7 @@ std::string LMDBClient::DoubleToBytes(double value) {
 }
 
 double LMDBClient::BytesToDouble(const std::string& bytes) {
-    if (bytes.size() != sizeof(double)) return 0.0; // 򻯴ٶȣ throw
+    if (bytes.size() != sizeof(double)) return 0.0; // 简化错误处理以提高速度，或保留 throw
     double val;
     std::memcpy(&val, bytes.data(), sizeof(double));
     return val;
@@ -42,22 +49,332 @@ int LMDBClient::BytesToInt(const std::string& bytes) {
     return val;
 }
 
-// === ʼ ===
+// === 环境生命周期 ===
+
+namespace {
+
+// 进程内所有线程共用的登记表，每个槽位独占一条缓存行，读者之间不共享任何可写的缓存行
+constexpr size_t kGuardSlots = 256;
+
+struct alignas(64) GuardSlot {
+    std::atomic<uint32_t> depth{ 0 };     // 只由占用该槽位的线程修改
+    std::atomic<bool> claimed{ false };
+};
+
+GuardSlot g_guard_slots[kGuardSlots];
+std::atomic<uint32_t> g_overflow_depth{ 0 }; // 槽位用完后的线程共用这个计数
+
+struct GuardSlotOwner {
+    GuardSlot* slot = nullptr;
+    bool tried = false;
+    ~GuardSlotOwner() {
+        if (slot) slot->claimed.store(false, std::memory_order_release);
+    }
+};
+
+GuardSlot* LocalGuardSlot() {
+    thread_local GuardSlotOwner owner;
+    if (!owner.slot && !owner.tried) {
+        owner.tried = true;
+        for (GuardSlot& slot : g_guard_slots) {
+            bool expected = false;
+            if (slot.claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                owner.slot = &slot;
+                break;
+            }
+        }
+    }
+    return owner.slot;
+}
+
+// 写操作返回 MDB_MAP_FULL 时记下来：事务函数只返回 bool，ExecuteWriteTransaction 据此决定扩容重试
+thread_local bool t_map_full = false;
+
+int TrackRc(int rc) {
+    if (rc == MDB_MAP_FULL) t_map_full = true;
+    return rc;
+}
+
+int TxnPut(MDB_txn* txn, MDB_dbi dbi, MDB_val* key, MDB_val* data, unsigned int flags) {
+    return TrackRc(mdb_put(txn, dbi, key, data, flags));
+}
+
+int TxnDel(MDB_txn* txn, MDB_dbi dbi, MDB_val* key, MDB_val* data) {
+    return TrackRc(mdb_del(txn, dbi, key, data));
+}
+
+int CursorDel(MDB_cursor* cursor, unsigned int flags) {
+    return TrackRc(mdb_cursor_del(cursor, flags));
+}
+
+int TxnDrop(MDB_txn* txn, MDB_dbi dbi, int del) {
+    return TrackRc(mdb_drop(txn, dbi, del));
+}
+
+// 等待所有线程退出 EnvGuard；进程退出时其他线程可能已被强行终止，计数永远不会归零，因此设上限
+bool WaitForGuards(std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    auto busy = []() {
+        if (g_overflow_depth.load(std::memory_order_seq_cst) != 0) return true;
+        for (const GuardSlot& slot : g_guard_slots) {
+            if (slot.depth.load(std::memory_order_seq_cst) != 0) return true;
+        }
+        return false;
+    };
+    while (busy()) {
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+} // namespace
+
+// 读写操作进入环境前在本线程的槽位上登记；与 Close / ResizeMap 构成 Dekker 式握手：
+// 读者先登记再检查 initialized_ / paused_，对方先改标志再检查登记，两边都用 seq_cst，
+// 因此要么读者看到标志（已关闭直接返回，调整映射中则退出等待），要么对方看到读者并等它退出
+class LMDBClient::EnvGuard {
+public:
+    explicit EnvGuard(const LMDBClient* client) : slot_(LocalGuardSlot()) {
+        while (true) {
+            bool nested = Enter();
+            // 已在守卫内的嵌套调用直接放行：调整映射的一方本来就在等外层退出
+            if (nested || !client->paused_.load(std::memory_order_seq_cst)) break;
+            Leave();
+            while (client->paused_.load(std::memory_order_acquire)) std::this_thread::yield();
+        }
+        ok_ = client->initialized_.load(std::memory_order_seq_cst);
+    }
+
+    ~EnvGuard() { Leave(); }
+
+    EnvGuard(const EnvGuard&) = delete;
+    EnvGuard& operator=(const EnvGuard&) = delete;
+
+    bool ok() const { return ok_; }
+
+private:
+    // 返回进入前是否已在守卫内
+    bool Enter() {
+        if (slot_) return slot_->depth.fetch_add(1, std::memory_order_seq_cst) > 0;
+        g_overflow_depth.fetch_add(1, std::memory_order_seq_cst);
+        return false;
+    }
+
+    void Leave() {
+        if (slot_) slot_->depth.fetch_sub(1, std::memory_order_release);
+        else g_overflow_depth.fetch_sub(1, std::memory_order_release);
+    }
+
+    GuardSlot* slot_;
+    bool ok_ = false;
+};
+
+// === 命名空间 ===
+
+namespace {
+
+struct NamespaceSpec {
+    std::string_view prefix;
+    const char* name;
+    bool integer_key;
+    size_t digits;  // 整数 key 的固定位数（股票代码保留前导零）；0 表示不带前导零的十进制
+};
+
+// 顺序与 ns_dbi_ 下标一致；名字带 "ns." 前缀，不会和主库里的业务 key 冲突
+constexpr NamespaceSpec kNamespaces[] = {
+    { "BLK_",      "ns.block",      true,  6 },
+    { "blk_size:", "ns.block_size", true,  0 },
+    { "key:",      "ns.user_key",   false, 0 },
+    { "dedup:",    "ns.dedup",      false, 0 },
+    { "blkmap:",   "ns.blkmap",     true,  0 },
+};
+static_assert(std::size(kNamespaces) == LMDBClient::kNamespaceCount);
+
+// 留出余量给以后新增的命名空间
+constexpr MDB_dbi kMaxDbs = 16;
+
+// 只接受能原样还原的写法，保证 key -> 整数 -> key 一一对应
+bool ParseIntegerKey(std::string_view text, size_t digits, unsigned int* value) {
+    if (text.empty() || text.size() > 9) return false;
+    if (digits > 0 ? text.size() != digits : (text.size() > 1 && text[0] == '0')) return false;
+    unsigned int result = 0;
+    for (char c : text) {
+        if (c < '0' || c > '9') return false;
+        result = result * 10 + static_cast<unsigned int>(c - '0');
+    }
+    *value = result;
+    return true;
+}
+
+// 还原完整 key，写入 out（复用其容量）
+void FormatKeyInto(const NamespaceSpec& ns, const MDB_val& key, std::string* out) {
+    out->assign(ns.prefix);
+    if (!ns.integer_key) {
+        out->append(static_cast<const char*>(key.mv_data), key.mv_size);
+        return;
+    }
+    unsigned int value = 0;
+    if (key.mv_size == sizeof(value)) std::memcpy(&value, key.mv_data, sizeof(value));
+    char digits[16];
+    auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+    size_t length = static_cast<size_t>(end - digits);
+    if (length < ns.digits) out->append(ns.digits - length, '0');
+    out->append(digits, length);
+}
+
+std::string FormatKey(const NamespaceSpec& ns, const MDB_val& key) {
+    std::string full;
+    FormatKeyInto(ns, key, &full);
+    return full;
+}
+
+bool IsNamespaceName(const MDB_val& key) {
+    std::string_view k(static_cast<const char*>(key.mv_data), key.mv_size);
+    for (const NamespaceSpec& ns : kNamespaces) {
+        if (k == ns.name) return true;
+    }
+    return false;
+}
+
+bool StartsWith(std::string_view text, std::string_view prefix) {
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+enum class Visit { Skip, Take, Stop };
+
+// 从 seek（为空时从头）开始遍历 dbi；decide 决定每个 key 的去留，Take 的 key / value 交给 take，erase 为 true 时随后删除
+template<typename Decide, typename Take>
+bool WalkKeys(MDB_txn* txn, MDB_dbi dbi, std::string_view seek, bool erase, Decide&& decide, Take&& take) {
+    MDB_cursor* cursor;
+    if (mdb_cursor_open(txn, dbi, &cursor) != MDB_SUCCESS) return false;
+
+    MDB_val key{ seek.size(), const_cast<char*>(seek.data()) };
+    MDB_val data;
+    int rc = mdb_cursor_get(cursor, &key, &data, seek.empty() ? MDB_FIRST : MDB_SET_RANGE);
+    while (rc == MDB_SUCCESS) {
+        Visit visit = decide(key);
+        if (visit == Visit::Stop) break;
+        if (visit == Visit::Take) {
+            take(key, data);
+            if (erase) {
+                // mdb_cursor_del 之后游标已指向下一项
+                if (CursorDel(cursor, 0) != MDB_SUCCESS) {
+                    mdb_cursor_close(cursor);
+                    return false;
+                }
+                rc = mdb_cursor_get(cursor, &key, &data, MDB_GET_CURRENT);
+                continue;
+            }
+        }
+        rc = mdb_cursor_get(cursor, &key, &data, MDB_NEXT);
+    }
+    mdb_cursor_close(cursor);
+    return true;
+}
+
+} // namespace
+
+// 完整 key -> (DBI, 库内 key)；整数 key 的存储就在对象里，因此不可拷贝
+class LMDBClient::KeyRef {
+public:
+    KeyRef(const LMDBClient& client, std::string_view key)
+        : dbi(client.dbi_), val{ key.size(), const_cast<char*>(key.data()) } {
+        for (size_t i = 0; i < kNamespaceCount; ++i) {
+            const NamespaceSpec& ns = kNamespaces[i];
+            if (!client.ns_open_[i] || !StartsWith(key, ns.prefix)) continue;
+
+            std::string_view rest = key.substr(ns.prefix.size());
+            if (ns.integer_key) {
+                if (!ParseIntegerKey(rest, ns.digits, &integer_)) break;
+                val = MDB_val{ sizeof(integer_), &integer_ };
+            }
+            else {
+                val = MDB_val{ rest.size(), const_cast<char*>(rest.data()) };
+            }
+            dbi = client.ns_dbi_[i];
+            break;
+        }
+    }
+
+    KeyRef(const KeyRef&) = delete;
+    KeyRef& operator=(const KeyRef&) = delete;
+
+    MDB_dbi dbi;
+    MDB_val val;
+
+private:
+    unsigned int integer_ = 0;
+};
+
+bool LMDBClient::OpenNamespaces(MDB_txn* txn, bool read_only) {
+    for (size_t i = 0; i < kNamespaceCount; ++i) {
+        const NamespaceSpec& ns = kNamespaces[i];
+        unsigned int flags = ns.integer_key ? MDB_INTEGERKEY : 0;
+        if (!read_only) flags |= MDB_CREATE;
+
+        int rc = mdb_dbi_open(txn, ns.name, flags, &ns_dbi_[i]);
+        ns_open_[i] = (rc == MDB_SUCCESS);
+        if (rc == MDB_NOTFOUND && read_only) continue; // 写入方还没升级，数据都在主库
+        if (rc != MDB_SUCCESS) return false;
+    }
+    if (read_only) return true;
+
+    // 迁移主库里的旧 key；已迁移过时每个命名空间只有一次 SET_RANGE
+    for (size_t i = 0; i < kNamespaceCount; ++i) {
+        const NamespaceSpec& ns = kNamespaces[i];
+        std::vector<std::pair<std::string, std::string>> moved;
+        bool ok = WalkKeys(txn, dbi_, ns.prefix, true,
+            [&](const MDB_val& key) {
+                std::string_view k(static_cast<const char*>(key.mv_data), key.mv_size);
+                if (!StartsWith(k, ns.prefix)) return Visit::Stop;
+                unsigned int unused = 0;
+                if (ns.integer_key && !ParseIntegerKey(k.substr(ns.prefix.size()), ns.digits, &unused)) return Visit::Skip;
+                return Visit::Take;
+            },
+            [&](const MDB_val& key, const MDB_val& data) {
+                moved.emplace_back(std::string(static_cast<const char*>(key.mv_data), key.mv_size),
+                    std::string(static_cast<const char*>(data.mv_data), data.mv_size));
+            });
+        if (!ok) return false;
+
+        for (const auto& [k, v] : moved) {
+            KeyRef ref(*this, k);
+            MDB_val mval{ v.size(), const_cast<char*>(v.data()) };
+            // 命名 DBI 里已有的值更新，不覆盖
+            int rc = TxnPut(txn, ref.dbi, &ref.val, &mval, MDB_NOOVERWRITE);
+            if (rc != MDB_SUCCESS && rc != MDB_KEYEXIST) return false;
+        }
+    }
+    return true;
+}
+
+// === 初始化 ===
 bool LMDBClient::Initialize(const std::string& db_path, size_t map_size_mb, bool read_only) {
-    std::unique_lock<std::shared_mutex> lock(mutex_); // дʼ
-    if (initialized_) return true;
+    // 导出函数每次调用都会走到这里，已初始化时不碰任何锁
+    if (initialized_.load(std::memory_order_acquire)) return true;
+
+    std::lock_guard<std::mutex> lock(lifecycle_mutex_);
+    if (initialized_.load(std::memory_order_relaxed)) return true;
+    if (env_) {
+        // 上次 Close 等不到读者退出，环境没有关闭，直接继续使用
+        initialized_.store(true, std::memory_order_release);
+        return true;
+    }
 
     read_only_ = read_only;
+    if (!snapshots_) snapshots_ = std::make_shared<SnapshotList>();
     CreateDirIfNotExists(db_path);
 
     int rc = mdb_env_create(&env_);
     if (rc != MDB_SUCCESS) return false;
 
     mdb_env_set_maxreaders(env_, 126);
+    mdb_env_set_maxdbs(env_, kMaxDbs);
     mdb_env_set_mapsize(env_, map_size_mb * 1024 * 1024);
 
-    // ŻMDB_NOSYNC | MDB_NOMETASYNC
-    // дܣϵͳ汣֤һԣǿˢ
+    // 核心优化：MDB_NOSYNC | MDB_NOMETASYNC
+    // 极大提高写入性能，依赖操作系统缓存保证一致性，不强制刷盘
     unsigned int flags = MDB_NOTLS | MDB_NOSYNC | MDB_NOMETASYNC;
     if (read_only) {
         flags |= MDB_RDONLY;
@@ -71,7 +388,7 @@ bool LMDBClient::Initialize(const std::string& db_path, size_t map_size_mb, bool
         return false;
     }
 
-    //  DBI
+    // 打开 DBI
     MDB_txn* txn = nullptr;
     rc = mdb_txn_begin(env_, nullptr, read_only ? MDB_RDONLY : 0, &txn);
     if (rc != MDB_SUCCESS) {
@@ -81,111 +398,321 @@ bool LMDBClient::Initialize(const std::string& db_path, size_t map_size_mb, bool
     }
 
     rc = mdb_dbi_open(txn, nullptr, 0, &dbi_);
-    if (rc != MDB_SUCCESS) {
+    if (rc != MDB_SUCCESS || !OpenNamespaces(txn, read_only)) {
         mdb_txn_abort(txn);
         mdb_env_close(env_);
         env_ = nullptr;
         return false;
     }
 
-    mdb_txn_commit(txn);
-    initialized_ = true;
+    if (mdb_txn_commit(txn) != MDB_SUCCESS) {
+        mdb_env_close(env_);
+        env_ = nullptr;
+        return false;
+    }
+    initialized_.store(true, std::memory_order_release);
     return true;
 }
 
 void LMDBClient::Close() {
-    std::unique_lock<std::shared_mutex> lock(mutex_);
-    if (env_) {
-        mdb_env_close(env_); // env_close Զر dbi
-        env_ = nullptr;
-        dbi_ = 0;
-        initialized_ = false;
+    std::lock_guard<std::mutex> lock(lifecycle_mutex_);
+    if (!env_) return;
+
+    // 先拒绝新的读写，再等已经进入的退出
+    initialized_.store(false, std::memory_order_seq_cst);
+    if (!WaitForGuards(std::chrono::milliseconds(1000))) {
+        // 仍有线程在环境里（多半是进程退出时被终止的线程），不能关闭，环境随进程回收
+        return;
     }
+
+    // 所有事务必须在 env_close 之前结束
+    AbortReadSnapshots();
+    mdb_env_close(env_); // env_close 会自动关闭 dbi
+    env_ = nullptr;
+    dbi_ = 0;
+    std::fill(std::begin(ns_open_), std::end(ns_open_), false);
 }
 
 LMDBClient::~LMDBClient() {
     Close();
 }
 
-// === ģ (ֶд) ===
+// === 读快照 ===
 
-// ʹ shared_lock
-template<typename Func>
-bool LMDBClient::ExecuteReadTransaction(Func&& func) {
-    std::shared_lock<std::shared_mutex> lock(this->mutex_);
-    if (!this->initialized_) return false;
+// 一个环境的读快照事务登记表；线程本地的快照持有它的 shared_ptr，实例先于线程销毁时线程退出仍能安全归还
+struct LMDBClient::SnapshotList {
+    std::mutex mutex;
+    std::vector<MDB_txn*> txns;
+    std::atomic<bool> closed{ false };  // 表中事务已全部终止，不再登记
+};
 
+// 线程本地的读快照；环境以 MDB_NOTLS 打开，同一线程持有读事务时仍可开写事务
+struct LMDBClient::ReadSnapshot {
+    std::shared_ptr<SnapshotList> list;  // 所属环境的登记表
     MDB_txn* txn = nullptr;
-    // MDB_RDONLY Ҫдȴ
-    int rc = mdb_txn_begin(this->env_, nullptr, MDB_RDONLY, &txn);
-    if (rc != MDB_SUCCESS) return false;
+    bool active = false;  // 已 begin / renew、持有快照；reset 之后为 false
+    int pins = 0;         // 进行中的读和 ReadScope 的嵌套计数，归零时 reset
 
-    bool success = false;
-    try {
-        success = func(txn);
-        // ֻͨʹ abort ͷԴ commit 죬
-        //  MDB_RDONLY  commit/abort С
-        mdb_txn_abort(txn);
-        return success;
+    ~ReadSnapshot() {
+        if (txn) ReleaseReadSnapshot(*list, txn);
     }
-    catch (...) {
-        mdb_txn_abort(txn);
-        return false;
+};
+
+LMDBClient::ReadSnapshot& LMDBClient::LocalReadSnapshot() {
+    thread_local ReadSnapshot slot;
+    return slot;
+}
+
+MDB_txn* LMDBClient::AcquireReadSnapshot() {
+    ReadSnapshot& slot = LocalReadSnapshot();
+
+    if (slot.txn && slot.list != snapshots_) {
+        if (!slot.list->closed.load(std::memory_order_acquire)) {
+            if (slot.active) return nullptr;    // 另一个实例正钉着本线程的快照
+            ReleaseReadSnapshot(*slot.list, slot.txn); // 另一个实例的空闲快照，归还后给本实例用
+        }
+        slot.txn = nullptr;                     // 环境已关闭或扩容过，旧事务已在那时终止
+        slot.list.reset();
+    }
+
+    if (!slot.txn) {
+        MDB_txn* txn = nullptr;
+        if (mdb_txn_begin(env_, nullptr, MDB_RDONLY, &txn) != MDB_SUCCESS) return nullptr;
+        {
+            std::lock_guard<std::mutex> lock(snapshots_->mutex);
+            snapshots_->txns.push_back(txn);
+        }
+        slot.list = snapshots_;
+        slot.txn = txn;
+        slot.active = true;
+        slot.pins = 1;
+        return txn;
     }
+
+    // 上次读完已 reset：renew 复用 reader slot 取最新快照，不分配内存
+    // 仍处于 active 说明外层的读或 ReadScope 还钉着它，继续用原快照，外层借出的 view 还指向它
+    if (!slot.active) {
+        if (mdb_txn_renew(slot.txn) != MDB_SUCCESS) {
+            ReleaseReadSnapshot(*slot.list, slot.txn);
+            slot.txn = nullptr;
+            slot.list.reset();
+            return nullptr;
+        }
+        slot.active = true;
+        slot.pins = 0;
+    }
+    ++slot.pins;
+    return slot.txn;
+}
+
+void LMDBClient::UnpinReadSnapshot() {
+    ReadSnapshot& slot = LocalReadSnapshot();
+    // 登记表不是当前的：属于另一个实例，或已在 Close / 扩容时终止
+    if (!slot.txn || slot.list != snapshots_ || !slot.active) return;
+    if (slot.pins > 0 && --slot.pins > 0) return;
+    mdb_txn_reset(slot.txn);
+    slot.active = false;
+}
+
+void LMDBClient::ReleaseReadSnapshot(SnapshotList& list, MDB_txn* txn) {
+    std::lock_guard<std::mutex> lock(list.mutex);
+    auto it = std::find(list.txns.begin(), list.txns.end(), txn);
+    if (it == list.txns.end()) return; // 已被 Close 终止
+    mdb_txn_abort(txn);
+    list.txns.erase(it);
+}
+
+void LMDBClient::AbortReadSnapshots() {
+    if (!snapshots_) return;
+    {
+        std::lock_guard<std::mutex> lock(snapshots_->mutex);
+        for (MDB_txn* txn : snapshots_->txns) mdb_txn_abort(txn);
+        snapshots_->txns.clear();
+        snapshots_->closed.store(true, std::memory_order_release);
+    }
+    snapshots_ = std::make_shared<SnapshotList>();
+}
+
+// === 映射大小 ===
+
+void LMDBClient::SetMapSizeLimit(size_t max_map_size_mb) {
+    max_map_size_.store(max_map_size_mb * 1024 * 1024, std::memory_order_relaxed);
 }
 
-// дʹ unique_lockϸлд
+// 调整映射时本进程不能有任何活动事务：挡住新的 EnvGuard，等已进入的退出，再终止各线程的读快照
+bool LMDBClient::ResizeMap(size_t seen_size, bool adopt) {
+    std::lock_guard<std::mutex> lock(lifecycle_mutex_);
+    if (!env_ || !initialized_.load(std::memory_order_acquire)) return false;
+
+    MDB_envinfo info;
+    if (mdb_env_info(env_, &info) != MDB_SUCCESS) return false;
+
+    size_t target = 0; // 0 表示采用其他进程扩大后的大小
+    if (!adopt) {
+        if (info.me_mapsize > seen_size) return true; // 其他线程已经扩过，直接重试
+        size_t limit = max_map_size_.load(std::memory_order_relaxed);
+        target = std::max(info.me_mapsize * 2, info.me_mapsize + kMinMapGrowth);
+        if (limit > 0) target = std::min(target, limit);
+        if (target <= info.me_mapsize) return false;  // 已到上限
+    }
+
+    paused_.store(true, std::memory_order_seq_cst);
+    int rc = MDB_BAD_TXN;
+    if (WaitForGuards(std::chrono::milliseconds(5000))) {
+        AbortReadSnapshots();
+        rc = mdb_env_set_mapsize(env_, target);
+    }
+    paused_.store(false, std::memory_order_seq_cst);
+
+    if (rc == MDB_SUCCESS && !adopt) map_grows_.fetch_add(1, std::memory_order_relaxed);
+    return rc == MDB_SUCCESS;
+}
+
+bool LMDBClient::GetMapUsage(MapUsage* usage) {
+    EnvGuard guard(this);
+    if (!guard.ok() || !usage) return false;
+
+    MDB_envinfo info;
+    MDB_stat stat;
+    if (mdb_env_info(env_, &info) != MDB_SUCCESS || mdb_env_stat(env_, &stat) != MDB_SUCCESS) return false;
+    usage->map_size = info.me_mapsize;
+    usage->used = (info.me_last_pgno + 1) * static_cast<size_t>(stat.ms_psize);
+    usage->max_map_size = max_map_size_.load(std::memory_order_relaxed);
+    usage->grows = map_grows_.load(std::memory_order_relaxed);
+    return true;
+}
+
+uint64_t LMDBClient::LastTxnId() {
+    EnvGuard guard(this);
+    if (!guard.ok()) return 0;
+    MDB_envinfo info;
+    return mdb_env_info(env_, &info) == MDB_SUCCESS ? info.me_last_txnid : 0;
+}
+
+// === 事务模板 (拆分读写) ===
+
+// 读事务：不加锁，只在本线程槽位上登记
+template<typename Func>
+bool LMDBClient::ExecuteReadTransaction(Func&& func) {
+    for (int attempt = 0; ; ++attempt) {
+        {
+            EnvGuard guard(this);
+            if (!guard.ok()) return false;
+
+            if (read_snapshot_.load(std::memory_order_relaxed)) {
+                if (MDB_txn* snapshot = AcquireReadSnapshot()) {
+                    // 读完解除钉住（reset），事务句柄留给本线程下次 renew
+                    bool success = false;
+                    try {
+                        success = func(snapshot);
+                    }
+                    catch (...) {
+                        success = false;
+                    }
+                    UnpinReadSnapshot();
+                    return success;
+                }
+            }
+
+            MDB_txn* txn = nullptr;
+            // MDB_RDONLY 对性能至关重要，不阻塞写锁等待
+            int rc = mdb_txn_begin(this->env_, nullptr, MDB_RDONLY, &txn);
+            if (rc == MDB_SUCCESS) {
+                bool success = false;
+                try {
+                    success = func(txn);
+                }
+                catch (...) {
+                    success = false;
+                }
+                // 只读事务通常使用 abort 释放资源比 commit 更快，
+                // 但 MDB_RDONLY 下 commit/abort 开销极小
+                mdb_txn_abort(txn);
+                return success;
+            }
+            if (rc != MDB_MAP_RESIZED || attempt > 0) return false;
+        }
+        // 其他进程扩大了映射：退出守卫后采用新大小再试一次
+        if (!ResizeMap(0, true)) return false;
+    }
+}
+
+// 写事务：由 mdb_txn_begin 内部的写锁串行，读者不会被阻塞
+// 映射写满（MDB_MAP_FULL）时扩容后整个事务重做，func 必须可以重复执行
 template<typename Func>
 bool LMDBClient::ExecuteWriteTransaction(Func&& func) {
     if (read_only_) return false;
-    std::unique_lock<std::shared_mutex> lock(this->mutex_);
-    if (!this->initialized_) return false;
 
-    MDB_txn* txn = nullptr;
-    int rc = mdb_txn_begin(this->env_, nullptr, 0, &txn);
-    if (rc != MDB_SUCCESS) return false;
+    for (int attempt = 0; ; ++attempt) {
+        int rc = MDB_SUCCESS;
+        size_t map_size = 0;
+        {
+            EnvGuard guard(this);
+            if (!guard.ok()) return false;
+
+            t_map_full = false;
+            MDB_txn* txn = nullptr;
+            rc = mdb_txn_begin(this->env_, nullptr, 0, &txn);
+            if (rc == MDB_SUCCESS) {
+                bool success = false;
+                try {
+                    success = func(txn);
+                }
+                catch (...) {
+                    success = false;
+                }
+                if (success) {
+                    rc = mdb_txn_commit(txn);
+                }
+                else {
+                    mdb_txn_abort(txn);
+                    rc = MDB_BAD_TXN;
+                }
+                if (rc == MDB_SUCCESS) return true;
+                if (t_map_full) rc = MDB_MAP_FULL;
+            }
 
-    bool success = false;
-    try {
-        success = func(txn);
-        if (success) {
-            rc = mdb_txn_commit(txn);
-            return (rc == MDB_SUCCESS);
+            MDB_envinfo info;
+            if (mdb_env_info(this->env_, &info) == MDB_SUCCESS) map_size = info.me_mapsize;
+        }
+
+        // 守卫已退出，才能调整映射
+        if (attempt >= kMaxResizeAttempts) return false;
+        if (rc == MDB_MAP_RESIZED) {
+            if (!ResizeMap(0, true)) return false;
+        }
+        else if (rc == MDB_MAP_FULL) {
+            if (!ResizeMap(map_size, false)) return false;
         }
         else {
-            mdb_txn_abort(txn);
             return false;
         }
     }
-    catch (...) {
-        mdb_txn_abort(txn);
-        return false;
-    }
 }
 
-// === ʵ ===
+// === 基础操作实现 ===
 
 bool LMDBClient::Put(const std::string& key, const std::string& value) {
     return ExecuteWriteTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        KeyRef ref(*this, key);
         MDB_val mval{ value.size(), const_cast<char*>(value.data()) };
-        return mdb_put(txn, dbi_, &mkey, &mval, 0) == MDB_SUCCESS;
+        return TxnPut(txn, ref.dbi, &ref.val, &mval, 0) == MDB_SUCCESS;
         });
 }
 
 bool LMDBClient::PutDouble(const std::string& key, double value) {
-    // ʱ string ջϣС
+    // 构造临时 string 在栈上，开销极小
     return Put(key, DoubleToBytes(value));
 }
 
 bool LMDBClient::Get(const std::string& key, std::string* value) {
     return ExecuteReadTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        KeyRef ref(*this, key);
         MDB_val mval;
-        int rc = mdb_get(txn, dbi_, &mkey, &mval);
+        int rc = mdb_get(txn, ref.dbi, &ref.val, &mval);
         if (rc == MDB_SUCCESS) {
             if (value) {
-                // ֱ assignι
+                // 直接 assign，避免多次构造
                 value->assign(static_cast<char*>(mval.mv_data), mval.mv_size);
             }
             return true;
@@ -196,9 +723,9 @@ bool LMDBClient::Get(const std::string& key, std::string* value) {
 
 bool LMDBClient::GetDouble(const std::string& key, double* value) {
     return ExecuteReadTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        KeyRef ref(*this, key);
         MDB_val mval;
-        int rc = mdb_get(txn, dbi_, &mkey, &mval);
+        int rc = mdb_get(txn, ref.dbi, &ref.val, &mval);
         if (rc == MDB_SUCCESS && mval.mv_size == sizeof(double)) {
             if (value) std::memcpy(value, mval.mv_data, sizeof(double));
             return true;
@@ -209,11 +736,11 @@ bool LMDBClient::GetDouble(const std::string& key, double* value) {
 
 bool LMDBClient::GetInt(const std::string& key, int* value) {
     return ExecuteReadTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        KeyRef ref(*this, key);
         MDB_val mval;
-        int rc = mdb_get(txn, dbi_, &mkey, &mval);
+        int rc = mdb_get(txn, ref.dbi, &ref.val, &mval);
 
-        // У飺ȡɹݳȱϸ int ĳ (4ֽ)
+        // 校验：必须读取成功，且数据长度必须严格等于 int 的长度 (4字节)
         if (rc == MDB_SUCCESS && mval.mv_size == sizeof(int)) {
             if (value) std::memcpy(value, mval.mv_data, sizeof(int));
             return true;
@@ -222,18 +749,198 @@ bool LMDBClient::GetInt(const std::string& key, int* value) {
         });
 }
 
-bool LMDBClient::Exists(const std::string& key) {
+// === 持仓 / 账户记录 ===
+
+namespace {
+
+using lmdb_records::AccountRecord;
+using lmdb_records::PositionRecord;
+
+// 旧格式：每个字段一个 8 字节 double
+const std::string kLegacyPositionPrefix = "positions:";
+const std::string kLegacyAccountPrefix = "account:";
+
+struct LegacyField {
+    const char* name;
+    size_t offset;
+};
+
+const LegacyField kPositionFields[] = {
+    { "vol", offsetof(PositionRecord, vol) },
+    { "available_vol", offsetof(PositionRecord, available_vol) },
+    { "avg_cost", offsetof(PositionRecord, avg_cost) },
+};
+
+const LegacyField kAccountFields[] = {
+    { "total_asset", offsetof(AccountRecord, total_asset) },
+    { "frozen_cash", offsetof(AccountRecord, frozen_cash) },
+    { "cash", offsetof(AccountRecord, cash) },
+    { "market_value", offsetof(AccountRecord, market_value) },
+};
+
+const LegacyField* FindField(const LegacyField* fields, size_t count, std::string_view name) {
+    for (size_t i = 0; i < count; ++i) {
+        if (name == fields[i].name) return &fields[i];
+    }
+    return nullptr;
+}
+
+int64_t NowUnixMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// 在已打开的事务里读 base + 各字段名 的旧 key，任何一个存在即返回 true
+template <typename Record, size_t N>
+bool ReadLegacy(MDB_txn* txn, MDB_dbi dbi, const std::string& base, const LegacyField (&fields)[N], Record* out) {
+    Record record;
+    bool any = false;
+    std::string key;
+    for (const LegacyField& field : fields) {
+        key = base + field.name;
+        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        MDB_val mval;
+        if (mdb_get(txn, dbi, &mkey, &mval) == MDB_SUCCESS && mval.mv_size == sizeof(double)) {
+            std::memcpy(reinterpret_cast<char*>(&record) + field.offset, mval.mv_data, sizeof(double));
+            any = true;
+        }
+    }
+    if (any && out) *out = record;
+    return any;
+}
+
+} // namespace
+
+bool LMDBClient::GetPosition(const std::string& stock_code, PositionRecord* record) {
+    std::string key = lmdb_records::PositionKey(stock_code);
     return ExecuteReadTransaction([&](MDB_txn* txn) {
         MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
         MDB_val mval;
-        return mdb_get(txn, dbi_, &mkey, &mval) == MDB_SUCCESS;
+        if (mdb_get(txn, dbi_, &mkey, &mval) == MDB_SUCCESS &&
+            lmdb_records::Decode(mval.mv_data, mval.mv_size, record)) {
+            return true;
+        }
+        return ReadLegacy(txn, dbi_, kLegacyPositionPrefix + stock_code + ":", kPositionFields, record);
+        });
+}
+
+bool LMDBClient::GetAccount(AccountRecord* record) {
+    return ExecuteReadTransaction([&](MDB_txn* txn) {
+        MDB_val mkey{ lmdb_records::kAccountKey.size(), const_cast<char*>(lmdb_records::kAccountKey.data()) };
+        MDB_val mval;
+        if (mdb_get(txn, dbi_, &mkey, &mval) == MDB_SUCCESS &&
+            lmdb_records::Decode(mval.mv_data, mval.mv_size, record)) {
+            return true;
+        }
+        return ReadLegacy(txn, dbi_, kLegacyAccountPrefix, kAccountFields, record);
+        });
+}
+
+bool LMDBClient::PutPosition(const std::string& stock_code, PositionRecord record) {
+    record.version = lmdb_records::kPositionVersion;
+    if (record.updated_ms == 0) record.updated_ms = NowUnixMs();
+    return Put(lmdb_records::PositionKey(stock_code),
+        std::string(reinterpret_cast<const char*>(&record), sizeof(record)));
+}
+
+bool LMDBClient::PutAccount(AccountRecord record) {
+    record.version = lmdb_records::kAccountVersion;
+    if (record.updated_ms == 0) record.updated_ms = NowUnixMs();
+    return Put(std::string(lmdb_records::kAccountKey),
+        std::string(reinterpret_cast<const char*>(&record), sizeof(record)));
+}
+
+int LMDBClient::MigrateLegacyRecords(bool delete_legacy) {
+    int migrated = 0;
+    bool ok = ExecuteWriteTransaction([&](MDB_txn* txn) {
+        migrated = 0;
+        std::map<std::string, PositionRecord> positions;
+        AccountRecord account;
+        bool has_account = false;
+        std::vector<std::string> legacy_keys;
+
+        MDB_cursor* cursor;
+        if (mdb_cursor_open(txn, dbi_, &cursor) != MDB_SUCCESS) return false;
+
+        // 1. 扫描 positions:<code>:<field>
+        MDB_val key{ kLegacyPositionPrefix.size(), const_cast<char*>(kLegacyPositionPrefix.data()) };
+        MDB_val data;
+        int rc = mdb_cursor_get(cursor, &key, &data, MDB_SET_RANGE);
+        while (rc == MDB_SUCCESS) {
+            std::string_view k(static_cast<char*>(key.mv_data), key.mv_size);
+            if (k.substr(0, kLegacyPositionPrefix.size()) != kLegacyPositionPrefix) break;
+
+            size_t sep = k.rfind(':');
+            const LegacyField* field = (sep > kLegacyPositionPrefix.size() && data.mv_size == sizeof(double))
+                ? FindField(kPositionFields, std::size(kPositionFields), k.substr(sep + 1)) : nullptr;
+            if (field) {
+                std::string code(k.substr(kLegacyPositionPrefix.size(), sep - kLegacyPositionPrefix.size()));
+                std::memcpy(reinterpret_cast<char*>(&positions[code]) + field->offset, data.mv_data, sizeof(double));
+                legacy_keys.emplace_back(k);
+            }
+            rc = mdb_cursor_get(cursor, &key, &data, MDB_NEXT);
+        }
+
+        // 2. 扫描 account:<field>
+        key = MDB_val{ kLegacyAccountPrefix.size(), const_cast<char*>(kLegacyAccountPrefix.data()) };
+        rc = mdb_cursor_get(cursor, &key, &data, MDB_SET_RANGE);
+        while (rc == MDB_SUCCESS) {
+            std::string_view k(static_cast<char*>(key.mv_data), key.mv_size);
+            if (k.substr(0, kLegacyAccountPrefix.size()) != kLegacyAccountPrefix) break;
+
+            const LegacyField* field = data.mv_size == sizeof(double)
+                ? FindField(kAccountFields, std::size(kAccountFields), k.substr(kLegacyAccountPrefix.size())) : nullptr;
+            if (field) {
+                std::memcpy(reinterpret_cast<char*>(&account) + field->offset, data.mv_data, sizeof(double));
+                has_account = true;
+                legacy_keys.emplace_back(k);
+            }
+            rc = mdb_cursor_get(cursor, &key, &data, MDB_NEXT);
+        }
+        mdb_cursor_close(cursor);
+
+        // 3. 写入定长记录；已经存在新格式记录的不覆盖（新格式更新）
+        int64_t now = NowUnixMs();
+        auto put_record = [&](const std::string& record_key, const void* bytes, size_t size) {
+            MDB_val mkey{ record_key.size(), const_cast<char*>(record_key.data()) };
+            MDB_val mval{ size, const_cast<void*>(bytes) };
+            int put_rc = TxnPut(txn, dbi_, &mkey, &mval, MDB_NOOVERWRITE);
+            if (put_rc == MDB_SUCCESS) ++migrated;
+            return put_rc == MDB_SUCCESS || put_rc == MDB_KEYEXIST;
+        };
+        for (auto& [code, record] : positions) {
+            record.updated_ms = now;
+            if (!put_record(lmdb_records::PositionKey(code), &record, sizeof(record))) return false;
+        }
+        if (has_account) {
+            account.updated_ms = now;
+            if (!put_record(std::string(lmdb_records::kAccountKey), &account, sizeof(account))) return false;
+        }
+
+        // 4. 删除旧 key
+        if (delete_legacy) {
+            for (const std::string& k : legacy_keys) {
+                MDB_val mkey{ k.size(), const_cast<char*>(k.data()) };
+                if (TxnDel(txn, dbi_, &mkey, nullptr) != MDB_SUCCESS) return false;
+            }
+        }
+        return true;
+        });
+    return ok ? migrated : -1;
+}
+
+bool LMDBClient::Exists(const std::string& key) {
+    return ExecuteReadTransaction([&](MDB_txn* txn) {
+        KeyRef ref(*this, key);
+        MDB_val mval;
+        return mdb_get(txn, ref.dbi, &ref.val, &mval) == MDB_SUCCESS;
         });
 }
 
 bool LMDBClient::Delete(const std::string& key) {
     return ExecuteWriteTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
-        return mdb_del(txn, dbi_, &mkey, nullptr) == MDB_SUCCESS;
+        KeyRef ref(*this, key);
+        return TxnDel(txn, ref.dbi, &ref.val, nullptr) == MDB_SUCCESS;
         });
 }
 
@@ -241,9 +948,9 @@ bool LMDBClient::GetStringBit(const std::string& key, int bit_index, bool* bit_v
     if (bit_index < 0 || bit_index > MAX_BIT_INDEX) return false;
 
     return ExecuteReadTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        KeyRef ref(*this, key);
         MDB_val mval;
-        int rc = mdb_get(txn, dbi_, &mkey, &mval);
+        int rc = mdb_get(txn, ref.dbi, &ref.val, &mval);
 
         if (rc == MDB_NOTFOUND) return false;
         if (rc != MDB_SUCCESS) return false;
@@ -260,17 +967,17 @@ bool LMDBClient::GetStringBit(const std::string& key, int bit_index, bool* bit_v
         });
 }
 
-// === ԭӲ (д) ===
+// === 原子操作 (必须是写事务) ===
 
 bool LMDBClient::AtomicSetStringBit(const std::string& key, int bit_index, bool set) {
     if (bit_index < 0 || bit_index > MAX_BIT_INDEX) return false;
 
     return ExecuteWriteTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        KeyRef ref(*this, key);
         MDB_val mval;
-        int rc = mdb_get(txn, dbi_, &mkey, &mval);
+        int rc = mdb_get(txn, ref.dbi, &ref.val, &mval);
 
-        std::string current_data; // ջϷ䣬 SSO
+        std::string current_data; // 栈上分配，利用 SSO
         if (rc == MDB_SUCCESS) {
             current_data.assign(static_cast<char*>(mval.mv_data), mval.mv_size);
         }
@@ -288,37 +995,37 @@ bool LMDBClient::AtomicSetStringBit(const std::string& key, int bit_index, bool
         else target &= ~(1 << (bit_index % 8));
 
         MDB_val mnew{ current_data.size(), current_data.data() };
-        return mdb_put(txn, dbi_, &mkey, &mnew, 0) == MDB_SUCCESS;
+        return TxnPut(txn, ref.dbi, &ref.val, &mnew, 0) == MDB_SUCCESS;
         });
 }
 
 bool LMDBClient::AtomicIncrement(const std::string& key, int increment) {
     return ExecuteWriteTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        KeyRef ref(*this, key);
         MDB_val mval;
         int current = 0;
-        int rc = mdb_get(txn, dbi_, &mkey, &mval);
+        int rc = mdb_get(txn, ref.dbi, &ref.val, &mval);
 
         if (rc == MDB_SUCCESS && mval.mv_size == sizeof(int)) {
             std::memcpy(&current, mval.mv_data, sizeof(int));
         }
 
         current += increment;
-        // ֱӹ buffer  IntToBytes Ŀ
+        // 直接构造 buffer 避免 IntToBytes 的拷贝
         char buf[sizeof(int)];
         std::memcpy(buf, &current, sizeof(int));
 
         MDB_val mnew{ sizeof(int), buf };
-        return mdb_put(txn, dbi_, &mkey, &mnew, 0) == MDB_SUCCESS;
+        return TxnPut(txn, ref.dbi, &ref.val, &mnew, 0) == MDB_SUCCESS;
         });
 }
 
 bool LMDBClient::AtomicIncrementDouble(const std::string& key, double increment) {
     return ExecuteWriteTransaction([&](MDB_txn* txn) {
-        MDB_val mkey{ key.size(), const_cast<char*>(key.data()) };
+        KeyRef ref(*this, key);
         MDB_val mval;
         double current = 0.0;
-        int rc = mdb_get(txn, dbi_, &mkey, &mval);
+        int rc = mdb_get(txn, ref.dbi, &ref.val, &mval);
 
         if (rc == MDB_SUCCESS && mval.mv_size == sizeof(double)) {
             std::memcpy(&current, mval.mv_data, sizeof(double));
@@ -330,7 +1037,102 @@ bool LMDBClient::AtomicIncrementDouble(const std::string& key, double increment)
         std::memcpy(buf, &current, sizeof(double));
 
         MDB_val mnew{ sizeof(double), buf };
-        return mdb_put(txn, dbi_, &mkey, &mnew, 0) == MDB_SUCCESS;
+        return TxnPut(txn, ref.dbi, &ref.val, &mnew, 0) == MDB_SUCCESS;
+        });
+}
+
+void LMDBClient::ApplyMutation(const Mutation& mutation, std::string* value, bool* exists) {
+    switch (mutation.op) {
+    case Mutation::Op::Put:
+        *value = mutation.value;
+        *exists = true;
+        break;
+    case Mutation::Op::Delete:
+        value->clear();
+        *exists = false;
+        break;
+    case Mutation::Op::SetBit:
+    case Mutation::Op::ClearBit: {
+        if (mutation.bit_index < 0 || mutation.bit_index > MAX_BIT_INDEX) return;
+        if (!*exists) value->clear();
+        size_t byte_offset = mutation.bit_index / 8;
+        if (value->size() <= byte_offset) value->resize(byte_offset + 1, 0);
+        unsigned char& target = reinterpret_cast<unsigned char&>((*value)[byte_offset]);
+        if (mutation.op == Mutation::Op::SetBit) target |= (1 << (mutation.bit_index % 8));
+        else target &= ~(1 << (mutation.bit_index % 8));
+        *exists = true;
+        break;
+    }
+    case Mutation::Op::Increment: {
+        int current = (*exists && value->size() == sizeof(int)) ? BytesToInt(*value) : 0;
+        *value = IntToBytes(current + mutation.delta);
+        *exists = true;
+        break;
+    }
+    case Mutation::Op::IncrementDouble: {
+        double current = (*exists && value->size() == sizeof(double)) ? BytesToDouble(*value) : 0.0;
+        *value = DoubleToBytes(current + mutation.delta_double);
+        *exists = true;
+        break;
+    }
+    case Mutation::Op::BitmapAdd:
+    case Mutation::Op::BitmapRemove: {
+        BlockBitmap bitmap;
+        // 损坏的值当作空位图重建
+        if (*exists) BlockBitmap::Deserialize(*value, &bitmap);
+        bool changed = mutation.op == Mutation::Op::BitmapAdd
+            ? bitmap.Add(mutation.member) : bitmap.Remove(mutation.member);
+        if (!changed && *exists) return;
+        if (bitmap.Empty()) {
+            value->clear();
+            *exists = false;
+        }
+        else {
+            bitmap.Serialize(value);
+            *exists = true;
+        }
+        break;
+    }
+    }
+}
+
+bool LMDBClient::ApplyMutations(std::span<const Mutation> mutations) {
+    if (mutations.empty()) return true;
+
+    return ExecuteWriteTransaction([&](MDB_txn* txn) {
+        std::string current;
+        for (const Mutation& mutation : mutations) {
+            KeyRef ref(*this, mutation.key);
+
+            if (mutation.op == Mutation::Op::Delete) {
+                int rc = TxnDel(txn, ref.dbi, &ref.val, nullptr);
+                if (rc != MDB_SUCCESS && rc != MDB_NOTFOUND) return false;
+                continue;
+            }
+
+            const std::string* next = &mutation.value;
+            if (mutation.op != Mutation::Op::Put) {
+                // 读-改-写：同一批里前面的变更已经 put 进本事务，这里读到的是叠加后的值
+                MDB_val mval;
+                int rc = mdb_get(txn, ref.dbi, &ref.val, &mval);
+                if (rc != MDB_SUCCESS && rc != MDB_NOTFOUND) return false;
+                bool existed = (rc == MDB_SUCCESS);
+                if (existed) current.assign(static_cast<char*>(mval.mv_data), mval.mv_size);
+                else current.clear();
+                bool exists = existed;
+                ApplyMutation(mutation, &current, &exists);
+                if (!exists) {
+                    // 位图删空后整条删除
+                    if (existed && TxnDel(txn, ref.dbi, &ref.val, nullptr) != MDB_SUCCESS) return false;
+                    continue;
+                }
+                next = &current;
+            }
+
+            MDB_val mnew{ next->size(), const_cast<char*>(next->data()) };
+            if (TxnPut(txn, ref.dbi, &ref.val, &mnew, 0) != MDB_SUCCESS) return false;
+        }
+        return true;
         });
 }
 
@@ -338,13 +1140,13 @@ bool LMDBClient::WriteBatch(const std::vector<std::pair<std::string, std::string
     const std::vector<std::string>& deletes) {
     return ExecuteWriteTransaction([&](MDB_txn* txn) {
         for (const auto& [k, v] : puts) {
-            MDB_val mkey{ k.size(), const_cast<char*>(k.data()) };
+            KeyRef ref(*this, k);
             MDB_val mval{ v.size(), const_cast<char*>(v.data()) };
-            if (mdb_put(txn, dbi_, &mkey, &mval, 0) != MDB_SUCCESS) return false;
+            if (TxnPut(txn, ref.dbi, &ref.val, &mval, 0) != MDB_SUCCESS) return false;
         }
         for (const auto& k : deletes) {
-            MDB_val mkey{ k.size(), const_cast<char*>(k.data()) };
-            if (mdb_del(txn, dbi_, &mkey, nullptr) != MDB_SUCCESS) return false;
+            KeyRef ref(*this, k);
+            if (TxnDel(txn, ref.dbi, &ref.val, nullptr) != MDB_SUCCESS) return false;
         }
         return true;
         });
@@ -352,7 +1154,7 @@ bool LMDBClient::WriteBatch(const std::vector<std::pair<std::string, std::string
 
 bool LMDBClient::WriteBatchDouble(const std::vector<std::pair<std::string, double>>& puts,
     const std::vector<std::string>& deletes) {
-    //  string 첻ƿԭ
+    // 对于批量操作，少量的 string 构造不是瓶颈，保持原样即可
     std::vector<std::pair<std::string, std::string>> str_puts;
     str_puts.reserve(puts.size());
     for (const auto& [k, v] : puts) {
@@ -363,95 +1165,257 @@ bool LMDBClient::WriteBatchDouble(const std::vector<std::pair<std::string, doubl
 
 bool LMDBClient::DeleteDatabase() {
     return ExecuteWriteTransaction([&](MDB_txn* txn) {
-        // mdb_drop: 0 ʾݵر DBI 
-        // һ O(1) 
-        return mdb_drop(txn, dbi_, 0) == MDB_SUCCESS;
+        // 命名 DBI 用 mdb_drop 清空（0 表示保留 DBI 句柄），O(页数) 而不是逐 key 删除
+        for (size_t i = 0; i < kNamespaceCount; ++i) {
+            if (ns_open_[i] && TxnDrop(txn, ns_dbi_[i], 0) != MDB_SUCCESS) return false;
+        }
+        // 主库里存着命名 DBI 的记录，不能整体 drop，逐个删除业务 key
+        return WalkKeys(txn, dbi_, {}, true,
+            [](const MDB_val& key) { return IsNamespaceName(key) ? Visit::Skip : Visit::Take; },
+            [](const MDB_val&, const MDB_val&) {});
         });
 }
 
 bool LMDBClient::DeleteKeys(const std::string& prefix) {
-    // ǰ׺Ϊգ߼ϵͬݿ⣬ DeleteDatabase 
+    // 如果前缀为空，逻辑上等同于清空数据库，但用 DeleteDatabase 更快
     if (prefix.empty()) {
         return DeleteDatabase();
     }
 
     return ExecuteWriteTransaction([&](MDB_txn* txn) {
-        MDB_cursor* cursor;
-        if (mdb_cursor_open(txn, dbi_, &cursor) != MDB_SUCCESS) return false;
-
-        MDB_val key, data;
-        MDB_val pkey{ prefix.size(), const_cast<char*>(prefix.data()) };
+        for (size_t i = 0; i < kNamespaceCount; ++i) {
+            const NamespaceSpec& ns = kNamespaces[i];
+            if (!ns_open_[i]) continue;
 
-        // 1. λһ >= prefix λ
-        int rc = mdb_cursor_get(cursor, &pkey, &data, MDB_SET_RANGE);
-
-        while (rc == MDB_SUCCESS) {
-            std::string current_key(static_cast<char*>(pkey.mv_data), pkey.mv_size);
-
-            // 2. ǰ׺ƥ
-            if (current_key.substr(0, prefix.size()) != prefix) {
-                // ǰ key ǰ׺ͷ˵ĶƥˣΪģ
-                break;
+            if (StartsWith(ns.prefix, prefix)) {
+                // 前缀覆盖整个命名空间（如 RESET_STATUS 的 "BLK_" / "blk_size"）：直接清空 DBI
+                if (TxnDrop(txn, ns_dbi_[i], 0) != MDB_SUCCESS) return false;
             }
-
-            // 3. ɾǰαָ
-            // ע⣺mdb_cursor_del Զαƶһ
-            if (mdb_cursor_del(cursor, 0) != MDB_SUCCESS) {
-                mdb_cursor_close(cursor);
-                return false;
+            else if (StartsWith(prefix, ns.prefix)) {
+                std::string_view rest = std::string_view(prefix).substr(ns.prefix.size());
+                bool ok = ns.integer_key
+                    // 整数 key 按数值排序，与字符串前缀无关，只能全表比较
+                    ? WalkKeys(txn, ns_dbi_[i], {}, true,
+                        [&](const MDB_val& key) { return StartsWith(FormatKey(ns, key), prefix) ? Visit::Take : Visit::Skip; },
+                        [](const MDB_val&, const MDB_val&) {})
+                    : WalkKeys(txn, ns_dbi_[i], rest, true,
+                        [&](const MDB_val& key) {
+                            std::string_view k(static_cast<const char*>(key.mv_data), key.mv_size);
+                            return StartsWith(k, rest) ? Visit::Take : Visit::Stop;
+                        },
+                        [](const MDB_val&, const MDB_val&) {});
+                if (!ok) return false;
             }
-
-            // 4. ȡһΪղɾˣαѾָȥˣ GET_CURRENT
-            // ɾһGET_CURRENT ᷵ MDB_NOTFOUNDѭ
-            rc = mdb_cursor_get(cursor, &pkey, &data, MDB_GET_CURRENT);
         }
 
-        mdb_cursor_close(cursor);
-        return true;
+        // 主库：不属于任何命名空间的 key，以及不符合整数格式、留在主库的 key
+        return WalkKeys(txn, dbi_, prefix, true,
+            [&](const MDB_val& key) {
+                std::string_view k(static_cast<const char*>(key.mv_data), key.mv_size);
+                if (!StartsWith(k, prefix)) return Visit::Stop;
+                return IsNamespaceName(key) ? Visit::Skip : Visit::Take;
+            },
+            [](const MDB_val&, const MDB_val&) {});
         });
 }
 
 std::vector<std::string> LMDBClient::GetKeys(const std::string& prefix) {
     std::vector<std::string> keys;
     ExecuteReadTransaction([&](MDB_txn* txn) {
-        MDB_cursor* cursor;
-        if (mdb_cursor_open(txn, dbi_, &cursor) != MDB_SUCCESS) return false;
+        keys.clear();
+        bool ok = WalkKeys(txn, dbi_, prefix, false,
+            [&](const MDB_val& key) {
+                std::string_view k(static_cast<const char*>(key.mv_data), key.mv_size);
+                if (!StartsWith(k, prefix)) return Visit::Stop;
+                return IsNamespaceName(key) ? Visit::Skip : Visit::Take;
+            },
+            [&](const MDB_val& key, const MDB_val&) { keys.emplace_back(static_cast<const char*>(key.mv_data), key.mv_size); });
+
+        for (size_t i = 0; ok && i < kNamespaceCount; ++i) {
+            const NamespaceSpec& ns = kNamespaces[i];
+            if (!ns_open_[i] || (!StartsWith(ns.prefix, prefix) && !StartsWith(prefix, ns.prefix))) continue;
+
+            std::string_view seek;
+            if (!ns.integer_key && prefix.size() > ns.prefix.size()) {
+                seek = std::string_view(prefix).substr(ns.prefix.size());
+            }
+            ok = WalkKeys(txn, ns_dbi_[i], seek, false,
+                [&](const MDB_val& key) {
+                    std::string full = FormatKey(ns, key);
+                    if (StartsWith(full, prefix)) return Visit::Take;
+                    return (ns.integer_key || seek.empty()) ? Visit::Skip : Visit::Stop;
+                },
+                [&](const MDB_val& key, const MDB_val&) { keys.push_back(FormatKey(ns, key)); });
+        }
+
+        // 各 DBI 的结果合并后保持与单库时相同的字典序
+        std::sort(keys.begin(), keys.end());
+        return ok;
+        });
+    return keys;
+}
 
-        MDB_val key, data;
-        MDB_cursor_op op = MDB_FIRST;
+// === 零拷贝读视图 ===
 
-        if (!prefix.empty()) {
-            MDB_val pkey{ prefix.size(), const_cast<char*>(prefix.data()) };
-            if (mdb_cursor_get(cursor, &pkey, &data, MDB_SET_RANGE) != MDB_SUCCESS) {
-                mdb_cursor_close(cursor);
-                return true;
-            }
-            // MDB_SET_RANGE  key Ѿָ >= prefix ĵһ
-            // ʱ pkey Ѿ޸Ϊݿ keyҪȡж
-            if (mdb_cursor_get(cursor, &key, &data, MDB_GET_CURRENT) != MDB_SUCCESS) {
-                mdb_cursor_close(cursor);
-                return true;
+LMDBClient::ReadScope::ReadScope(LMDBClient& client)
+    : client_(client), guard_(std::make_unique<EnvGuard>(&client)) {
+    if (!guard_->ok()) return;
+
+    if (client_.read_snapshot_.load(std::memory_order_relaxed)) {
+        txn_ = client_.AcquireReadSnapshot();
+        if (txn_) {
+            pinned_ = true;
+            return;
+        }
+    }
+    if (mdb_txn_begin(client_.env_, nullptr, MDB_RDONLY, &txn_) != MDB_SUCCESS) txn_ = nullptr;
+}
+
+LMDBClient::ReadScope::~ReadScope() {
+    if (pinned_) client_.UnpinReadSnapshot();
+    else if (txn_) mdb_txn_abort(txn_);
+    // guard_ 在事务结束之后才释放
+}
+
+uint64_t LMDBClient::ReadScope::TxnId() const {
+    return txn_ ? static_cast<uint64_t>(mdb_txn_id(txn_)) : 0;
+}
+
+bool LMDBClient::ReadScope::Get(std::string_view key, std::string_view* value) const {
+    if (!txn_) return false;
+    KeyRef ref(client_, key);
+    MDB_val mval;
+    if (mdb_get(txn_, ref.dbi, &ref.val, &mval) != MDB_SUCCESS) return false;
+    if (value) *value = std::string_view(static_cast<const char*>(mval.mv_data), mval.mv_size);
+    return true;
+}
+
+bool LMDBClient::ReadScope::Get(std::string_view key, std::span<const std::byte>* bytes) const {
+    std::string_view view;
+    if (!Get(key, &view)) return false;
+    if (bytes) *bytes = std::as_bytes(std::span<const char>(view.data(), view.size()));
+    return true;
+}
+
+bool LMDBClient::ReadScope::GetDouble(std::string_view key, double* value) const {
+    std::string_view view;
+    if (!Get(key, &view) || view.size() != sizeof(double)) return false;
+    if (value) std::memcpy(value, view.data(), sizeof(double));
+    return true;
+}
+
+bool LMDBClient::ReadScope::GetInt(std::string_view key, int* value) const {
+    std::string_view view;
+    if (!Get(key, &view) || view.size() != sizeof(int)) return false;
+    if (value) std::memcpy(value, view.data(), sizeof(int));
+    return true;
+}
+
+LMDBClient::PrefixCursor LMDBClient::ReadScope::Prefix(std::string_view prefix) const {
+    return PrefixCursor(&client_, txn_, prefix);
+}
+
+// 与 GetKeys 相同的划分：主库 + 与前缀有交集的命名空间
+LMDBClient::PrefixCursor::PrefixCursor(const LMDBClient* client, MDB_txn* txn, std::string_view prefix)
+    : client_(client), txn_(txn), prefix_(prefix) {
+    if (!txn_) return;
+
+    segments_.push_back(Segment{ client_->dbi_, -1, prefix_.empty() ? std::string::npos : 0 });
+    for (size_t i = 0; i < kNamespaceCount; ++i) {
+        const NamespaceSpec& ns = kNamespaces[i];
+        if (!client_->ns_open_[i] || (!StartsWith(ns.prefix, prefix_) && !StartsWith(prefix_, ns.prefix))) continue;
+        size_t seek_from = (!ns.integer_key && prefix_.size() > ns.prefix.size()) ? ns.prefix.size() : std::string::npos;
+        segments_.push_back(Segment{ client_->ns_dbi_[i], static_cast<int>(i), seek_from });
+    }
+}
+
+LMDBClient::PrefixCursor::PrefixCursor(PrefixCursor&& other) noexcept
+    : client_(other.client_), txn_(other.txn_), prefix_(std::move(other.prefix_)),
+    segments_(std::move(other.segments_)), segment_(other.segment_), cursor_(other.cursor_),
+    buffer_(std::move(other.buffer_)) {
+    other.cursor_ = nullptr;
+    other.segments_.clear();
+}
+
+LMDBClient::PrefixCursor::~PrefixCursor() {
+    if (cursor_) mdb_cursor_close(cursor_);
+}
+
+bool LMDBClient::PrefixCursor::Next() {
+    MDB_val key;
+    MDB_val data;
+    while (segment_ < segments_.size()) {
+        const Segment& segment = segments_[segment_];
+        const NamespaceSpec* ns = segment.ns >= 0 ? &kNamespaces[segment.ns] : nullptr;
+
+        int rc;
+        if (!cursor_) {
+            if (mdb_cursor_open(txn_, segment.dbi, &cursor_) != MDB_SUCCESS) {
+                cursor_ = nullptr;
+                ++segment_;
+                continue;
             }
-            op = MDB_NEXT; // һѭ NEXT
+            std::string_view seek = segment.seek_from == std::string::npos
+                ? std::string_view() : std::string_view(prefix_).substr(segment.seek_from);
+            key = MDB_val{ seek.size(), const_cast<char*>(seek.data()) };
+            rc = mdb_cursor_get(cursor_, &key, &data, seek.empty() ? MDB_FIRST : MDB_SET_RANGE);
         }
         else {
-            if (mdb_cursor_get(cursor, &key, &data, MDB_FIRST) != MDB_SUCCESS) {
-                mdb_cursor_close(cursor);
-                return true;
-            }
+            rc = mdb_cursor_get(cursor_, &key, &data, MDB_NEXT);
         }
 
-        // ѭ
-        do {
-            std::string key_str(static_cast<char*>(key.mv_data), key.mv_size);
-            if (!prefix.empty()) {
-                if (key_str.substr(0, prefix.size()) != prefix) break;
+        for (; rc == MDB_SUCCESS; rc = mdb_cursor_get(cursor_, &key, &data, MDB_NEXT)) {
+            std::string_view k(static_cast<const char*>(key.mv_data), key.mv_size);
+            Visit visit = Visit::Take;
+            std::string_view suffix;
+
+            if (!ns) {
+                if (!StartsWith(k, prefix_)) visit = Visit::Stop;
+                else if (IsNamespaceName(key)) visit = Visit::Skip;
+                else suffix = k.substr(prefix_.size());
+            }
+            else if (!ns->integer_key && prefix_.size() >= ns->prefix.size()) {
+                // 库里的 key 就是完整 key 去掉命名空间前缀，后缀直接切片
+                std::string_view rest = std::string_view(prefix_).substr(ns->prefix.size());
+                if (!StartsWith(k, rest)) visit = Visit::Stop;
+                else suffix = k.substr(rest.size());
+            }
+            else {
+                // 整数 key，或查询前缀比命名空间前缀短：在 buffer_ 里还原完整 key
+                FormatKeyInto(*ns, key, &buffer_);
+                if (!StartsWith(buffer_, prefix_)) visit = Visit::Skip;
+                else suffix = std::string_view(buffer_).substr(prefix_.size());
             }
-            keys.push_back(std::move(key_str));
-        } while (mdb_cursor_get(cursor, &key, &data, MDB_NEXT) == MDB_SUCCESS);
 
-        mdb_cursor_close(cursor);
-        return true;
-        });
-    return keys;
-}
\ No newline at end of file
+            if (visit == Visit::Stop) break;
+            if (visit == Visit::Skip) continue;
+            entry_.suffix = suffix;
+            entry_.value = std::string_view(static_cast<const char*>(data.mv_data), data.mv_size);
+            return true;
+        }
+
+        mdb_cursor_close(cursor_);
+        cursor_ = nullptr;
+        ++segment_;
+    }
+    return false;
+}
+
+// === 前缀汇总 ===
+
+bool LMDBClient::AggregateDoubles(std::string_view prefix, Aggregate* result,
+    std::span<const std::string_view> skip_suffixes) {
+    ReadScope scope(*this);
+    if (!scope.ok()) return false;
+
+    Aggregate aggregate;
+    for (const auto& [suffix, value] : scope.Prefix(prefix)) {
+        if (value.size() != sizeof(double)) continue;
+        if (!skip_suffixes.empty() && std::binary_search(skip_suffixes.begin(), skip_suffixes.end(), suffix)) continue;
+        double number;
+        std::memcpy(&number, value.data(), sizeof(number));
+        aggregate.Add(number);
+    }
+    *result = aggregate;
+    return true;
+}
@@ -3,9 +3,16 @@
 
 #include <string>
 #include <vector>
-#include <shared_mutex> // 滻 mutex Ϊ shared_mutex
+#include <span>
+#include <mutex>
+#include <atomic>
 #include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string_view>
 #include <lmdb.h>
+#include "lmdb_records.h"
 #include <stdexcept>
 
 class LMDBClient {
@@ -22,19 +29,41 @@ public:
 
     LMDBClient() = default;
 
-    // === ת ===
-    // Żתٵÿ
+    // === 转换函数 ===
+    // 优化：内联简单转换，减少调用开销
     static std::string DoubleToBytes(double value);
     static double BytesToDouble(const std::string& bytes);
     static std::string IntToBytes(int value);
     static int BytesToInt(const std::string& bytes);
 
     bool Initialize(const std::string& db_path, size_t map_size_mb = 100, bool read_only = false);
+
+    // 读快照模式：每个线程保留一个 MDB_RDONLY 事务句柄和 reader slot，读完 reset（不再占着快照），
+    // 下次读时 renew 到最新快照，省去每次 begin / abort 的分配；空闲线程不会钉住旧快照阻止写入方复用页
+    // 关闭后每次读都 begin / abort 一个新事务
+    void SetReadSnapshot(bool enabled) { read_snapshot_.store(enabled, std::memory_order_relaxed); }
+    bool ReadSnapshotEnabled() const { return read_snapshot_.load(std::memory_order_relaxed); }
     void Close();
     ~LMDBClient();
 
-    // === Ĳ ===
-    // ʹ std::string_view ⲿֿ (C++17)Ϊ˼ string& ڲŻ
+    // === 映射大小 ===
+    // Initialize 的 map_size_mb 是初始大小；写事务遇到 MDB_MAP_FULL 时原地扩大（翻倍，至少 64MB）并重做事务，
+    // 最多扩到 max_map_size_mb（0 表示不限）。扩容期间新的读写短暂等待，已在进行的读写先完成
+    void SetMapSizeLimit(size_t max_map_size_mb);
+
+    struct MapUsage {
+        size_t map_size = 0;      // 当前映射大小（字节）
+        size_t used = 0;          // 已使用的页（字节），包括空闲列表里可复用的页
+        size_t max_map_size = 0;  // 扩容上限，0 表示不限
+        uint64_t grows = 0;       // 本进程扩容次数
+    };
+    bool GetMapUsage(MapUsage* usage);
+
+    // 环境最近一次提交的事务号（本进程或其他进程），用于判断内存里的镜像是否过期；未初始化时为 0
+    uint64_t LastTxnId();
+
+    // === 核心操作 ===
+    // 使用 std::string_view 避免部分拷贝 (C++17)，为了兼容性这里仍用 string& 但内部优化
     bool Put(const std::string& key, const std::string& value);
     bool PutDouble(const std::string& key, double value);
 
@@ -42,6 +71,18 @@ public:
     bool GetDouble(const std::string& key, double* value);
     bool GetInt(const std::string& key, int* value);
 
+    // === 持仓 / 账户记录（格式见 lmdb_records.h） ===
+    // 先读定长记录，没有时在同一个读事务里回退到旧的逐字段 key；两种都没有返回 false
+    bool GetPosition(const std::string& stock_code, lmdb_records::PositionRecord* record);
+    bool GetAccount(lmdb_records::AccountRecord* record);
+    // updated_ms 为 0 时填当前时间
+    bool PutPosition(const std::string& stock_code, lmdb_records::PositionRecord record);
+    bool PutAccount(lmdb_records::AccountRecord record);
+
+    // 把旧格式的持仓 / 账户 key 合并成定长记录，在一个写事务里完成，返回生成的记录数（失败为 -1）
+    // 写入方切换到新格式之后再执行；delete_legacy 为 true 时删除旧 key，避免读到过期的旧值
+    int MigrateLegacyRecords(bool delete_legacy);
+
     bool Exists(const std::string& key);
     bool Delete(const std::string& key);
 
@@ -51,29 +92,214 @@ public:
     bool AtomicIncrement(const std::string& key, int increment);
     bool AtomicIncrementDouble(const std::string& key, double increment);
 
+    // === 变更批量提交（WriteCombiner 使用） ===
+    struct Mutation {
+        enum class Op : uint8_t { Put, Delete, SetBit, ClearBit, Increment, IncrementDouble, BitmapAdd, BitmapRemove };
+        Op op = Op::Put;
+        std::string key;
+        std::string value;          // Put
+        int bit_index = 0;          // SetBit / ClearBit
+        int delta = 0;              // Increment
+        double delta_double = 0.0;  // IncrementDouble
+        uint32_t member = 0;        // BitmapAdd / BitmapRemove，值为 BlockBitmap 序列化格式
+    };
+    // 按顺序在一个写事务里应用，任一条失败整批回滚；Delete 不存在的 key 不算失败
+    bool ApplyMutations(std::span<const Mutation> mutations);
+    // 在内存中对一个值应用变更，语义与 AtomicSetStringBit / AtomicIncrement* / Put / Delete 一致
+    // exists 进出都表示 key 是否存在
+    static void ApplyMutation(const Mutation& mutation, std::string* value, bool* exists);
+
     bool WriteBatch(const std::vector<std::pair<std::string, std::string>>& puts, const std::vector<std::string>& deletes = {});
     bool WriteBatchDouble(const std::vector<std::pair<std::string, double>>& puts, const std::vector<std::string>& deletes = {});
 
-    // ݿ
+    // 清空整个数据库
     bool DeleteDatabase();
-    // ɾ prefix ͷ key
+    // 删除所有以 prefix 开头的 key
     bool DeleteKeys(const std::string& prefix);
 
     std::vector<std::string> GetKeys(const std::string& prefix = "");
 
+    // === 前缀汇总 ===
+    // prefix 下所有 double 值的个数 / 和 / 最小 / 最大；在一个读事务内用游标一次遍历，不逐 key 分配内存
+    struct Aggregate {
+        uint64_t count = 0;
+        double sum = 0.0;
+        double min = 0.0;   // count 为 0 时无意义
+        double max = 0.0;
+
+        void Add(double value) {
+            if (count == 0 || value < min) min = value;
+            if (count == 0 || value > max) max = value;
+            sum += value;
+            ++count;
+        }
+    };
+    // 长度不是 8 字节的值跳过；skip_suffixes 需已排序，key 去掉 prefix 后命中其中之一的不计入
+    // （WriteCombiner 用它把本线程未提交的 key 换成叠加后的值）
+    bool AggregateDoubles(std::string_view prefix, Aggregate* result,
+        std::span<const std::string_view> skip_suffixes = {});
+
+    // === 零拷贝读视图 ===
+private:
+    class EnvGuard;
+
+public:
+    class ReadScope;
+
+    // 按前缀遍历，不复制 key / value；由 ReadScope::Prefix 创建，只能在该 scope 内使用
+    // 各 DBI 内按 key 顺序，跨命名空间的前缀（如 ""）不保证整体顺序
+    class PrefixCursor {
+    public:
+        struct Entry {
+            std::string_view suffix;  // key 去掉查询前缀后的部分
+            std::string_view value;   // 指向内存映射
+        };
+
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Entry;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Entry*;
+            using reference = const Entry&;
+
+            explicit iterator(PrefixCursor* cursor) : cursor_(cursor) {}
+            const Entry& operator*() const { return cursor_->entry(); }
+            const Entry* operator->() const { return &cursor_->entry(); }
+            iterator& operator++() {
+                if (!cursor_->Next()) cursor_ = nullptr;
+                return *this;
+            }
+            bool operator==(std::default_sentinel_t) const { return cursor_ == nullptr; }
+
+        private:
+            PrefixCursor* cursor_;
+        };
+
+        PrefixCursor(PrefixCursor&& other) noexcept;
+        PrefixCursor& operator=(PrefixCursor&&) = delete;
+        PrefixCursor(const PrefixCursor&) = delete;
+        PrefixCursor& operator=(const PrefixCursor&) = delete;
+        ~PrefixCursor();
+
+        // 前进到下一条，没有了返回 false；entry() 的 suffix 可能指向游标内部缓冲，下一次 Next 后失效
+        bool Next();
+        const Entry& entry() const { return entry_; }
+
+        // for (const auto& [suffix, value] : scope.Prefix("key:acct:")) 只能遍历一次
+        iterator begin() { return iterator(Next() ? this : nullptr); }
+        std::default_sentinel_t end() const { return {}; }
+
+    private:
+        friend class ReadScope;
+        PrefixCursor(const LMDBClient* client, MDB_txn* txn, std::string_view prefix);
+
+        struct Segment {
+            MDB_dbi dbi;
+            int ns;            // -1 为主库，其余为命名空间下标
+            size_t seek_from;  // 从 prefix_ 的这个位置开始作为 SET_RANGE 的 key，npos 表示从头
+        };
+
+        const LMDBClient* client_;
+        MDB_txn* txn_;
+        std::string prefix_;
+        std::vector<Segment> segments_;
+        size_t segment_ = 0;
+        MDB_cursor* cursor_ = nullptr;
+        std::string buffer_;  // key 在库里不连续时（整数 key、跨命名空间前缀）在这里拼出，复用不重新分配
+        Entry entry_;
+    };
+
+    // 在一个只读快照上读取，返回的 view 直接指向内存映射，只在 scope 存活期间有效
+    // 读快照模式下 scope 期间本线程的快照被钉住，其他读也看到同一快照
+    // scope 会推迟 Close / 映射扩容，应尽快结束；scope 内不要写入
+    class ReadScope {
+    public:
+        explicit ReadScope(LMDBClient& client);
+        ~ReadScope();
+        ReadScope(const ReadScope&) = delete;
+        ReadScope& operator=(const ReadScope&) = delete;
+
+        bool ok() const { return txn_ != nullptr; }
+        // scope 所读快照的事务号，与 LastTxnId 比较即可知道是否有更新的提交
+        uint64_t TxnId() const;
+
+        // 不存在或 scope 无效时返回 false
+        bool Get(std::string_view key, std::string_view* value) const;
+        bool Get(std::string_view key, std::span<const std::byte>* bytes) const;
+        bool GetDouble(std::string_view key, double* value) const;
+        bool GetInt(std::string_view key, int* value) const;
+
+        PrefixCursor Prefix(std::string_view prefix) const;
+
+    private:
+        LMDBClient& client_;
+        std::unique_ptr<EnvGuard> guard_;
+        MDB_txn* txn_ = nullptr;
+        bool pinned_ = false;  // txn_ 是本线程的读快照（不结束，只解除钉住）
+    };
+
+    // === 命名空间 ===
+    // DLL 自己写的几类 key 按前缀分到各自的命名 DBI，接口仍然使用带前缀的完整 key：
+    //   BLK_<6位代码>   -> "ns.block"       MDB_INTEGERKEY
+    //   blk_size:<n>    -> "ns.block_size"  MDB_INTEGERKEY
+    //   key:<账号>:<k>  -> "ns.user_key"    去掉前缀后的字符串
+    //   dedup:<hex>     -> "ns.dedup"       去掉前缀后的字符串
+    //   blkmap:<n>      -> "ns.blkmap"      MDB_INTEGERKEY，板块成员位图（见 block_engine.h）
+    // 不符合整数格式的 key（例如字母代码）以及持仓 / 账户等外部进程写入的 key 留在主库
+    // 可写方式打开时自动把主库里旧的带前缀 key 迁移到对应 DBI
+    static constexpr size_t kNamespaceCount = 5;
+
 private:
-    // ֶдִòͬ
+    struct ReadSnapshot;
+    struct SnapshotList;
+    class KeyRef;
+
+    // 在 Initialize 的事务里打开（可写时创建）命名 DBI，并迁移主库里的旧 key
+    bool OpenNamespaces(MDB_txn* txn, bool read_only);
+
+    static constexpr size_t kMinMapGrowth = 64ull * 1024 * 1024;
+    static constexpr int kMaxResizeAttempts = 4;
+    // 扩大映射：seen_size 是失败时看到的大小，已被其他线程扩过则直接返回 true
+    // adopt 为 true 时不扩容，只采用其他进程扩大后的大小（MDB_MAP_RESIZED）
+    // 调用方不能处于 EnvGuard 内
+    bool ResizeMap(size_t seen_size, bool adopt);
+
+    // 取本线程的读快照事务，只能在 EnvGuard 范围内调用；失败返回 nullptr，调用方退回一次性事务
+    static ReadSnapshot& LocalReadSnapshot();
+    // 钉住快照：在对应的 UnpinReadSnapshot 之前不再 reset / renew，ReadScope 借出的 view 保持有效，可嵌套
+    MDB_txn* AcquireReadSnapshot();
+    // 解除一层钉住；计数归零时 reset，释放快照但保留 reader slot 和事务句柄，下次 Acquire 时 renew
+    void UnpinReadSnapshot();
+    // 归还读快照（释放 reader slot）；已被 Close / 扩容终止的不再处理
+    static void ReleaseReadSnapshot(SnapshotList& list, MDB_txn* txn);
+    // 关闭环境前终止所有线程的读快照，调用时所有 EnvGuard 必须已退出
+    void AbortReadSnapshots();
+
+    // 拆分读写事务执行器以利用不同的锁
     template<typename Func>
     bool ExecuteReadTransaction(Func&& func);
 
     template<typename Func>
     bool ExecuteWriteTransaction(Func&& func);
 
-    mutable std::shared_mutex mutex_; // Żд
+    // 读写路径不加锁：LMDB 本身是 MVCC，写事务由 LMDB 的写锁串行
+    // 环境的生命周期用 EnvGuard 保护：每个线程在自己的槽位上登记进出，Close 等所有槽位清零后才关闭环境
+    // lifecycle_mutex_ 只在 Initialize / Close 之间互斥
+    std::mutex lifecycle_mutex_;
     MDB_env* env_ = nullptr;
     MDB_dbi dbi_ = 0;
-    bool initialized_ = false;
+    MDB_dbi ns_dbi_[kNamespaceCount] = {};
+    bool ns_open_[kNamespaceCount] = {};   // 只读打开且库里还没有该 DBI 时为 false，key 留在主库
+    std::atomic<bool> initialized_{ false };
+    std::atomic<bool> paused_{ false };      // ResizeMap 期间为 true，新的 EnvGuard 等待
+    std::atomic<size_t> max_map_size_{ 0 };
+    std::atomic<uint64_t> map_grows_{ 0 };
     bool read_only_ = false;
+
+    std::atomic<bool> read_snapshot_{ true };
+    // 当前环境的读快照登记表；Close / 扩容时终止其中的事务并换成新表，线程里缓存的旧快照据此判定已失效
+    std::shared_ptr<SnapshotList> snapshots_;
 };
 
 #endif // LMDB_CLIENT_H
\ No newline at end of file
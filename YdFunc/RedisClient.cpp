@@ -1,4 +1,5 @@
 ﻿#include "RedisClient.h"
+#include "latency_metrics.h"
 #include <cstring>
 #include <cstdio>
 #include <cctype>
@@ -8,6 +9,12 @@
 #include <memory>
 #include <chrono>
 #include <thread>
+#include <string_view>
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <sys/select.h>
+#endif
 
 redisReply* RedisClient::ExecuteCommand(redisContext* context, const char* format, ...) {
     if (!context) return nullptr;
@@ -27,70 +34,159 @@ bool RedisClient::CheckReply(redisReply* reply) {
     return true;
 }
 
-RedisClient::RedisClient()
-    : context_(nullptr, redisFree)
-    , async_context_(nullptr, redisAsyncFree) {
+namespace {
+
+// prefix 开头的 SCAN MATCH 模式；prefix 里的通配符按字面匹配
+std::string ScanPattern(const std::string& prefix) {
+    std::string pattern;
+    pattern.reserve(prefix.size() + 1);
+    for (char c : prefix) {
+        if (c == '*' || c == '?' || c == '[' || c == ']' || c == '\\') pattern.push_back('\\');
+        pattern.push_back(c);
+    }
+    pattern.push_back('*');
+    return pattern;
+}
+
+} // namespace
+
+RedisClient::RedisClient() {
 }
 
 RedisClient::~RedisClient() {
+    // 析构处于 loader lock 下：后台线程只通知退出并 detach
+    StopStreams(std::chrono::milliseconds(0));
+    StopTracking(std::chrono::milliseconds(0));
     Close();
+    StopSubscriberWorkers(std::chrono::milliseconds(0));
 }
-bool RedisClient::Initialize(const std::string& connection_string, bool read_only) {
+bool RedisClient::Initialize(const std::string& connection_string, bool read_only, size_t pool_size) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (initialized_) return true;
 
     read_only_ = read_only;
     connection_string_ = connection_string;
 
-    size_t colon_pos = connection_string.find(':');
-    if (colon_pos == std::string::npos) return false;
+    // host:port，也接受 redis://host:port
+    std::string_view address = connection_string;
+    constexpr std::string_view kScheme = "redis://";
+    if (address.substr(0, kScheme.size()) == kScheme) address.remove_prefix(kScheme.size());
+    while (!address.empty() && address.back() == '/') address.remove_suffix(1);
+
+    size_t colon_pos = address.rfind(':');
+    if (colon_pos == std::string_view::npos) return false;
 
-    std::string host = connection_string.substr(0, colon_pos);
-    int port = 0;
+    host_ = std::string(address.substr(0, colon_pos));
     try {
-        port = std::stoi(connection_string.substr(colon_pos + 1));
+        port_ = std::stoi(std::string(address.substr(colon_pos + 1)));
     }
     catch (...) { return false; }
 
-    context_ = std::unique_ptr<redisContext, decltype(&redisFree)>(
-        redisConnect(host.c_str(), port),
-        redisFree
-    );
+    // 先连一条验证地址，其余连接在各线程第一次借出时再建立
+    std::unique_ptr<redisContext, decltype(&redisFree)> first(Connect(), redisFree);
+    if (!first) return false;
 
-    if (context_ == nullptr || context_->err) {
-        return false;
-    }
-
-    redisReply* ping_reply = ExecuteCommand(context_.get(), "PING");
+    redisReply* ping_reply = ExecuteCommand(first.get(), "PING");
     if (!CheckReply(ping_reply)) {
-        context_.reset();
         return false;
     }
     freeReplyObject(ping_reply);
 
-    initialized_ = true;
+    if (pool_.empty()) {
+        if (pool_size == 0) pool_size = 1;
+        for (size_t i = 0; i < pool_size; ++i) pool_.push_back(std::make_unique<PooledContext>());
+    }
+    {
+        std::lock_guard<std::mutex> slot_lock(pool_[0]->mutex);
+        pool_[0]->context = std::move(first);
+    }
+
+    initialized_.store(true, std::memory_order_release);
     return true;
 }
 
-RedisClient& RedisClient::GetInstanceAndInitialize(const std::string& connection_string, bool read_only) {
+RedisClient& RedisClient::GetInstanceAndInitialize(const std::string& connection_string, bool read_only, size_t pool_size) {
     RedisClient& client = GetInstance();
-    client.Initialize(connection_string, read_only);
+    client.Initialize(connection_string, read_only, pool_size);
     return client;
 }
 
-bool RedisClient::Get(const std::string& key, std::string* value) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!initialized_) return false;
+// === 连接池 ===
 
-    redisReply* reply = ExecuteCommand(context_.get(), "GET %b", key.data(), key.size());
-    if (!CheckReply(reply)) return false;
+redisContext* RedisClient::Connect() const {
+    redisContext* context = redisConnect(host_.c_str(), port_);
+    if (context && context->err) {
+        redisFree(context);
+        return nullptr;
+    }
+    return context;
+}
+
+RedisClient::PooledContext& RedisClient::LocalContext() {
+    // 线程第一次使用时轮流分配，之后固定；单例只有一个，thread_local 不会串到别的实例
+    thread_local size_t slot = next_slot_.fetch_add(1, std::memory_order_relaxed);
+    return *pool_[slot % pool_.size()];
+}
 
-    if (reply->type == REDIS_REPLY_NIL) {
+RedisClient::ContextLease::ContextLease(RedisClient& client, bool write) {
+    if (!client.initialized_.load(std::memory_order_acquire)) return;
+    if (write && client.read_only_) return;
+
+    PooledContext& slot = client.LocalContext();
+    lock_ = std::unique_lock<std::mutex>(slot.mutex);
+    // 拿到锁之后再确认一次：Close 可能已经断开了全部连接
+    if (!client.initialized_.load(std::memory_order_acquire)) return;
+
+    // 出过错的连接（hiredis 置了 err）不能继续使用，丢掉重连
+    if (slot.context && slot.context->err) slot.context.reset();
+    if (!slot.context) slot.context.reset(client.Connect());
+    context_ = slot.context.get();
+}
+
+bool RedisClient::CollectTransaction(redisContext* context, size_t queued) {
+    bool ok = true;
+    // MULTI 的 OK 和每条命令的 QUEUED；出错时也要读完，连接上不能留下未读的回复
+    for (size_t i = 0; i < queued + 1; ++i) {
+        redisReply* reply = nullptr;
+        if (redisGetReply(context, reinterpret_cast<void**>(&reply)) != REDIS_OK || !reply) return false;
+        if (reply->type == REDIS_REPLY_ERROR) ok = false;
         freeReplyObject(reply);
-        return false;
     }
 
-    if (value) *value = std::string(reply->str, reply->len);
+    redisReply* reply = nullptr;
+    if (redisGetReply(context, reinterpret_cast<void**>(&reply)) != REDIS_OK || !reply) return false;
+    if (!CheckReply(reply)) return false;
+
+    // Check if all operations succeeded
+    if (reply->type == REDIS_REPLY_ARRAY) {
+        for (size_t i = 0; i < reply->elements; i++) {
+            if (reply->element[i]->type == REDIS_REPLY_ERROR) ok = false;
+        }
+    }
+    else {
+        ok = false;  // 事务被放弃（nil）
+    }
+    freeReplyObject(reply);
+    return ok;
+}
+
+bool RedisClient::Get(const std::string& key, std::string* value) {
+    bool found = false;
+    return Lookup(key, value, &found) && found;
+}
+
+bool RedisClient::Lookup(const std::string& key, std::string* value, bool* found) {
+    *found = false;
+    ContextLease context(*this, false);
+    if (!context) return false;
+
+    redisReply* reply = ExecuteCommand(context.get(), "GET %b", key.data(), key.size());
+    if (!CheckReply(reply)) return false;
+
+    if (reply->type == REDIS_REPLY_STRING) {
+        *found = true;
+        if (value) *value = std::string(reply->str, reply->len);
+    }
     freeReplyObject(reply);
     return true;
 }
@@ -100,14 +196,14 @@ bool RedisClient::Exists(const std::string& key) {
 }
 
 std::vector<std::string> RedisClient::GetKeys(const std::string& prefix, size_t max_keys) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    ContextLease context(*this, false);
 
-    if (!initialized_) {
+    if (!context) {
         return {};
     }
 
     std::vector<std::string> keys;
-    std::string pattern = prefix.empty() ? "*" : prefix + "*";
+    std::string pattern = ScanPattern(prefix);
 
     // Limit pattern length to prevent stack overflow
     if (pattern.size() > 1000) {
@@ -119,7 +215,7 @@ std::vector<std::string> RedisClient::GetKeys(const std::string& prefix, size_t
     size_t total_keys = 0;
 
     do {
-        redisReply* reply = ExecuteCommand(context_.get(), "SCAN %lld MATCH %s COUNT 100", cursor, pattern.c_str());
+        redisReply* reply = ExecuteCommand(context.get(), "SCAN %lld MATCH %s COUNT 100", cursor, pattern.c_str());
         if (!CheckReply(reply)) {
             freeReplyObject(reply);
             return {};
@@ -158,9 +254,9 @@ std::vector<std::string> RedisClient::GetKeys(const std::string& prefix, size_t
 }
 
 bool RedisClient::Put(const std::string& key, const std::string& value) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!initialized_ || read_only_) return false;
-    redisReply* reply = ExecuteCommand(context_.get(), "SET %b %b", key.data(), key.size(), value.data(), value.size());
+    ContextLease context(*this, true);
+    if (!context) return false;
+    redisReply* reply = ExecuteCommand(context.get(), "SET %b %b", key.data(), key.size(), value.data(), value.size());
     bool success = CheckReply(reply);
     freeReplyObject(reply);
     return success;
@@ -171,17 +267,13 @@ bool RedisClient::PutSlice(const std::string& key, const std::string& value) {
 }
 
 bool RedisClient::Delete(const std::string& key) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (!initialized_) {
-        return false;
-    }
+    ContextLease context(*this, true);
 
-    if (read_only_) {
+    if (!context) {
         return false;
     }
 
-    redisReply* reply = ExecuteCommand(context_.get(), "DEL %b", key.data(), key.size());
+    redisReply* reply = ExecuteCommand(context.get(), "DEL %b", key.data(), key.size());
     bool success = CheckReply(reply);
     freeReplyObject(reply);
     return success;
@@ -213,65 +305,7 @@ bool RedisClient::PutDouble(const std::string& key, double value) {
 
 bool RedisClient::WriteBatch(const std::vector<std::pair<std::string, std::string>>& puts,
     const std::vector<std::string>& deletes) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (!initialized_) {
-        return false;
-    }
-
-    if (read_only_) {
-        return false;
-    }
-
-    // Use MULTI/EXEC for atomic batch operations
-    redisReply* reply = ExecuteCommand(context_.get(), "MULTI");
-    if (!CheckReply(reply)) {
-        return false;
-    }
-    freeReplyObject(reply);
-
-    // Execute PUT operations
-    for (const auto& kv : puts) {
-        reply = ExecuteCommand(context_.get(), "SET %b %b",
-            kv.first.data(), kv.first.size(),
-            kv.second.data(), kv.second.size());
-        if (!CheckReply(reply)) {
-            freeReplyObject(reply);
-            return false;
-        }
-        freeReplyObject(reply);
-    }
-
-    // Execute DELETE operations
-    for (const auto& key : deletes) {
-        reply = ExecuteCommand(context_.get(), "DEL %b", key.data(), key.size());
-        if (!CheckReply(reply)) {
-            freeReplyObject(reply);
-            return false;
-        }
-        freeReplyObject(reply);
-    }
-
-    // Execute the batch
-    reply = ExecuteCommand(context_.get(), "EXEC");
-    if (!CheckReply(reply)) {
-        freeReplyObject(reply);
-        return false;
-    }
-
-    // Check if all operations succeeded
-    if (reply->type == REDIS_REPLY_ARRAY && reply->elements > 0) {
-        // If any command failed, reply will be an error
-        for (size_t i = 0; i < reply->elements; i++) {
-            if (reply->element[i]->type == REDIS_REPLY_ERROR) {
-                freeReplyObject(reply);
-                return false;
-            }
-        }
-    }
-
-    freeReplyObject(reply);
-    return true;
+    return WriteBatchIncrement({}, puts, deletes);
 }
 
 bool RedisClient::WriteBatchDouble(const std::vector<std::pair<std::string, double>>& puts,
@@ -285,17 +319,13 @@ bool RedisClient::WriteBatchDouble(const std::vector<std::pair<std::string, doub
 }
 
 bool RedisClient::AtomicIncrement(const std::string& key, int64_t delta) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (!initialized_) {
-        return false;
-    }
+    ContextLease context(*this, true);
 
-    if (read_only_) {
+    if (!context) {
         return false;
     }
 
-    redisReply* reply = ExecuteCommand(context_.get(), "INCRBY %b %lld",
+    redisReply* reply = ExecuteCommand(context.get(), "INCRBY %b %lld",
         key.data(), key.size(), delta);
     bool success = CheckReply(reply);
     freeReplyObject(reply);
@@ -325,24 +355,159 @@ bool RedisClient::AtomicGetInt64(const std::string& key, int64_t* value) {
 bool RedisClient::AtomicGetDouble(const std::string& key, double* value) {
     return GetDouble(key, value);
 }
+bool RedisClient::AtomicIncrementDouble(const std::string& key, double delta, double* result) {
+    ContextLease context(*this, true);
 
-bool RedisClient::AtomicSetStringBit(const std::string& key, size_t index, char value) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (!initialized_) {
+    if (!context) {
         return false;
     }
 
-    if (read_only_) {
+    char delta_text[32];
+    std::snprintf(delta_text, sizeof(delta_text), "%.17g", delta);
+    redisReply* reply = ExecuteCommand(context.get(), "INCRBYFLOAT %b %s",
+        key.data(), key.size(), delta_text);
+    if (!CheckReply(reply)) return false;
+
+    bool success = true;
+    if (result) {
+        try {
+            *result = std::stod(std::string(reply->str ? reply->str : "", reply->len));
+        }
+        catch (...) {
+            success = false;
+        }
+    }
+    freeReplyObject(reply);
+    return success;
+}
+
+bool RedisClient::MultiGet(const std::vector<std::string>& keys, std::vector<std::optional<std::string>>* values) {
+    values->clear();
+    if (keys.empty()) return true;
+
+    ContextLease context(*this, false);
+    if (!context) return false;
+
+    std::vector<const char*> argv{ "MGET" };
+    std::vector<size_t> lengths{ 4 };
+    argv.reserve(keys.size() + 1);
+    lengths.reserve(keys.size() + 1);
+    for (const std::string& key : keys) {
+        argv.push_back(key.data());
+        lengths.push_back(key.size());
+    }
+    redisReply* reply = static_cast<redisReply*>(redisCommandArgv(context.get(),
+        static_cast<int>(argv.size()), argv.data(), lengths.data()));
+    if (!CheckReply(reply)) return false;
+
+    bool success = reply->type == REDIS_REPLY_ARRAY && reply->elements == keys.size();
+    if (success) {
+        values->reserve(keys.size());
+        for (size_t i = 0; i < reply->elements; ++i) {
+            redisReply* element = reply->element[i];
+            if (element->type == REDIS_REPLY_STRING) values->emplace_back(std::string(element->str, element->len));
+            else values->emplace_back(std::nullopt);
+        }
+    }
+    freeReplyObject(reply);
+    return success;
+}
+
+bool RedisClient::DeleteKeys(const std::string& prefix) {
+    ContextLease context(*this, true);
+
+    if (!context) {
         return false;
     }
 
+    std::string pattern = ScanPattern(prefix);
+    std::string cursor = "0";
+    do {
+        redisReply* reply = ExecuteCommand(context.get(), "SCAN %s MATCH %b COUNT 500",
+            cursor.c_str(), pattern.data(), pattern.size());
+        if (!CheckReply(reply)) return false;
+        if (reply->type != REDIS_REPLY_ARRAY || reply->elements < 2
+            || reply->element[0]->type != REDIS_REPLY_STRING || reply->element[1]->type != REDIS_REPLY_ARRAY) {
+            freeReplyObject(reply);
+            return false;
+        }
+        cursor.assign(reply->element[0]->str, reply->element[0]->len);
+
+        // 一页一条 UNLINK，大 value 的释放在服务端后台进行
+        redisReply* keys_reply = reply->element[1];
+        if (keys_reply->elements > 0) {
+            std::vector<const char*> argv{ "UNLINK" };
+            std::vector<size_t> lengths{ 6 };
+            for (size_t i = 0; i < keys_reply->elements; ++i) {
+                argv.push_back(keys_reply->element[i]->str);
+                lengths.push_back(keys_reply->element[i]->len);
+            }
+            redisReply* unlink_reply = static_cast<redisReply*>(redisCommandArgv(context.get(),
+                static_cast<int>(argv.size()), argv.data(), lengths.data()));
+            if (!CheckReply(unlink_reply)) {
+                freeReplyObject(reply);
+                return false;
+            }
+            freeReplyObject(unlink_reply);
+        }
+        freeReplyObject(reply);
+    } while (cursor != "0");
+
+    return true;
+}
+
+bool RedisClient::SetAdd(const std::string& key, const std::string& member) {
+    ContextLease context(*this, true);
+    if (!context) return false;
+    redisReply* reply = ExecuteCommand(context.get(), "SADD %b %b", key.data(), key.size(), member.data(), member.size());
+    if (!CheckReply(reply)) return false;
+    freeReplyObject(reply);
+    return true;
+}
+
+bool RedisClient::SetRemove(const std::string& key, const std::string& member) {
+    ContextLease context(*this, true);
+    if (!context) return false;
+    redisReply* reply = ExecuteCommand(context.get(), "SREM %b %b", key.data(), key.size(), member.data(), member.size());
+    if (!CheckReply(reply)) return false;
+    freeReplyObject(reply);
+    return true;
+}
+
+bool RedisClient::SetMembers(const std::string& key, std::vector<std::string>* members) {
+    members->clear();
+    ContextLease context(*this, false);
+    if (!context) return false;
+
+    redisReply* reply = ExecuteCommand(context.get(), "SMEMBERS %b", key.data(), key.size());
+    if (!CheckReply(reply)) return false;
+
+    // RESP2 为数组，RESP3 为集合
+    bool success = reply->type == REDIS_REPLY_ARRAY || reply->type == REDIS_REPLY_SET;
+    if (success) {
+        members->reserve(reply->elements);
+        for (size_t i = 0; i < reply->elements; ++i) {
+            redisReply* element = reply->element[i];
+            if (element->type == REDIS_REPLY_STRING) members->emplace_back(element->str, element->len);
+        }
+    }
+    freeReplyObject(reply);
+    return success;
+}
+
+bool RedisClient::AtomicSetStringBit(const std::string& key, size_t index, char value) {
     if (value != '0' && value != '1') {
         return false;
     }
 
+    ContextLease context(*this, true);
+
+    if (!context) {
+        return false;
+    }
+
     int bit_value = (value == '1') ? 1 : 0;
-    redisReply* reply = ExecuteCommand(context_.get(), "SETBIT %b %lld %d",
+    redisReply* reply = ExecuteCommand(context.get(), "SETBIT %b %lld %d",
         key.data(), key.size(), index, bit_value);
     bool success = CheckReply(reply);
     freeReplyObject(reply);
@@ -352,75 +517,42 @@ bool RedisClient::AtomicSetStringBit(const std::string& key, size_t index, char
 bool RedisClient::WriteBatchIncrement(const std::vector<std::pair<std::string, int64_t>>& increments,
     const std::vector<std::pair<std::string, std::string>>& puts,
     const std::vector<std::string>& deletes) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (!initialized_) {
-        return false;
-    }
+    ContextLease context(*this, true);
 
-    if (read_only_) {
+    if (!context) {
         return false;
     }
 
-    // Use MULTI/EXEC for atomic batch operations
-    redisReply* reply = ExecuteCommand(context_.get(), "MULTI");
-    if (!CheckReply(reply)) {
-        return false;
-    }
-    freeReplyObject(reply);
+    // MULTI/EXEC 保证原子性；全部命令先写进 hiredis 的输出缓冲，读第一条回复时一次发出
+    redisContext* ctx = context.get();
+    bool appended = redisAppendCommand(ctx, "MULTI") == REDIS_OK;
 
-    // Execute INCR operations
+    // Queue INCR operations
     for (const auto& inc : increments) {
-        reply = ExecuteCommand(context_.get(), "INCRBY %b %lld",
-            inc.first.data(), inc.first.size(), inc.second);
-        if (!CheckReply(reply)) {
-            freeReplyObject(reply);
-            return false;
-        }
-        freeReplyObject(reply);
+        appended = appended && redisAppendCommand(ctx, "INCRBY %b %lld",
+            inc.first.data(), inc.first.size(), static_cast<long long>(inc.second)) == REDIS_OK;
     }
 
-    // Execute PUT operations
+    // Queue PUT operations
     for (const auto& kv : puts) {
-        reply = ExecuteCommand(context_.get(), "SET %b %b",
+        appended = appended && redisAppendCommand(ctx, "SET %b %b",
             kv.first.data(), kv.first.size(),
-            kv.second.data(), kv.second.size());
-        if (!CheckReply(reply)) {
-            freeReplyObject(reply);
-            return false;
-        }
-        freeReplyObject(reply);
+            kv.second.data(), kv.second.size()) == REDIS_OK;
     }
 
-    // Execute DELETE operations
+    // Queue DELETE operations
     for (const auto& key : deletes) {
-        reply = ExecuteCommand(context_.get(), "DEL %b", key.data(), key.size());
-        if (!CheckReply(reply)) {
-            freeReplyObject(reply);
-            return false;
-        }
-        freeReplyObject(reply);
+        appended = appended && redisAppendCommand(ctx, "DEL %b", key.data(), key.size()) == REDIS_OK;
     }
 
-    // Execute the batch
-    reply = ExecuteCommand(context_.get(), "EXEC");
-    if (!CheckReply(reply)) {
-        freeReplyObject(reply);
+    appended = appended && redisAppendCommand(ctx, "EXEC") == REDIS_OK;
+    if (!appended) {
+        // 只有内存不足时才会失败，输出缓冲里已是半个事务，丢掉这条连接
+        ctx->err = REDIS_ERR_OOM;
         return false;
     }
 
-    // Check if all operations succeeded
-    if (reply->type == REDIS_REPLY_ARRAY && reply->elements > 0) {
-        for (size_t i = 0; i < reply->elements; i++) {
-            if (reply->element[i]->type == REDIS_REPLY_ERROR) {
-                freeReplyObject(reply);
-                return false;
-            }
-        }
-    }
-
-    freeReplyObject(reply);
-    return true;
+    return CollectTransaction(ctx, increments.size() + puts.size() + deletes.size());
 }
 
 void RedisClient::SetMergeOperatorForPrefix(const std::string& prefix, const std::string& type, size_t param) {
@@ -431,17 +563,13 @@ void RedisClient::SetMergeOperatorForPrefix(const std::string& prefix, const std
 // Pub/Sub Implementation
 
 bool RedisClient::Publish(const std::string& channel, const std::string& message) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (!initialized_) {
-        return false;
-    }
+    ContextLease context(*this, true);
 
-    if (read_only_) {
+    if (!context) {
         return false;
     }
 
-    redisReply* reply = ExecuteCommand(context_.get(), "PUBLISH %b %b",
+    redisReply* reply = ExecuteCommand(context.get(), "PUBLISH %b %b",
         channel.data(), channel.size(),
         message.data(), message.size());
     bool success = CheckReply(reply);
@@ -449,6 +577,27 @@ bool RedisClient::Publish(const std::string& channel, const std::string& message
     return success;
 }
 
+// === 订阅 ===
+
+namespace {
+
+// 读线程等待 socket 的最长时间，也是发现订阅变化 / 停止的最大延迟
+constexpr auto kSubscriberPollInterval = std::chrono::milliseconds(100);
+
+int AppendCommandArgv(redisContext* context, const std::vector<std::string>& args) {
+    std::vector<const char*> argv;
+    std::vector<size_t> lengths;
+    argv.reserve(args.size());
+    lengths.reserve(args.size());
+    for (const std::string& arg : args) {
+        argv.push_back(arg.data());
+        lengths.push_back(arg.size());
+    }
+    return redisAppendCommandArgv(context, static_cast<int>(argv.size()), argv.data(), lengths.data());
+}
+
+} // namespace
+
 bool RedisClient::Subscribe(const std::string& channel, SubscribeCallback callback) {
     if (!initialized_) {
         return false;
@@ -505,145 +654,761 @@ std::vector<std::string> RedisClient::GetSubscribedChannels() const {
     return channels;
 }
 
+void RedisClient::ConfigureSubscriber(const SubscriberOptions& options) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!subscriber_workers_.empty()) return;
+    subscriber_options_ = options;
+    if (subscriber_options_.workers == 0) subscriber_options_.workers = 1;
+    if (subscriber_options_.queue_capacity == 0) subscriber_options_.queue_capacity = 1;
+    if (subscriber_options_.backoff_initial.count() <= 0) subscriber_options_.backoff_initial = std::chrono::milliseconds(1);
+    if (subscriber_options_.backoff_max < subscriber_options_.backoff_initial) {
+        subscriber_options_.backoff_max = subscriber_options_.backoff_initial;
+    }
+}
+
+void RedisClient::SetSubscriptionGapCallback(SubscriptionGapCallback callback) {
+    std::lock_guard<std::mutex> lock(subscription_mutex_);
+    gap_callback_ = std::move(callback);
+}
+
 void RedisClient::StartSubscriberThread() {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (!subscriber_thread_running_) {
-        subscriber_thread_running_ = true;
-        subscriber_thread_ = std::make_unique<std::thread>(&RedisClient::SubscriberLoop, this);
+    if (subscriber_thread_running_) return;
+    EnsureSubscriberWorkers();
+
+    // 上一个读线程已 detach，但可能还在最后一次轮询里；等它退出，避免两个线程同时读写 gap_channels_
+    auto deadline = std::chrono::steady_clock::now() + kSubscriberPollInterval * 5;
+    while (subscriber_loop_active_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
+    if (subscriber_thread_ && subscriber_thread_->joinable()) subscriber_thread_->detach();
+
+    subscriber_thread_running_ = true;
+    subscriber_loop_active_ = true;
+    subscriber_thread_ = std::make_unique<std::thread>(&RedisClient::SubscriberLoop, this);
 }
 
-void RedisClient::StopSubscriberThread() {
+void RedisClient::StopSubscriberThread(std::chrono::milliseconds grace) {
     {
         std::lock_guard<std::mutex> lock(subscription_mutex_);
         subscriber_thread_running_ = false;
-        subscription_changed_ = true;
     }
     subscription_cv_.notify_all();
 
-    if (subscriber_thread_ && subscriber_thread_->joinable()) {
-        subscriber_thread_->join();
-        subscriber_thread_.reset();
+    // 可能处于 DllMain 中，不能 join
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (subscriber_loop_active_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (subscriber_thread_ && subscriber_thread_->joinable()) subscriber_thread_->detach();
+    subscriber_thread_.reset();
+}
+
+void RedisClient::WaitSubscriber(std::chrono::milliseconds timeout, bool wake_on_change) {
+    std::unique_lock<std::mutex> lock(subscription_mutex_);
+    subscription_cv_.wait_for(lock, timeout, [this, wake_on_change]() {
+        return !subscriber_thread_running_ || (wake_on_change && subscription_changed_);
+        });
 }
 
 void RedisClient::SubscriberLoop() {
-    // 获取主连接的地址信息（这里简化为硬编码，实际可从配置获取）
-    redisContext* sub_context = redisConnect("127.0.0.1", 6379);
-    if (!sub_context || sub_context->err) {
-        if (sub_context) {
-            std::cerr << "Subscriber connection error: " << sub_context->errstr << std::endl;
-            redisFree(sub_context);
+    // 订阅连接与命令连接使用同一个地址（Initialize 已解析）
+    auto backoff = subscriber_options_.backoff_initial;
+    bool had_session = false;
+
+    while (subscriber_thread_running_) {
+        struct timeval connect_timeout = { 2, 0 };
+        redisContext* sub_context = redisConnectWithTimeout(host_.c_str(), port_, connect_timeout);
+        if (sub_context && !sub_context->err) {
+            // 对端掉线（没有 FIN）时靠 keepalive 发现，否则读线程会一直等下去
+            redisEnableKeepAlive(sub_context);
+            if (RunSubscriberSession(sub_context, had_session)) {
+                had_session = true;
+                backoff = subscriber_options_.backoff_initial;
+            }
+            subscriber_connected_ = false;
         }
-        return;
+        if (sub_context) redisFree(sub_context);
+
+        if (!subscriber_thread_running_) break;
+        WaitSubscriber(backoff, false);
+        backoff = (std::min)(backoff * 2, subscriber_options_.backoff_max);
     }
 
+    subscriber_loop_active_.store(false, std::memory_order_release);
+}
+
+bool RedisClient::RunSubscriberSession(redisContext* context, bool resubscribe) {
     std::unordered_set<std::string> current_channels;
+    bool subscribed = false;
+    subscription_changed_ = true;   // 新连接上从零开始订阅
 
     while (subscriber_thread_running_) {
-        // 同步当前订阅列表
-        std::unordered_set<std::string> target_channels;
-        {
-            std::lock_guard<std::mutex> lock(subscription_mutex_);
-            for (const auto& pair : subscriptions_) {
-                target_channels.insert(pair.first);
+        if (subscription_changed_.exchange(false, std::memory_order_acq_rel)) {
+            if (!SyncSubscriptions(context, &current_channels)) return subscribed;
+            if (!subscribed && !current_channels.empty()) {
+                subscribed = true;
+                subscriber_connected_ = true;
+                if (resubscribe) {
+                    // 断线期间发布的消息已经丢了
+                    subscriber_reconnects_.fetch_add(1, std::memory_order_relaxed);
+                    gap_channels_.insert(current_channels.begin(), current_channels.end());
+                }
             }
         }
+        FlushSubscriptionGaps();
+
+        // 如果没有任何订阅，等订阅变化
+        if (current_channels.empty()) {
+            WaitSubscriber(kSubscriberPollInterval, true);
+            continue;
+        }
+
+        redisReply* reply = nullptr;
+        if (!ReadSubscriberReply(context, &reply)) return subscribed;
+        if (!reply) continue;
+
+        ProcessSubscriptionMessage(reply);
+        freeReplyObject(reply);
+    }
+    return subscribed;
+}
+
+bool RedisClient::SyncSubscriptions(redisContext* context, std::unordered_set<std::string>* current) {
+    std::unordered_set<std::string> target;
+    {
+        std::lock_guard<std::mutex> lock(subscription_mutex_);
+        for (const auto& pair : subscriptions_) {
+            target.insert(pair.first);
+        }
+    }
+
+    std::vector<std::string> subscribe_args{ "SUBSCRIBE" };
+    std::vector<std::string> unsubscribe_args{ "UNSUBSCRIBE" };
+    for (const auto& ch : target) {
+        if (current->find(ch) == current->end()) subscribe_args.push_back(ch);
+    }
+    for (const auto& ch : *current) {
+        if (target.find(ch) == target.end()) unsubscribe_args.push_back(ch);
+    }
+
+    if (subscribe_args.size() > 1 && AppendCommandArgv(context, subscribe_args) != REDIS_OK) return false;
+    if (unsubscribe_args.size() > 1 && AppendCommandArgv(context, unsubscribe_args) != REDIS_OK) return false;
+
+    int done = 0;
+    do {
+        if (redisBufferWrite(context, &done) != REDIS_OK) return false;
+    } while (!done);
+
+    *current = std::move(target);
+    return true;
+}
 
-        // 订阅新增频道
-        for (const auto& ch : target_channels) {
-            if (current_channels.find(ch) == current_channels.end()) {
-                redisReply* r = static_cast<redisReply*>(redisCommand(sub_context, "SUBSCRIBE %s", ch.c_str()));
-                if (r) {
-                    std::cout << "[Subscriber] Subscribed to: " << ch << std::endl;
-                    freeReplyObject(r);
+bool RedisClient::ReadSubscriberReply(redisContext* context, redisReply** reply) {
+    void* parsed = nullptr;
+    // 上次读到的数据里可能已经有完整的回复
+    if (redisGetReplyFromReader(context, &parsed) != REDIS_OK) return false;
+
+    if (!parsed) {
+        // 不用 hiredis 的读超时：超时后 context 置错，只能断开重连
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(context->fd, &readable);
+        struct timeval timeout = { 0, static_cast<long>(
+            std::chrono::duration_cast<std::chrono::microseconds>(kSubscriberPollInterval).count()) };
+        int ready = select(static_cast<int>(context->fd + 1), &readable, nullptr, nullptr, &timeout);
+        if (ready < 0) return false;
+        if (ready == 0) return true;
+
+        if (redisBufferRead(context) != REDIS_OK) return false;
+        if (redisGetReplyFromReader(context, &parsed) != REDIS_OK) return false;
+    }
+
+    *reply = static_cast<redisReply*>(parsed);
+    return true;
+}
+
+void RedisClient::ProcessSubscriptionMessage(redisReply* reply) {
+    if (!reply || reply->type != REDIS_REPLY_ARRAY || reply->elements < 3) {
+        return;
+    }
+
+    // 订阅 / 退订确认与消息在同一条流里，只处理消息
+    redisReply* type = reply->element[0];
+    if (type->type != REDIS_REPLY_STRING || std::string_view(type->str, type->len) != "message") {
+        return;
+    }
+    subscriber_received_.fetch_add(1, std::memory_order_relaxed);
+
+    SubscriberMessage message;
+    message.channel.assign(reply->element[1]->str, reply->element[1]->len);
+    message.message.assign(reply->element[2]->str, reply->element[2]->len);
+    message.received = std::chrono::steady_clock::now();
+
+    std::string channel = message.channel;
+    if (!DispatchSubscription(std::move(message), false)) {
+        gap_channels_.insert(std::move(channel));
+    }
+}
+
+// === 订阅回调线程 ===
+
+void RedisClient::EnsureSubscriberWorkers() {
+    std::call_once(subscriber_workers_flag_, [this]() {
+        subscriber_workers_.reserve(subscriber_options_.workers);
+        for (size_t i = 0; i < subscriber_options_.workers; ++i) {
+            subscriber_workers_.push_back(std::make_unique<SubscriberWorker>());
+        }
+        subscriber_workers_running_ = subscriber_options_.workers;
+        for (auto& worker : subscriber_workers_) {
+            worker->thread = std::thread(&RedisClient::SubscriberWorkerLoop, this, worker.get());
+        }
+        });
+}
+
+bool RedisClient::DispatchSubscription(SubscriberMessage message, bool force) {
+    if (subscriber_workers_.empty() || subscriber_workers_stopping_.load(std::memory_order_acquire)) {
+        subscriber_dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // 先占位再入队；排队满时丢弃而不是阻塞读线程，否则积压会转移到 Redis 的输出缓冲，最终被服务端断开
+    size_t depth = subscriber_depth_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (!force && depth > subscriber_options_.queue_capacity) {
+        subscriber_depth_.fetch_sub(1, std::memory_order_acq_rel);
+        subscriber_dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    size_t peak = subscriber_peak_depth_.load(std::memory_order_relaxed);
+    while (depth > peak && !subscriber_peak_depth_.compare_exchange_weak(peak, depth, std::memory_order_relaxed)) {}
+
+    // 同一频道固定在同一个线程上，保持顺序
+    SubscriberWorker* worker = subscriber_workers_[std::hash<std::string>{}(message.channel) % subscriber_workers_.size()].get();
+    worker->queue.Push(std::move(message));
+    worker->signal.release();
+    return true;
+}
+
+void RedisClient::FlushSubscriptionGaps() {
+    for (auto it = gap_channels_.begin(); it != gap_channels_.end();) {
+        if (subscriber_depth_.load(std::memory_order_acquire) >= subscriber_options_.queue_capacity) break;
+
+        SubscriberMessage gap;
+        gap.channel = *it;
+        gap.received = std::chrono::steady_clock::now();
+        gap.gap = true;
+        DispatchSubscription(std::move(gap), true);
+        it = gap_channels_.erase(it);
+    }
+}
+
+void RedisClient::SubscriberWorkerLoop(SubscriberWorker* worker) {
+    LatencyMetrics& metrics = LatencyMetrics::GetInstance();
+
+    while (true) {
+        worker->signal.acquire();
+
+        SubscriberMessage message;
+        bool got = worker->queue.Pop(message);
+        while (!got && !subscriber_workers_stopping_.load(std::memory_order_acquire)) {
+            // 生产者已计数但还没链接完节点，稍等即可
+            std::this_thread::yield();
+            got = worker->queue.Pop(message);
+        }
+        if (!got) break;
+
+        auto start = std::chrono::steady_clock::now();
+        try {
+            if (message.gap) {
+                SubscriptionGapCallback callback;
+                {
+                    std::lock_guard<std::mutex> lock(subscription_mutex_);
+                    callback = gap_callback_;
                 }
-                current_channels.insert(ch);
+                if (callback) callback(message.channel);
             }
+            else {
+                uint64_t lag_us = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(start - message.received).count());
+                subscriber_last_lag_us_.store(lag_us, std::memory_order_relaxed);
+                uint64_t max_lag = subscriber_max_lag_us_.load(std::memory_order_relaxed);
+                while (lag_us > max_lag && !subscriber_max_lag_us_.compare_exchange_weak(max_lag, lag_us, std::memory_order_relaxed)) {}
+
+                SubscribeCallback callback;
+                {
+                    std::lock_guard<std::mutex> lock(subscription_mutex_);
+                    auto it = subscriptions_.find(message.channel);
+                    if (it != subscriptions_.end()) {
+                        callback = it->second;
+                    }
+                }
+                if (callback) callback(message.channel, message.message);
+                subscriber_dispatched_.fetch_add(1, std::memory_order_relaxed);
+
+                // 排队延迟记在 Queue 阶段，回调耗时记在 Callback 阶段，key 为 "redis:<频道>"
+                int key_id = metrics.Enabled() ? metrics.KeyId("redis:" + message.channel) : -1;
+                if (key_id >= 0) {
+                    metrics.RecordMicros(key_id, LatencyStage::Queue, static_cast<int64_t>(lag_us));
+                    metrics.Record(key_id, LatencyStage::Callback, std::chrono::steady_clock::now() - start);
+                }
+            }
+        }
+        catch (...) {
+            // 回调异常不能杀掉回调线程
         }
+        subscriber_depth_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    subscriber_workers_running_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool RedisClient::DrainSubscriber(std::chrono::milliseconds timeout) {
+    StopSubscriberThread(kSubscriberPollInterval * 2);
+    if (subscriber_workers_.empty()) return true;
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (subscriber_depth_.load(std::memory_order_acquire) > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    bool drained = subscriber_depth_.load(std::memory_order_acquire) == 0;
+
+    StopSubscriberWorkers(std::chrono::milliseconds(200));
+    return drained;
+}
 
-        // 退订已删除频道
-        std::vector<std::string> to_unsub;
-        for (const auto& ch : current_channels) {
-            if (target_channels.find(ch) == target_channels.end()) {
-                to_unsub.push_back(ch);
+void RedisClient::StopSubscriberWorkers(std::chrono::milliseconds grace) {
+    if (subscriber_workers_.empty()) return;
+    if (subscriber_workers_stopping_.exchange(true, std::memory_order_acq_rel)) return;
+
+    for (auto& worker : subscriber_workers_) {
+        worker->signal.release();
+    }
+
+    // 可能处于 DllMain 中，不能 join
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (subscriber_workers_running_.load(std::memory_order_acquire) > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (auto& worker : subscriber_workers_) {
+        if (worker->thread.joinable()) worker->thread.detach();
+    }
+}
+
+RedisClient::SubscriberStats RedisClient::GetSubscriberStats() const {
+    SubscriberStats stats;
+    stats.connected = subscriber_connected_.load(std::memory_order_relaxed);
+    stats.reconnects = subscriber_reconnects_.load(std::memory_order_relaxed);
+    stats.received = subscriber_received_.load(std::memory_order_relaxed);
+    stats.dispatched = subscriber_dispatched_.load(std::memory_order_relaxed);
+    stats.dropped = subscriber_dropped_.load(std::memory_order_relaxed);
+    stats.depth = subscriber_depth_.load(std::memory_order_relaxed);
+    stats.peak_depth = subscriber_peak_depth_.load(std::memory_order_relaxed);
+    stats.last_lag_us = subscriber_last_lag_us_.load(std::memory_order_relaxed);
+    stats.max_lag_us = subscriber_max_lag_us_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// === Streams 消费组 ===
+
+namespace {
+
+// 与 redisCommandArgv 相同：追加一条命令并读回它的回复
+redisReply* CommandArgv(redisContext* context, const std::vector<std::string>& args) {
+    if (AppendCommandArgv(context, args) != REDIS_OK) return nullptr;
+    void* reply = nullptr;
+    if (redisGetReply(context, &reply) != REDIS_OK) return nullptr;
+    return static_cast<redisReply*>(reply);
+}
+
+std::string_view ReplyString(const redisReply* reply) {
+    if (!reply || reply->type != REDIS_REPLY_STRING) return std::string_view();
+    return std::string_view(reply->str, reply->len);
+}
+
+const std::string kStreamNewEntries = ">";
+
+} // namespace
+
+bool RedisClient::ConsumeStream(const std::string& stream, const StreamConsumerOptions& options, StreamBatchCallback callback) {
+    if (!initialized_ || stream.empty() || !callback) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(stream_mutex_);
+    if (!streams_running_) return false;
+    for (const auto& existing : stream_consumers_) {
+        if (existing->stream == stream) return false;
+    }
+
+    auto consumer = std::make_unique<StreamConsumer>();
+    consumer->stream = stream;
+    consumer->options = options;
+    StreamConsumerOptions& opts = consumer->options;
+    if (opts.count == 0) opts.count = 1;
+    // BLOCK 0 表示一直等，读线程就无法退出
+    if (opts.block.count() <= 0) opts.block = std::chrono::milliseconds(1);
+    if (opts.backoff_initial.count() <= 0) opts.backoff_initial = std::chrono::milliseconds(1);
+    if (opts.backoff_max < opts.backoff_initial) opts.backoff_max = opts.backoff_initial;
+    consumer->callback = std::move(callback);
+
+    consumer->thread = std::thread(&RedisClient::StreamLoop, this, consumer.get());
+    stream_consumers_.push_back(std::move(consumer));
+    return true;
+}
+
+void RedisClient::WaitStream(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(stream_mutex_);
+    stream_cv_.wait_for(lock, timeout, [this]() { return !streams_running_; });
+}
+
+void RedisClient::StreamLoop(StreamConsumer* consumer) {
+    const StreamConsumerOptions& options = consumer->options;
+    auto backoff = options.backoff_initial;
+    bool had_session = false;
+
+    while (streams_running_) {
+        struct timeval connect_timeout = { 2, 0 };
+        redisContext* context = redisConnectWithTimeout(host_.c_str(), port_, connect_timeout);
+        if (context && !context->err) {
+            // BLOCK 期间服务端不回包，读超时要比它长；超时后 context 置错，按断线处理
+            long long timeout_ms = options.block.count() + 5000;
+            struct timeval read_timeout = { static_cast<long>(timeout_ms / 1000), static_cast<long>(timeout_ms % 1000 * 1000) };
+            redisSetTimeout(context, read_timeout);
+            redisEnableKeepAlive(context);
+
+            stream_connected_.fetch_add(1, std::memory_order_relaxed);
+            if (RunStreamSession(context, consumer, had_session)) {
+                had_session = true;
+                backoff = options.backoff_initial;
             }
+            stream_connected_.fetch_sub(1, std::memory_order_relaxed);
         }
-        for (const auto& ch : to_unsub) {
-            redisReply* r = static_cast<redisReply*>(redisCommand(sub_context, "UNSUBSCRIBE %s", ch.c_str()));
-            if (r) {
-                std::cout << "[Subscriber] Unsubscribed from: " << ch << std::endl;
-                freeReplyObject(r);
+        if (context) redisFree(context);
+
+        if (!streams_running_) break;
+        WaitStream(backoff);
+        backoff = (std::min)(backoff * 2, options.backoff_max);
+    }
+
+    consumer->active.store(false, std::memory_order_release);
+}
+
+bool RedisClient::CreateStreamGroup(redisContext* context, StreamConsumer* consumer) {
+    // 组已存在时返回 BUSYGROUP 错误，忽略即可
+    redisReply* reply = CommandArgv(context, { "XGROUP", "CREATE", consumer->stream, consumer->options.group, "$", "MKSTREAM" });
+    if (!reply) return false;
+    freeReplyObject(reply);
+    return true;
+}
+
+bool RedisClient::RunStreamSession(redisContext* context, StreamConsumer* consumer, bool reconnect) {
+    const StreamConsumerOptions& options = consumer->options;
+
+    if (!CreateStreamGroup(context, consumer)) return false;
+    if (reconnect) stream_reconnects_.fetch_add(1, std::memory_order_relaxed);
+
+    // 先重放本消费者上次没确认的条目（上次进程退出前收到、未处理完的），重放完再读新条目
+    std::string replay_from = "0";
+    auto failure_backoff = options.backoff_initial;
+    bool read_any = false;
+    bool regrouped = false;
+
+    while (streams_running_) {
+        std::string last_id;
+        bool rejected = false;
+        bool no_group = false;
+        const std::string& start_id = replay_from.empty() ? kStreamNewEntries : replay_from;
+        if (!ReadStreamBatch(context, consumer, start_id, &last_id, &rejected, &no_group)) {
+            // 组被删掉（或流被删后重建）时就地重建一次再读，新组没有待确认条目，重放读到空批后转为读新条目
+            if (no_group && !regrouped && CreateStreamGroup(context, consumer)) {
+                regrouped = true;
+                replay_from = "0";
+                continue;
             }
-            current_channels.erase(ch);
+            // 还没读成功过就出错返回 false，StreamLoop 的重连退避继续增长，不会按初始间隔反复重连
+            return read_any;
         }
-
-        // 如果没有任何订阅，短暂休眠后重试
-        if (current_channels.empty()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        read_any = true;
+        regrouped = false;
+
+        if (rejected) {
+            // 整批留在待确认列表里，退避后从头重放
+            stream_failed_batches_.fetch_add(1, std::memory_order_relaxed);
+            replay_from = "0";
+            WaitStream(failure_backoff);
+            failure_backoff = (std::min)(failure_backoff * 2, options.backoff_max);
             continue;
         }
+        failure_backoff = options.backoff_initial;
+        // 重放读到空批说明未确认的已处理完，replay_from 变空，转为读新条目
+        if (!replay_from.empty()) replay_from = last_id;
+    }
+    return true;
+}
 
-        // 👇 关键：阻塞读取下一条消息（不设超时！）
-        redisReply* reply = nullptr;
-        int result = redisGetReply(sub_context, (void**)&reply);
+bool RedisClient::ReadStreamBatch(redisContext* context, StreamConsumer* consumer, const std::string& start_id,
+    std::string* last_id, bool* rejected, bool* no_group) {
+    const StreamConsumerOptions& options = consumer->options;
+    bool replay = start_id != kStreamNewEntries;
+
+    std::vector<std::string> args{ "XREADGROUP", "GROUP", options.group, options.consumer,
+        "COUNT", std::to_string(options.count) };
+    if (!replay) {
+        args.push_back("BLOCK");
+        args.push_back(std::to_string(options.block.count()));
+    }
+    args.push_back("STREAMS");
+    args.push_back(consumer->stream);
+    args.push_back(start_id);
+
+    std::unique_ptr<redisReply, decltype(&freeReplyObject)> reply(CommandArgv(context, args), freeReplyObject);
+    if (!reply) return false;
+    if (reply->type == REDIS_REPLY_NIL) return true;     // BLOCK 超时，没有新条目
+    if (reply->type != REDIS_REPLY_ARRAY) {
+        *no_group = reply->type == REDIS_REPLY_ERROR && std::string_view(reply->str, reply->len).starts_with("NOGROUP");
+        return false;
+    }
 
-        if (result != REDIS_OK || !reply) {
-            // 连接出错，退出
-            if (reply) freeReplyObject(reply);
-            break;
+    // [[stream, [[id, [field, value, ...]], ...]]]
+    std::vector<StreamEntry> entries;
+    std::vector<std::string> ack{ "XACK", consumer->stream, options.group };
+    for (size_t s = 0; s < reply->elements; ++s) {
+        redisReply* stream_reply = reply->element[s];
+        if (stream_reply->type != REDIS_REPLY_ARRAY || stream_reply->elements < 2) continue;
+        redisReply* items = stream_reply->element[1];
+        if (items->type != REDIS_REPLY_ARRAY) continue;
+
+        entries.reserve(entries.size() + items->elements);
+        for (size_t i = 0; i < items->elements; ++i) {
+            redisReply* item = items->element[i];
+            if (item->type != REDIS_REPLY_ARRAY || item->elements < 1) continue;
+            std::string_view id = ReplyString(item->element[0]);
+            if (id.empty()) continue;
+            ack.emplace_back(id);
+            last_id->assign(id);
+
+            // 已被 XDEL / 裁剪的条目重放时字段为 nil，只确认
+            if (item->elements < 2 || item->element[1]->type != REDIS_REPLY_ARRAY) continue;
+            redisReply* fields = item->element[1];
+            StreamEntry entry;
+            entry.id.assign(id);
+            for (size_t f = 0; f + 1 < fields->elements; f += 2) {
+                std::string_view name = ReplyString(fields->element[f]);
+                std::string_view value = ReplyString(fields->element[f + 1]);
+                if (name == "payload") entry.payload.assign(value);
+                else if (name == "type") entry.type.assign(value);
+            }
+            entries.push_back(std::move(entry));
+        }
+    }
+    reply.reset();
+
+    size_t read = ack.size() - 3;
+    if (read == 0) return true;
+    stream_reads_.fetch_add(1, std::memory_order_relaxed);
+    stream_entries_.fetch_add(read, std::memory_order_relaxed);
+    if (replay) stream_replayed_.fetch_add(read, std::memory_order_relaxed);
+
+    if (!entries.empty()) {
+        bool accepted = false;
+        try {
+            accepted = consumer->callback(consumer->stream, entries);
+        }
+        catch (...) {
+            accepted = false;
         }
+        if (!accepted) {
+            *rejected = true;
+            return true;
+        }
+    }
 
-        // 处理消息
-        ProcessSubscriptionMessage(reply);
-        freeReplyObject(reply);
+    // 整批一条 XACK
+    redisReply* ack_reply = CommandArgv(context, ack);
+    if (!CheckReply(ack_reply)) return false;
+    if (ack_reply->type == REDIS_REPLY_INTEGER) {
+        stream_acked_.fetch_add(static_cast<uint64_t>(ack_reply->integer), std::memory_order_relaxed);
     }
+    freeReplyObject(ack_reply);
+    return true;
+}
 
-    // 清理：退订所有频道
-    for (const auto& ch : current_channels) {
-        redisCommand(sub_context, "UNSUBSCRIBE %s", ch.c_str());
+void RedisClient::StopStreams(std::chrono::milliseconds grace) {
+    {
+        std::lock_guard<std::mutex> lock(stream_mutex_);
+        streams_running_ = false;
     }
+    stream_cv_.notify_all();
+
+    // 读线程可能正阻塞在 XREADGROUP BLOCK 里，最多等 grace；可能处于 DllMain 中，不能 join
+    // streams_running_ 已置 false，列表不会再变，等待时不持锁（读线程退出前要拿锁）
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    for (auto& consumer : stream_consumers_) {
+        while (consumer->active.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (consumer->thread.joinable()) consumer->thread.detach();
+    }
+}
 
-    redisFree(sub_context);
+RedisClient::StreamStats RedisClient::GetStreamStats() const {
+    StreamStats stats;
+    stats.connected = stream_connected_.load(std::memory_order_relaxed) > 0;
+    stats.reconnects = stream_reconnects_.load(std::memory_order_relaxed);
+    stats.reads = stream_reads_.load(std::memory_order_relaxed);
+    stats.entries = stream_entries_.load(std::memory_order_relaxed);
+    stats.replayed = stream_replayed_.load(std::memory_order_relaxed);
+    stats.acked = stream_acked_.load(std::memory_order_relaxed);
+    stats.failed_batches = stream_failed_batches_.load(std::memory_order_relaxed);
+    return stats;
 }
-void RedisClient::ProcessSubscriptionMessage(redisReply* reply) {
-    if (!reply || reply->type != REDIS_REPLY_ARRAY || reply->elements < 3) {
-        return;
+
+// === 客户端缓存失效 ===
+
+namespace {
+
+constexpr auto kTrackingBackoffInitial = std::chrono::milliseconds(100);
+constexpr auto kTrackingBackoffMax = std::chrono::milliseconds(5000);
+
+} // namespace
+
+bool RedisClient::StartTracking(const std::vector<std::string>& prefixes, InvalidationCallback callback) {
+    if (!initialized_ || !callback) {
+        return false;
     }
 
-    if (reply->element[0]->type == REDIS_REPLY_STRING) {
-        std::string type(reply->element[0]->str, reply->element[0]->len);
-        if (type == "message" && reply->elements >= 3) {
-            std::string channel(reply->element[1]->str, reply->element[1]->len);
-            std::string message(reply->element[2]->str, reply->element[2]->len);
+    std::lock_guard<std::mutex> lock(tracking_mutex_);
+    if (tracking_started_) return false;
+    tracking_started_ = true;
+    tracking_prefixes_ = prefixes;
+    tracking_callback_ = std::move(callback);
+    tracking_running_ = true;
+    tracking_loop_active_ = true;
+    tracking_thread_ = std::thread(&RedisClient::TrackingLoop, this);
+    return true;
+}
 
-            SubscribeCallback callback;
-            {
-                std::lock_guard<std::mutex> lock(subscription_mutex_);
-                auto it = subscriptions_.find(channel);
-                if (it != subscriptions_.end()) {
-                    callback = it->second;
-                }
+void RedisClient::StopTracking(std::chrono::milliseconds grace) {
+    {
+        std::lock_guard<std::mutex> lock(tracking_mutex_);
+        tracking_running_ = false;
+    }
+    tracking_cv_.notify_all();
+
+    // 可能处于 DllMain 中，不能 join
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (tracking_loop_active_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (tracking_thread_.joinable()) tracking_thread_.detach();
+}
+
+void RedisClient::WaitTracking(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(tracking_mutex_);
+    tracking_cv_.wait_for(lock, timeout, [this]() { return !tracking_running_; });
+}
+
+void RedisClient::TrackingLoop() {
+    auto backoff = kTrackingBackoffInitial;
+    bool had_session = false;
+
+    while (tracking_running_) {
+        struct timeval connect_timeout = { 2, 0 };
+        redisContext* context = redisConnectWithTimeout(host_.c_str(), port_, connect_timeout);
+        if (context && !context->err) {
+            redisEnableKeepAlive(context);
+            if (RunTrackingSession(context)) {
+                if (had_session) tracking_reconnects_.fetch_add(1, std::memory_order_relaxed);
+                had_session = true;
+                backoff = kTrackingBackoffInitial;
             }
+        }
+        if (context) redisFree(context);
 
-            if (callback) {
-                try {
-                    callback(channel, message);
-                }
-                catch (...) {
-                    // 忽略回调异常
+        if (tracking_active_.exchange(false, std::memory_order_acq_rel)) {
+            // 断线期间的修改收不到通知，缓存全部作废
+            tracking_flushes_.fetch_add(1, std::memory_order_relaxed);
+            tracking_callback_({}, true);
+        }
+
+        if (!tracking_running_) break;
+        WaitTracking(backoff);
+        backoff = (std::min)(backoff * 2, kTrackingBackoffMax);
+    }
+
+    tracking_loop_active_.store(false, std::memory_order_release);
+}
+
+bool RedisClient::RunTrackingSession(redisContext* context) {
+    // Redis 6 以下没有 HELLO，返回错误，不开启跟踪
+    redisReply* reply = CommandArgv(context, { "HELLO", "3" });
+    if (!CheckReply(reply)) return false;
+    freeReplyObject(reply);
+
+    std::vector<std::string> args{ "CLIENT", "TRACKING", "ON", "BCAST" };
+    for (const std::string& prefix : tracking_prefixes_) {
+        args.push_back("PREFIX");
+        args.push_back(prefix);
+    }
+    reply = CommandArgv(context, args);
+    if (!CheckReply(reply)) return false;
+    freeReplyObject(reply);
+
+    // 连上之前缓存的内容可能已经过期，先全部作废再开放缓存
+    tracking_flushes_.fetch_add(1, std::memory_order_relaxed);
+    tracking_callback_({}, true);
+    tracking_active_.store(true, std::memory_order_release);
+
+    while (tracking_running_) {
+        redisReply* push = nullptr;
+        if (!ReadSubscriberReply(context, &push)) return true;
+        if (!push) continue;
+
+        // >2 "invalidate" [key, ...]；FLUSHDB / FLUSHALL 时第二项为 nil
+        if (push->type == REDIS_REPLY_PUSH && push->elements >= 2
+            && ReplyString(push->element[0]) == "invalidate") {
+            redisReply* keys_reply = push->element[1];
+            if (keys_reply->type == REDIS_REPLY_ARRAY) {
+                std::vector<std::string> keys;
+                keys.reserve(keys_reply->elements);
+                for (size_t i = 0; i < keys_reply->elements; ++i) {
+                    std::string_view key = ReplyString(keys_reply->element[i]);
+                    keys.emplace_back(key);
                 }
+                tracking_invalidated_.fetch_add(keys.size(), std::memory_order_relaxed);
+                tracking_callback_(keys, false);
+            }
+            else {
+                tracking_flushes_.fetch_add(1, std::memory_order_relaxed);
+                tracking_callback_({}, true);
             }
         }
+        freeReplyObject(push);
     }
+    return true;
+}
+
+RedisClient::TrackingStats RedisClient::GetTrackingStats() const {
+    TrackingStats stats;
+    stats.active = tracking_active_.load(std::memory_order_relaxed);
+    stats.reconnects = tracking_reconnects_.load(std::memory_order_relaxed);
+    stats.invalidated_keys = tracking_invalidated_.load(std::memory_order_relaxed);
+    stats.flushes = tracking_flushes_.load(std::memory_order_relaxed);
+    return stats;
 }
+
 void RedisClient::Close() {
-    // Stop subscriber thread first
-    StopSubscriberThread();
+    // 订阅线程最多一个轮询间隔内退出；回调线程保留，重新 Subscribe 后继续使用
+    StopSubscriberThread(kSubscriberPollInterval * 2);
 
     std::lock_guard<std::mutex> lock(mutex_);
-    if (context_) {
-        context_.reset();
-        initialized_ = false;
+    initialized_.store(false, std::memory_order_release);
+    // 逐个拿连接锁再断开，正在执行的命令先做完
+    for (auto& slot : pool_) {
+        std::lock_guard<std::mutex> slot_lock(slot->mutex);
+        slot->context.reset();
     }
-}
\ No newline at end of file
+}
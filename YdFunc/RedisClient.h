@@ -2,8 +2,6 @@
 #define REDIS_CLIENT_H
 
 #include <hiredis/hiredis.h>
-#include <hiredis/async.h>
-#include <hiredis/adapters/libevent.h>
 #include <string>
 #include <vector>
 #include <memory>
@@ -16,12 +14,26 @@
 #include <stdexcept>
 #include <cstddef>
 #include <unordered_set>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <semaphore>
+#include "mpsc_queue.h"
 
-// Ļص
+// 订阅回调函数类型
 using SubscribeCallback = std::function<void(const std::string& channel, const std::string& message)>;
 
+// 命令连接按池管理：每个线程第一次使用时轮流绑定到池中的一个连接，之后固定使用它，
+// 不同线程的命令互不排队；连接断开后在下次借出时重连
+// 批量写用管线：MULTI、全部命令和 EXEC 一次发出，再一次读回全部回复，N 条命令只付一次往返
+// 订阅用独立连接和读线程：断线后按退避重连并重新订阅；消息交给回调线程执行，慢回调不阻塞读 socket
+// Streams 消费组：每个流一个读线程和独立连接，XREADGROUP 按批读取，回调成功后 XACK，重启后先重放未确认的条目
+// 客户端缓存失效：独立连接上开 RESP3 CLIENT TRACKING 广播模式，按前缀收到任何客户端的修改通知
 class RedisClient {
 public:
+    static constexpr size_t kDefaultPoolSize = 4;
+
     RedisClient(const RedisClient&) = delete;
     RedisClient& operator=(const RedisClient&) = delete;
 
@@ -30,8 +42,10 @@ public:
         return instance;
     }
 
-    bool Initialize(const std::string& connection_string, bool read_only = true);
-    static RedisClient& GetInstanceAndInitialize(const std::string& connection_string, bool read_only = true);
+    // pool_size 只在第一次成功初始化时生效
+    bool Initialize(const std::string& connection_string, bool read_only = true, size_t pool_size = kDefaultPoolSize);
+    static RedisClient& GetInstanceAndInitialize(const std::string& connection_string, bool read_only = true,
+        size_t pool_size = kDefaultPoolSize);
 
     bool Get(const std::string& key, std::string* value);
     bool GetDouble(const std::string& key, double* value);
@@ -50,6 +64,20 @@ public:
     bool AtomicGetInt64(const std::string& key, int64_t* value);
     bool AtomicGetDouble(const std::string& key, double* value);
     bool AtomicSetStringBit(const std::string& key, size_t index, char value);
+    // INCRBYFLOAT；result 非空时写回增加后的值
+    bool AtomicIncrementDouble(const std::string& key, double delta, double* result = nullptr);
+
+    // 区分“不存在”和“出错”：出错返回 false；不存在时返回 true 且 *found 为 false
+    bool Lookup(const std::string& key, std::string* value, bool* found);
+    // 一次 MGET，values 与 keys 一一对应，不存在的为 nullopt
+    bool MultiGet(const std::vector<std::string>& keys, std::vector<std::optional<std::string>>* values);
+    // SCAN 出 prefix 开头的全部 key，按页 UNLINK
+    bool DeleteKeys(const std::string& prefix);
+
+    bool SetAdd(const std::string& key, const std::string& member);
+    bool SetRemove(const std::string& key, const std::string& member);
+    // 不存在的集合返回 true 且 members 为空
+    bool SetMembers(const std::string& key, std::vector<std::string>* members);
 
     bool WriteBatchIncrement(const std::vector<std::pair<std::string, int64_t>>& increments,
         const std::vector<std::pair<std::string, std::string>>& puts = {},
@@ -62,38 +90,239 @@ public:
     bool IsSubscribed(const std::string& channel) const;
     std::vector<std::string> GetSubscribedChannels() const;
 
+    // === 订阅分发 ===
+    struct SubscriberOptions {
+        size_t workers = 1;                 // 回调线程数；同一频道固定在一个线程上，保持消息顺序
+        size_t queue_capacity = 8192;       // 全部回调线程的排队上限，满了丢弃新消息（记为 dropped）
+        std::chrono::milliseconds backoff_initial{ 100 };
+        std::chrono::milliseconds backoff_max{ 5000 };
+    };
+    struct SubscriberStats {
+        bool connected = false;
+        uint64_t reconnects = 0;
+        uint64_t received = 0;
+        uint64_t dispatched = 0;
+        uint64_t dropped = 0;
+        size_t depth = 0;           // 当前排队 + 执行中
+        size_t peak_depth = 0;
+        uint64_t last_lag_us = 0;   // 收到到开始执行回调
+        uint64_t max_lag_us = 0;
+    };
+    // 频道上可能漏了消息（重连后重新订阅、或排队满丢弃）时调用，调用方可据此对账
+    // 在该频道的回调线程上、排在漏消息之后的第一条消息之前执行
+    using SubscriptionGapCallback = std::function<void(const std::string& channel)>;
+
+    // 必须在第一次 Subscribe 之前调用，之后再调用无效
+    void ConfigureSubscriber(const SubscriberOptions& options);
+    void SetSubscriptionGapCallback(SubscriptionGapCallback callback);
+    // 停止订阅线程，等已收到的消息回调完（最多 timeout）后停止回调线程；由 ShutdownRuntime 调用
+    bool DrainSubscriber(std::chrono::milliseconds timeout);
+    SubscriberStats GetSubscriberStats() const;
+
+    // === Streams 消费组 ===
+    // 条目字段约定：payload 为序列化的 protobuf，type 标明消息类型（"feedback" / "trade"，可省略）
+    struct StreamEntry {
+        std::string id;
+        std::string type;
+        std::string payload;
+    };
+    struct StreamConsumerOptions {
+        std::string group = "ydfunc";
+        std::string consumer = "ydfunc";    // 重启后用同一个名字才能重放自己未确认的条目
+        size_t count = 256;                 // 每次 XREADGROUP 最多取多少条
+        std::chrono::milliseconds block{ 1000 };
+        std::chrono::milliseconds backoff_initial{ 100 };
+        std::chrono::milliseconds backoff_max{ 5000 };
+    };
+    struct StreamStats {
+        bool connected = false;
+        uint64_t reconnects = 0;
+        uint64_t reads = 0;         // 返回了条目的 XREADGROUP 次数
+        uint64_t entries = 0;
+        uint64_t replayed = 0;      // 启动 / 重连 / 回调失败后重放的未确认条目
+        uint64_t acked = 0;
+        uint64_t failed_batches = 0;
+    };
+    // 在读线程上按批调用；返回 true 时整批 XACK，返回 false 时整批留在待确认列表里，退避后重放
+    using StreamBatchCallback = std::function<bool(const std::string& stream, const std::vector<StreamEntry>& entries)>;
+
+    // 组不存在时创建（MKSTREAM，从流的当前末尾开始）；同一个流重复调用返回 false
+    bool ConsumeStream(const std::string& stream, const StreamConsumerOptions& options, StreamBatchCallback callback);
+    // 停止全部流的读线程，最多等 grace（BLOCK 最长 options.block）；由 ShutdownRuntime 调用
+    void StopStreams(std::chrono::milliseconds grace);
+    // 全部流的合计
+    StreamStats GetStreamStats() const;
+
+    // === 客户端缓存失效（RESP3 CLIENT TRACKING BCAST）===
+    // flush_all 为 true 时 keys 为空，表示全部失效：FLUSHDB / FLUSHALL，或跟踪连接断开（期间的通知可能丢了）
+    using InvalidationCallback = std::function<void(const std::vector<std::string>& keys, bool flush_all)>;
+    struct TrackingStats {
+        bool active = false;
+        uint64_t reconnects = 0;
+        uint64_t invalidated_keys = 0;
+        uint64_t flushes = 0;
+    };
+
+    // 在独立连接上 HELLO 3 + CLIENT TRACKING ON BCAST PREFIX ...：任何客户端（包括本进程）修改了这些前缀下的 key 都会收到通知
+    // 回调在跟踪线程上执行；断线后按退避重连。只能启动一次，未初始化时返回 false
+    bool StartTracking(const std::vector<std::string>& prefixes, InvalidationCallback callback);
+    void StopTracking(std::chrono::milliseconds grace);
+    // 跟踪连接已建立且订阅成功；为 false 时本地缓存不可信（Redis 6 以下不支持 RESP3，始终为 false）
+    bool IsTracking() const { return tracking_active_.load(std::memory_order_acquire); }
+    TrackingStats GetTrackingStats() const;
+
     void SetMergeOperatorForPrefix(const std::string& prefix, const std::string& type, size_t param = 0);
     void Close();
 
     bool IsReadOnly() const { return read_only_; }
-    bool IsInitialized() const { return initialized_; }
+    bool IsInitialized() const { return initialized_.load(std::memory_order_acquire); }
 
 private:
     RedisClient();
     ~RedisClient();
 
+    struct PooledContext {
+        std::mutex mutex;
+        std::unique_ptr<redisContext, decltype(&redisFree)> context{ nullptr, redisFree };
+    };
+
+    // 借出本线程绑定的连接，存活期间持有该连接的锁；未初始化或重连失败时 get() 为空
+    class ContextLease {
+    public:
+        ContextLease(RedisClient& client, bool write);
+        redisContext* get() const { return context_; }
+        explicit operator bool() const { return context_ != nullptr; }
+
+    private:
+        std::unique_lock<std::mutex> lock_;
+        redisContext* context_ = nullptr;
+    };
+
     static redisReply* ExecuteCommand(redisContext* context, const char* format, ...);
     static bool CheckReply(redisReply* reply);
+    // MULTI、queued 条命令、EXEC 已用 redisAppendCommand 排好，一次读回全部回复；任一条出错返回 false
+    static bool CollectTransaction(redisContext* context, size_t queued);
+
+    redisContext* Connect() const;
+    PooledContext& LocalContext();
+
+    struct SubscriberMessage {
+        std::string channel;
+        std::string message;
+        std::chrono::steady_clock::time_point received{};
+        bool gap = false;   // 不是消息，是漏消息通知
+    };
+    struct SubscriberWorker {
+        MpscQueue<SubscriberMessage> queue;
+        std::counting_semaphore<> signal{ 0 };
+        std::thread thread;
+    };
 
     void StartSubscriberThread();
-    void StopSubscriberThread();
+    void StopSubscriberThread(std::chrono::milliseconds grace);
     void SubscriberLoop();
+    // 一次连接的生命周期：订阅、读消息，直到断线或停止；订阅成功过返回 true
+    bool RunSubscriberSession(redisContext* context, bool resubscribe);
+    // 把订阅表的变化同步到连接上，只发命令不等回复（确认和消息混在同一条流里，由读循环忽略）
+    bool SyncSubscriptions(redisContext* context, std::unordered_set<std::string>* current);
+    // 等待下一条回复，超时返回 true 且 *reply 为空；连接出错返回 false
+    static bool ReadSubscriberReply(redisContext* context, redisReply** reply);
+    // 等到超时或停止；wake_on_change 时订阅表变化也返回
+    void WaitSubscriber(std::chrono::milliseconds timeout, bool wake_on_change);
     void ProcessSubscriptionMessage(redisReply* reply);
 
-    std::unique_ptr<redisContext, decltype(&redisFree)> context_;
-    std::unique_ptr<redisAsyncContext, decltype(&redisAsyncFree)> async_context_;
+    struct StreamConsumer {
+        std::string stream;
+        StreamConsumerOptions options;
+        StreamBatchCallback callback;
+        std::thread thread;
+        std::atomic<bool> active{ true };   // 读线程退出后置 false
+    };
+
+    void StreamLoop(StreamConsumer* consumer);
+    // 一次连接的生命周期：建组、重放未确认条目、读新条目，直到断线、读出错或停止；至少成功读过一次返回 true
+    bool RunStreamSession(redisContext* context, StreamConsumer* consumer, bool reconnect);
+    // XGROUP CREATE ... $ MKSTREAM，组已存在不算失败；连接出错返回 false
+    bool CreateStreamGroup(redisContext* context, StreamConsumer* consumer);
+    // 读一批并交给回调，回调接受后 XACK；start_id 为 ">" 时读新条目，否则重放本消费者 start_id 之后的未确认条目
+    // *last_id 为本批最后一条的 id（没有读到时为空），*rejected 表示回调拒绝了本批；连接或回复出错返回 false，
+    // 其中服务端回 NOGROUP（组不存在）时 *no_group 为 true
+    bool ReadStreamBatch(redisContext* context, StreamConsumer* consumer, const std::string& start_id,
+        std::string* last_id, bool* rejected, bool* no_group);
+    void WaitStream(std::chrono::milliseconds timeout);
+
+    void TrackingLoop();
+    // 一次连接的生命周期：切到 RESP3、开启跟踪，然后读失效通知直到断线或停止；开启成功返回 true
+    bool RunTrackingSession(redisContext* context);
+    void WaitTracking(std::chrono::milliseconds timeout);
+
+    void EnsureSubscriberWorkers();
+    void StopSubscriberWorkers(std::chrono::milliseconds grace);
+    bool DispatchSubscription(SubscriberMessage message, bool force);
+    // 对记下的漏消息频道补发通知，排队有空位时才发
+    void FlushSubscriptionGaps();
+    void SubscriberWorkerLoop(SubscriberWorker* worker);
+
+    // 只在第一次初始化时创建，之后不再增减（Close 只断开连接），借出时不需要加全局锁
+    std::vector<std::unique_ptr<PooledContext>> pool_;
+    std::atomic<size_t> next_slot_{ 0 };
     std::string connection_string_; // Store for subscriber thread
+    std::string host_;
+    int port_ = 0;
 
-    bool initialized_ = false;
+    std::atomic<bool> initialized_{ false };
     bool read_only_ = true;
-    mutable std::mutex mutex_;
+    mutable std::mutex mutex_;  // 初始化 / 关闭
 
-    bool subscriber_thread_running_ = false;
+    std::atomic<bool> subscriber_thread_running_{ false };
+    std::atomic<bool> subscriber_loop_active_{ false };   // 读线程真正退出后才置 false
     std::unique_ptr<std::thread> subscriber_thread_;
     mutable std::mutex subscription_mutex_;
     std::unordered_map<std::string, SubscribeCallback> subscriptions_;
+    SubscriptionGapCallback gap_callback_;
     std::condition_variable subscription_cv_;
-    bool subscription_changed_ = false;
+    std::atomic<bool> subscription_changed_{ false };
+
+    SubscriberOptions subscriber_options_;
+    std::once_flag subscriber_workers_flag_;
+    std::vector<std::unique_ptr<SubscriberWorker>> subscriber_workers_;
+    std::unordered_set<std::string> gap_channels_;       // 只在读线程上访问
+    std::atomic<bool> subscriber_workers_stopping_{ false };
+    std::atomic<size_t> subscriber_workers_running_{ 0 };
+    std::atomic<bool> subscriber_connected_{ false };
+    std::atomic<uint64_t> subscriber_reconnects_{ 0 };
+    std::atomic<uint64_t> subscriber_received_{ 0 };
+    std::atomic<uint64_t> subscriber_dispatched_{ 0 };
+    std::atomic<uint64_t> subscriber_dropped_{ 0 };
+    std::atomic<size_t> subscriber_depth_{ 0 };
+    std::atomic<size_t> subscriber_peak_depth_{ 0 };
+    std::atomic<uint64_t> subscriber_last_lag_us_{ 0 };
+    std::atomic<uint64_t> subscriber_max_lag_us_{ 0 };
+
+    mutable std::mutex stream_mutex_;
+    std::condition_variable stream_cv_;
+    std::vector<std::unique_ptr<StreamConsumer>> stream_consumers_;
+    std::atomic<bool> streams_running_{ true };
+    std::atomic<size_t> stream_connected_{ 0 };
+    std::atomic<uint64_t> stream_reconnects_{ 0 };
+    std::atomic<uint64_t> stream_reads_{ 0 };
+    std::atomic<uint64_t> stream_entries_{ 0 };
+    std::atomic<uint64_t> stream_replayed_{ 0 };
+    std::atomic<uint64_t> stream_acked_{ 0 };
+    std::atomic<uint64_t> stream_failed_batches_{ 0 };
+
+    std::mutex tracking_mutex_;
+    std::condition_variable tracking_cv_;
+    std::vector<std::string> tracking_prefixes_;
+    InvalidationCallback tracking_callback_;
+    std::thread tracking_thread_;
+    bool tracking_started_ = false;
+    std::atomic<bool> tracking_running_{ false };
+    std::atomic<bool> tracking_loop_active_{ false };
+    std::atomic<bool> tracking_active_{ false };
+    std::atomic<uint64_t> tracking_reconnects_{ 0 };
+    std::atomic<uint64_t> tracking_invalidated_{ 0 };
+    std::atomic<uint64_t> tracking_flushes_{ 0 };
 };
 
 #endif // REDIS_CLIENT_H
\ No newline at end of file
@@ -1,10 +1,24 @@
-// YdFunc.cpp :  DLL Ӧóĵ
+// YdFunc.cpp : 定义 DLL 应用程序的导出函数。
 //
 
 #include "stdafx.h"
 #include "YdFunc.h"
 #include "little_goal.pb.h"
 #include "protobuf_http_client.hpp"
+#include "order_batcher.h"
+#include "order_dedup.h"
+#include "entrusts_book.h"
+#include "curl_multi_engine.h"
+#include "shm_transport.h"
+#include "latency_metrics.h"
+#include "write_combiner.h"
+#include "read_cache.h"
+#include "block_engine.h"
+#include "bitset_kernels.h"
+#include "kv_store.h"
+#include "lmdb_kv_store.h"
+#include "redis_kv_store.h"
+#include "runtime_shutdown.h"
 #pragma comment(lib, "ws2_32.lib")
 #include <unordered_map>
 #include <chrono>
@@ -25,15 +39,15 @@
 #include <string>
 #include <map>
 
-// === Դȫʷװ ===
+// === 资源安全访问封装 ===
 
-// ʽȡ Logger⾲̬ʼ˳
+// 懒汉式单例获取 Logger，避免静态初始化顺序问题
 std::shared_ptr<spdlog::logger> GetLogger() {
     static std::shared_ptr<spdlog::logger> logger;
     static std::once_flag log_init_flag;
     std::call_once(log_init_flag, []() {
         try {
-            // ȷ logs Ŀ¼
+            // 确保 logs 目录存在
             if (!std::filesystem::exists("logs")) {
                 std::filesystem::create_directory("logs");
             }
@@ -48,7 +62,7 @@ std::shared_ptr<spdlog::logger> GetLogger() {
     return logger;
 }
 
-// ȫù
+// 全局配置管理
 class ConfigManager {
 public:
     static IniReader& getInstance() {
@@ -72,7 +86,7 @@ public:
         return getInstance().getString(section, key);
     }
 
-    // ȡĬֵ
+    // 获取带默认值的配置
     static std::string getStr(const std::string& section, const std::string& key, const std::string& defaultVal) {
         auto val = getInstance().getString(section, key);
         return val.value_or(defaultVal);
@@ -88,17 +102,159 @@ public:
     }
 };
 
-// ȫֱ (ͨ ConfigManager ʼ)
+// 全局变量管理 (通过 ConfigManager 初始化)
 const std::string& GetRedisUri() {
     static std::string uri = ConfigManager::getStr("redis", "uri", "127.0.0.1:6379");
     return uri;
 }
 
+// [redis] pool_size: 命令连接数，各线程轮流绑定（默认 4）
+size_t GetRedisPoolSize() {
+    int size = ConfigManager::getInt("redis", "pool_size", static_cast<int>(RedisClient::kDefaultPoolSize));
+    return static_cast<size_t>(size > 0 ? size : 1);
+}
+
+// [redis] subscriber_workers: 订阅回调线程数（默认 1，同一频道始终在同一线程上按顺序回调）
+// subscriber_queue: 回调排队上限（默认 8192），满了丢弃新消息并通知对账
+// subscriber_backoff_ms / subscriber_backoff_max_ms: 订阅连接断开后的重连退避，从前者起每次翻倍到后者
+RedisClient::SubscriberOptions GetRedisSubscriberOptions() {
+    RedisClient::SubscriberOptions options;
+    int workers = ConfigManager::getInt("redis", "subscriber_workers", static_cast<int>(options.workers));
+    int capacity = ConfigManager::getInt("redis", "subscriber_queue", static_cast<int>(options.queue_capacity));
+    int backoff = ConfigManager::getInt("redis", "subscriber_backoff_ms", static_cast<int>(options.backoff_initial.count()));
+    int backoff_max = ConfigManager::getInt("redis", "subscriber_backoff_max_ms", static_cast<int>(options.backoff_max.count()));
+    if (workers > 0) options.workers = static_cast<size_t>(workers);
+    if (capacity > 0) options.queue_capacity = static_cast<size_t>(capacity);
+    if (backoff > 0) options.backoff_initial = std::chrono::milliseconds(backoff);
+    if (backoff_max > 0) options.backoff_max = std::chrono::milliseconds(backoff_max);
+    return options;
+}
+
 const std::string& GetDbPath() {
     static std::string path = ConfigManager::getStr("lmdb", "path", "./litg_db");
     return path;
 }
 
+// 导出函数共用的 LMDB 实例；第一次使用时按 [lmdb] 配置：
+// map_size_mb: 初始映射大小（默认 100）；map_max_mb: 写满时自动扩容的上限（默认 4096，0 表示不限）
+// read_snapshot: 读快照模式（默认开启）
+// migrate_records: 把旧的逐字段持仓 / 账户 key 合并成定长记录并删除旧 key，写入方切换到新格式后再开启
+size_t GetDbMapSizeMb() {
+    static size_t size = []() {
+        int mb = ConfigManager::getInt("lmdb", "map_size_mb", 100);
+        return static_cast<size_t>(mb > 0 ? mb : 100);
+    }();
+    return size;
+}
+
+LMDBClient& GetDb() {
+    LMDBClient& db = LMDBClient::GetInstance();
+    static std::once_flag options_flag;
+    std::call_once(options_flag, [&db]() {
+        db.SetReadSnapshot(ConfigManager::getInt("lmdb", "read_snapshot", 1) != 0);
+        int map_max_mb = ConfigManager::getInt("lmdb", "map_max_mb", 4096);
+        db.SetMapSizeLimit(static_cast<size_t>(map_max_mb > 0 ? map_max_mb : 0));
+        if (ConfigManager::getInt("lmdb", "migrate_records", 0) != 0 && db.Initialize(GetDbPath(), GetDbMapSizeMb(), false)) {
+            int migrated = db.MigrateLegacyRecords(true);
+            if (auto log = GetLogger()) log->info("[LMDB] Migrated {} legacy position/account records.", migrated);
+        }
+        });
+    db.Initialize(GetDbPath(), GetDbMapSizeMb(), false);
+    return db;
+}
+
+// 导出函数的写入口（读也经过它，才能读到本线程尚未提交的写）；按 [lmdb] 配置：
+// write_combine: 写操作入队由后台线程合并成批提交（默认关闭，关闭时直接同步写）
+// write_batch: 一个事务最多合并的变更数；write_interval_ms: 凑批的时间片
+// 读缓存按 [cache] 配置：enabled（默认开启）；slots: 每个线程的槽位数（默认 4096）
+WriteCombiner& GetWrites() {
+    LMDBClient& db = GetDb();
+    static std::once_flag combiner_flag;
+    std::call_once(combiner_flag, [&db]() {
+        ReadCache& cache = ReadCache::GetInstance();
+        cache.Configure(&db,
+            ConfigManager::getInt("cache", "enabled", 1) != 0,
+            static_cast<size_t>(ConfigManager::getInt("cache", "slots", 4096)));
+        WriteCombiner::GetInstance().Configure(&db,
+            ConfigManager::getInt("lmdb", "write_combine", 0) != 0,
+            static_cast<size_t>(ConfigManager::getInt("lmdb", "write_batch", 256)),
+            ConfigManager::getInt("lmdb", "write_interval_ms", 2),
+            &cache);
+        WriteCombiner::GetInstance().SetDropCallback([](const std::vector<std::string>& keys) {
+            std::string joined;
+            for (const std::string& key : keys) {
+                if (!joined.empty()) joined += ',';
+                joined += key;
+            }
+            if (auto log = GetLogger()) log->error("[LMDB] Write combiner dropped {} mutation(s), keys: {}", keys.size(), joined);
+            });
+        });
+    return WriteCombiner::GetInstance();
+}
+
+// 板块成员（ADD_TO_BLOCK / IS_IN_BLOCK / GET_BLOCK_SIZE / BLOCK_*）；第一次使用时把旧的 BLK_ 位串迁移成位图
+// [blocks] simd: 板块集合运算使用 AVX2（默认开启，CPU 不支持时自动走标量）
+BlockEngine& GetBlocks() {
+    WriteCombiner& writes = GetWrites();
+    static std::once_flag blocks_flag;
+    std::call_once(blocks_flag, [&writes]() {
+        SetBitsetSimd(ConfigManager::getInt("blocks", "simd", 1) != 0);
+        BlockEngine::GetInstance().Configure(&GetDb(), &writes);
+        if (auto log = GetLogger()) {
+            auto stats = BlockEngine::GetInstance().GetStats();
+            if (stats.migrated > 0) log->info("[LMDB] Migrated {} legacy block memberships to bitmaps.", stats.migrated);
+        }
+        });
+    return BlockEngine::GetInstance();
+}
+
+// [kv] backend: GET_KEY / ADD_KEY / SET_KEY / DEL_KEY / KEY_* / RESET_STATUS 和板块函数的存储，lmdb（默认）或 redis
+// 持仓 / 账户记录始终在 LMDB
+const std::string& GetKvBackend() {
+    static std::string backend = ConfigManager::getStr("kv", "backend", "lmdb");
+    return backend;
+}
+
+// 导出函数共用的 Redis 连接；redis 后端需要写权限。连不上时每秒最多重试一次
+RedisClient& GetRedis() {
+    RedisClient& redis = RedisClient::GetInstance();
+    if (redis.IsInitialized()) return redis;
+
+    static std::atomic<int64_t> last_attempt_ms{ 0 };
+    int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t last_ms = last_attempt_ms.load(std::memory_order_relaxed);
+    if (last_ms != 0 && now_ms - last_ms < 1000) return redis;
+    if (!last_attempt_ms.compare_exchange_strong(last_ms, now_ms, std::memory_order_relaxed)) return redis;
+
+    if (!redis.Initialize(GetRedisUri(), GetKvBackend() != "redis", GetRedisPoolSize())) {
+        if (auto log = GetLogger()) log->error("[Redis] Failed to connect to {}.", GetRedisUri());
+    }
+    return redis;
+}
+
+// 键值导出函数的存储后端；[kv] backend=redis 时按以下配置：
+// cache: 本地缓存 key: / blkset: 读结果，靠 Redis 6+ 的客户端缓存失效通知保持一致（默认开启）
+// cache_entries: 本地缓存的条目上限（默认 65536）
+KVStore& GetStore() {
+    static KVStore* store = []() -> KVStore* {
+        if (GetKvBackend() == "redis") {
+            RedisKVStore& redis_store = RedisKVStore::GetInstance();
+            int entries = ConfigManager::getInt("kv", "cache_entries", 65536);
+            redis_store.Configure(&GetRedis(),
+                ConfigManager::getInt("kv", "cache", 1) != 0,
+                static_cast<size_t>(entries > 0 ? entries : 65536));
+            return &redis_store;
+        }
+        LmdbKVStore& lmdb_store = LmdbKVStore::GetInstance();
+        lmdb_store.Configure(&GetDb(), &GetWrites(), &GetBlocks());
+        return &lmdb_store;
+    }();
+    // 第一次没连上时由这里按节奏重试
+    if (store == &RedisKVStore::GetInstance()) GetRedis();
+    return *store;
+}
+
 const std::string& GetHttpBaseUrl() {
     static std::string url = ConfigManager::getStr("http", "base_url", "http://localhost:8000");
     return url;
@@ -108,11 +264,244 @@ int GetTimeoutMs() {
     return ConfigManager::getInt("http", "timeout_ms", 10000);
 }
 
-// صĳ
-const std::string STRING_BIT_PREFIX = "BLK_";
-const char* redis_channel = "stock_trade"; // ֳ
+// 查询类接口（ASK_BID / TODAY_ENTRUSTS）在公式线程上同步等待的期限
+int GetQueryTimeoutMs() {
+    return ConfigManager::getInt("http", "query_timeout_ms", GetTimeoutMs());
+}
+
+// 传输方式：tcp（默认）/ unix / shm
+const std::string& GetHttpTransport() {
+    static std::string transport = ConfigManager::getStr("http", "transport", "tcp");
+    return transport;
+}
+
+ProtobufHttpClient::Config MakeHttpConfig(long timeout_ms) {
+    return ProtobufHttpClient::Config{
+        .base_url = GetHttpBaseUrl(),
+        .timeout_ms = timeout_ms,
+        .transport = GetHttpTransport(),
+        .unix_socket_path = ConfigManager::getStr("http", "unix_socket_path", "qmt_api.sock")
+    };
+}
+
+// curl_multi 引擎和回调执行器在第一次使用前按 config.ini [http] 配置一次
+// queue_capacity: 未完成请求上限；max_connections: 到后端的最大连接数；workers: 回调线程数
+// batch_window_ms: 委托合批窗口，0 表示逐笔发送；batch_max: 每个窗口最多委托数
+// batch_groups: 合批时股票散列到的分组数（默认 8），每组一个请求，同组的批次和撤单串行
+// shm_name / shm_ring_kb: transport = shm 时的共享内存名字和单向环大小
+// [stats] latency_enabled: 是否记录耗时直方图；latency_interval_s: 定期写日志的间隔，0 表示不写
+void InitHttpRuntime() {
+    static std::once_flag init_flag;
+    std::call_once(init_flag, []() {
+        size_t capacity = (size_t)ConfigManager::getInt("http", "queue_capacity", 4096);
+        CurlMultiEngine::GetInstance().Configure(capacity,
+            (long)ConfigManager::getInt("http", "max_connections", 32));
+        ShmTransport::GetInstance().Configure(
+            ConfigManager::getStr("http", "shm_name", "qmt_api_shm"),
+            (uint32_t)ConfigManager::getInt("http", "shm_ring_kb", 1024) * 1024u, capacity);
+        OrderExecutor::GetInstance().Configure(
+            (size_t)ConfigManager::getInt("http", "workers", 4), capacity);
+        OrderBatcher::GetInstance().Configure(
+            MakeHttpConfig(GetTimeoutMs()),
+            (long)ConfigManager::getInt("http", "batch_window_ms", 0),
+            (size_t)ConfigManager::getInt("http", "batch_max", 32),
+            (size_t)ConfigManager::getInt("http", "batch_groups", 8));
+
+        LatencyMetrics& metrics = LatencyMetrics::GetInstance();
+        metrics.SetEnabled(ConfigManager::getInt("stats", "latency_enabled", 1) != 0);
+        if (metrics.Enabled()) {
+            metrics.StartReporter(std::chrono::seconds(ConfigManager::getInt("stats", "latency_interval_s", 60)),
+                [](const std::string& text) {
+                    if (auto log = GetLogger()) log->info("[Latency]\n{}", text);
+                });
+        }
+        });
+}
+
+ProtobufHttpClient::Config GetHttpConfig(long timeout_ms) {
+    InitHttpRuntime();
+    return MakeHttpConfig(timeout_ms);
+}
+
+// [dedup] enabled: 是否拦截同一根 K 线上的重复委托；slots: 指纹表大小
+// persist: 把当日指纹写入 LMDB（经合并写提交，不阻塞下单），DLL 重新加载或程序重启后同一根 K 线不会重发
+void InitOrderDedup() {
+    static std::once_flag init_flag;
+    std::call_once(init_flag, []() {
+        LMDBClient* store = nullptr;
+        WriteCombiner* writes = nullptr;
+        if (ConfigManager::getInt("dedup", "persist", 0) != 0) {
+            LMDBClient& db = GetDb();
+            if (db.Initialize(GetDbPath(), GetDbMapSizeMb(), false)) {
+                store = &db;
+                writes = &GetWrites();
+            }
+        }
+        OrderDedup::GetInstance().Configure(
+            ConfigManager::getInt("dedup", "enabled", 1) != 0,
+            (size_t)ConfigManager::getInt("dedup", "slots", 65536),
+            store, writes);
+        });
+}
+
+// 同一根 K 线上参数完全相同的委托只放行第一次，返回 false 表示重复
+// 放行时 *fingerprint 为登记的指纹，发送失败后用它撤销；取不到 K 线时间时不去重，*fingerprint 为 0
+bool ClaimOrder(const DLLCALCINFO* pData, const std::string& stock_code,
+    int order_type, double price, int how_many, uint64_t* fingerprint)
+{
+    *fingerprint = 0;
+    InitOrderDedup();
+    OrderDedup& dedup = OrderDedup::GetInstance();
+    if (!dedup.Enabled()) return true;
+
+    const int pos = pData->m_nCurBarPos;
+    if (pos < 0 || pos >= pData->m_nNumData) return true;
+
+    OrderDedup::Key key;
+    int trade_date = 0;
+    if (pData->m_pStkHistData) {
+        key.bar_time = pData->m_pStkHistData[pos].m_time;
+        trade_date = pData->m_pStkHistData[pos].m_nBelongDate;
+    }
+    else if (pData->m_pStkTickData) {
+        key.bar_time = pData->m_pStkTickData[pos].m_time;
+        trade_date = pData->m_pStkTickData[pos].m_nBelongDate;
+    }
+    if (key.bar_time == 0) return true;
+
+    key.stock_code = stock_code;
+    key.data_type = (static_cast<uint32_t>(pData->m_dataType.m_baseType) << 16) | pData->m_dataType.m_nUnit;
+    key.order_type = order_type;
+    key.price = price;
+    key.how_many = how_many;
+
+    uint64_t fp = OrderDedup::Fingerprint(key);
+    if (!dedup.TryClaim(fp, trade_date)) return false;
+    *fingerprint = fp;
+    return true;
+}
 
-// 
+void LogHttpStats(const char* tag) {
+    MessageTransport& transport = ProtobufHttpClient::SelectTransport(GetHttpTransport());
+    auto engine = transport.GetStats();
+    auto executor = OrderExecutor::GetInstance().GetStats();
+    auto batcher = OrderBatcher::GetInstance().GetStats();
+    auto dedup = OrderDedup::GetInstance().GetStats();
+    auto writes = WriteCombiner::GetInstance().GetStats();
+    auto cache = ReadCache::GetInstance().GetStats();
+    auto redis_sub = RedisClient::GetInstance().GetSubscriberStats();
+    auto redis_stream = RedisClient::GetInstance().GetStreamStats();
+    LMDBClient::MapUsage map;
+    LMDBClient::GetInstance().GetMapUsage(&map);
+    if (auto log = GetLogger()) {
+        log->warn("{} {} pending={} in_flight={} submitted={} completed={} rejected={}; "
+            "callbacks depth={}/{} peak={} rejected={}; batch orders={} batches={} failed={} max={}; "
+            "dedup claimed={} duplicates={} released={} overflow={} rehashes={}; "
+            "lmdb writes pending={} committed={} batches={} failed={} dropped={} max={}; "
+            "lmdb map used={}MB/{}MB limit={}MB grows={}; "
+            "read cache hits={} misses={} evictions={}; "
+            "redis sub connected={} reconnects={} received={} dispatched={} dropped={} depth={} peak={} lag_us={}/{}; "
+            "redis stream connected={} reconnects={} reads={} entries={} replayed={} acked={} failed={}",
+            tag, transport.Name(), engine.pending, engine.in_flight, engine.submitted, engine.completed, engine.rejected,
+            executor.depth, executor.capacity, executor.peak_depth, executor.rejected,
+            batcher.orders, batcher.batches, batcher.failed, batcher.max_batch_seen,
+            dedup.claimed, dedup.duplicates, dedup.released, dedup.overflow, dedup.rehashes,
+            writes.pending, writes.committed, writes.batches, writes.failed_batches, writes.dropped, writes.max_batch_seen,
+            map.used >> 20, map.map_size >> 20, map.max_map_size >> 20, map.grows,
+            cache.hits, cache.misses, cache.evictions,
+            redis_sub.connected, redis_sub.reconnects, redis_sub.received, redis_sub.dispatched, redis_sub.dropped,
+            redis_sub.depth, redis_sub.peak_depth, redis_sub.last_lag_us, redis_sub.max_lag_us,
+            redis_stream.connected, redis_stream.reconnects, redis_stream.reads, redis_stream.entries,
+            redis_stream.replayed, redis_stream.acked, redis_stream.failed_batches);
+        if (GetKvBackend() == "redis") {
+            auto kv = RedisKVStore::GetInstance().GetStats();
+            auto tracking = RedisClient::GetInstance().GetTrackingStats();
+            log->warn("{} kv backend=redis cache tracking={} entries={} hits={} misses={} invalidations={}; "
+                "tracking reconnects={} invalidated={} flushes={}",
+                tag, kv.tracking, kv.entries, kv.hits, kv.misses, kv.invalidations,
+                tracking.reconnects, tracking.invalidated_keys, tracking.flushes);
+        }
+    }
+}
+
+// 缓存相关的常量
+const char* redis_channel = "stock_trade"; // 保持常量
+
+// [entrusts] source: http（默认）逐次查询；book 由本地委托簿回答 ASK_BID / TODAY_ENTRUSTS，
+// 依赖 /orders 底账和回报字段与后端一致，核对过后端之后再开启
+// orders_endpoint: 拉取当日委托底账的接口；resync_s: 定期对账间隔，0 表示只在收到未知委托时拉取
+// 委托簿订阅 Redis redis_channel 上的 TradeFeedback；订阅失败或底账未就绪时自动回退到 HTTP
+// feedback_stream: 非空时改从该 Redis Stream 按消费组读回报（不再订阅频道），处理完 XACK，重启后从未确认处续读
+// stream_group / stream_consumer: 消费组和消费者名（默认都是 ydfunc，多个进程消费同一个流时消费者名要不同）
+// stream_count: 每次最多读多少条（默认 256）；stream_block_ms: 没有新条目时每次阻塞等待多久（默认 1000）
+RedisClient::StreamConsumerOptions GetFeedbackStreamOptions() {
+    RedisClient::StreamConsumerOptions options;
+    options.group = ConfigManager::getStr("entrusts", "stream_group", options.group);
+    options.consumer = ConfigManager::getStr("entrusts", "stream_consumer", options.consumer);
+    int count = ConfigManager::getInt("entrusts", "stream_count", static_cast<int>(options.count));
+    int block = ConfigManager::getInt("entrusts", "stream_block_ms", static_cast<int>(options.block.count()));
+    if (count > 0) options.count = static_cast<size_t>(count);
+    if (block > 0) options.block = std::chrono::milliseconds(block);
+    return options;
+}
+
+bool UseEntrustsBook() {
+    static bool enabled = []() {
+        if (ConfigManager::getStr("entrusts", "source", "http") != "book") return false;
+
+        InitHttpRuntime();
+        EntrustsBook& book = EntrustsBook::GetInstance();
+        book.Configure(MakeHttpConfig(GetQueryTimeoutMs()),
+            ConfigManager::getStr("entrusts", "orders_endpoint", "/orders"),
+            ConfigManager::getInt("entrusts", "resync_s", 300));
+
+        RedisClient& redis = GetRedis();
+        redis.ConfigureSubscriber(GetRedisSubscriberOptions());
+        // 重连或排队满丢了回报，委托簿重新拉底账
+        redis.SetSubscriptionGapCallback([](const std::string&) {
+            EntrustsBook::GetInstance().RequestRefresh();
+            });
+        const std::string stream = ConfigManager::getStr("entrusts", "feedback_stream", "");
+        bool subscribed = false;
+        if (!stream.empty()) {
+            subscribed = redis.ConsumeStream(stream, GetFeedbackStreamOptions(),
+                [](const std::string&, const std::vector<RedisClient::StreamEntry>& entries) {
+                    std::vector<std::string_view> feedbacks;
+                    feedbacks.reserve(entries.size());
+                    for (const auto& entry : entries) {
+                        // 委托簿只用 TradeFeedback，其他类型（成交明细 trade）直接确认
+                        if (entry.type.empty() || entry.type == "feedback") feedbacks.push_back(entry.payload);
+                    }
+                    EntrustsBook::GetInstance().OnFeedbackBatch(feedbacks);
+                    return true;
+                });
+        }
+        else {
+            subscribed = redis.Subscribe(redis_channel, [](const std::string&, const std::string& message) {
+                EntrustsBook::GetInstance().OnFeedback(message);
+                });
+        }
+        if (!subscribed) {
+            if (auto log = GetLogger()) {
+                log->warn("[Entrusts] Subscribe {} failed, falling back to HTTP.", stream.empty() ? redis_channel : stream);
+            }
+            return false;
+        }
+        book.RequestRefresh();
+        return true;
+    }();
+
+    if (!enabled) return false;
+    EntrustsBook& book = EntrustsBook::GetInstance();
+    if (!book.Ready()) {
+        // 底账还没拉到（或上次失败），后台再试一次，本次走 HTTP
+        book.RequestRefresh();
+        return false;
+    }
+    return true;
+}
+
+// 辅助函数
 std::string convertStockCodeMarketStartWithDot(std::string code) {
     if (code.empty()) return "";
     if (code.size() < 2) return code;
@@ -126,11 +515,12 @@ std::string convertStockCodeMarketEnd(const std::string& code) {
     return stockNum + "." + exchange;
 }
 
-// === ʵ ===
-// ע⣺е try-catch 
+// === 导出函数实现 ===
+// 注意：所有导出函数均增加了 try-catch 防御
 
 __declspec(dllexport) int WINAPI AUTO_TRADE(DLLCALCINFO* pData)
 {
+    ExportTimer timer("AUTO_TRADE");
     try {
         if (!pData) return -1;
 
@@ -151,11 +541,13 @@ __declspec(dllexport) int WINAPI AUTO_TRADE(DLLCALCINFO* pData)
 
             if (HowMany > 0)
             {
-                ProtobufHttpClient::Config config{
-                    .base_url = GetHttpBaseUrl(),
-                    .timeout_ms = (long)GetTimeoutMs()
-                };
-                ProtobufHttpClient client(config);
+                if (OrderType < 1 || OrderType > 6) return -1;
+
+                // 盘中逐笔刷新会在同一根 K 线上反复触发，重复的委托在序列化之前丢弃
+                uint64_t fingerprint = 0;
+                if (!ClaimOrder(pData, stock_code, OrderType, Price, HowMany, &fingerprint)) return 1;
+
+                ProtobufHttpClient client(GetHttpConfig(GetTimeoutMs()));
 
                 PlaceOrder place_order;
                 place_order.set_stock_code(stock_code.c_str());
@@ -163,30 +555,47 @@ __declspec(dllexport) int WINAPI AUTO_TRADE(DLLCALCINFO* pData)
                 place_order.set_price(Price);
 
                 std::string order_type;
-                std::string endpoint;
+                std::string place_type;
 
-                if (OrderType == 1) { order_type = "buy"; endpoint = "/place_order/amount"; }
-                else if (OrderType == 2) { order_type = "sell"; endpoint = "/place_order/amount"; }
-                else if (OrderType == 3) { order_type = "buy"; endpoint = "/place_order/vol"; }
-                else if (OrderType == 4) { order_type = "sell"; endpoint = "/place_order/vol"; }
-                else if (OrderType == 5) { order_type = "buy"; endpoint = "/place_order/percent"; }
-                else if (OrderType == 6) { order_type = "sell"; endpoint = "/place_order/percent"; }
-                else { return -1; }
+                if (OrderType == 1) { order_type = "buy"; place_type = "amount"; }
+                else if (OrderType == 2) { order_type = "sell"; place_type = "amount"; }
+                else if (OrderType == 3) { order_type = "buy"; place_type = "vol"; }
+                else if (OrderType == 4) { order_type = "sell"; place_type = "vol"; }
+                else if (OrderType == 5) { order_type = "buy"; place_type = "percent"; }
+                else { order_type = "sell"; place_type = "percent"; }
 
                 place_order.set_order_type(order_type);
 
-                // 첽Ͳ¼ص־
-                client.async_post<PlaceOrder, PlaceOrderResponse>(
-                    endpoint,
-                    place_order,
-                    [](auto response, auto error) {
-                        if (!error.empty()) {
-                            if (auto log = GetLogger()) log->error("AUTO_TRADE async error: {}", error);
-                        }
-                        else {
-                            if (auto log = GetLogger()) log->info("AUTO_TRADE async success.");
+                auto on_done = [fingerprint](std::unique_ptr<PlaceOrderResponse> response, const std::string& error,
+                    ProtobufHttpClient::SendPhase phase) {
+                    if (!error.empty()) {
+                        // 请求确定没有离开本进程才撤销登记，允许本根 K 线的下一次计算重发；
+                        // 超时、响应解析失败、整批失败等情况后端可能已经下单，保留登记，不重复下单
+                        if (fingerprint && phase == ProtobufHttpClient::SendPhase::NotSent) {
+                            OrderDedup::GetInstance().Release(fingerprint);
                         }
+                        if (auto log = GetLogger()) log->error("AUTO_TRADE async error: {}", error);
+                        if (error == ProtobufHttpClient::kQueueRejectedError) LogHttpStats("AUTO_TRADE");
                     }
+                    else {
+                        if (auto log = GetLogger()) log->info("AUTO_TRADE async success.");
+                    }
+                };
+
+                // 开启合批时交给 OrderBatcher，窗口内的委托合成一个请求
+                OrderBatcher& batcher = OrderBatcher::GetInstance();
+                if (batcher.Enabled()) {
+                    PlaceOrder batched = place_order;
+                    batched.set_place_type(place_type);
+                    if (batcher.Add(std::move(batched), on_done)) return 1;
+                }
+
+                // 异步发送并记录回调日志，同一只股票的委托按顺序执行（与合批、撤单用同一个 ordering_key）
+                client.async_post<PlaceOrder, PlaceOrderResponse>(
+                    "/place_order/" + place_type,
+                    place_order,
+                    on_done,
+                    batcher.OrderingKey(stock_code)
                 );
             }
         }
@@ -205,6 +614,7 @@ __declspec(dllexport) int WINAPI AUTO_TRADE(DLLCALCINFO* pData)
 
 __declspec(dllexport) int WINAPI AUTO_CANCEL(DLLCALCINFO* pData)
 {
+    ExportTimer timer("AUTO_CANCEL");
     try {
         if (!pData || pData->m_dwHeadTag != YDDLL_HEADTAG) return -1;
 
@@ -220,12 +630,6 @@ __declspec(dllexport) int WINAPI AUTO_CANCEL(DLLCALCINFO* pData)
             int CancelType = (int)pData->m_pParam[0]->m_dSingleData;
             int CancelScope = (int)pData->m_pParam[1]->m_dSingleData;
 
-            ProtobufHttpClient::Config config{
-             .base_url = GetHttpBaseUrl(),
-             .timeout_ms = (long)GetTimeoutMs()
-            };
-            ProtobufHttpClient client(config);
-
             std::string endpoint = "/cancel/stock_scope";
             CancelStockScope cancel_stock_scope;
             std::string order_type;
@@ -245,15 +649,30 @@ __declspec(dllexport) int WINAPI AUTO_CANCEL(DLLCALCINFO* pData)
             cancel_stock_scope.set_order_type(order_type);
             cancel_stock_scope.set_stock_code(target_code);
 
-            client.async_post<CancelStockScope, CancelStockScopeResponse>(
-                endpoint,
-                cancel_stock_scope,
-                [](auto response, auto error) {
-                    if (!error.empty()) {
-                        if (auto log = GetLogger()) log->error("AUTO_CANCEL async error: {}", error);
-                    }
-                }
-            );
+            OrderBatcher& batcher = OrderBatcher::GetInstance();
+            auto send_cancel = [endpoint, cancel_stock_scope, ordering_key = batcher.OrderingKey(target_code)]() {
+                ProtobufHttpClient client(GetHttpConfig(GetTimeoutMs()));
+                client.async_post<CancelStockScope, CancelStockScopeResponse>(
+                    endpoint,
+                    cancel_stock_scope,
+                    [](auto response, auto error, auto phase) {
+                        if (!error.empty()) {
+                            if (auto log = GetLogger()) log->error("AUTO_CANCEL async error: {}", error);
+                        }
+                    },
+                    ordering_key
+                );
+            };
+
+            if (CancelScope == 1) {
+                // 合批窗口里这只股票的委托先发出，撤单用同一个 ordering_key 排在它们后面
+                batcher.FlushGroup(target_code);
+                send_cancel();
+            }
+            else {
+                // 撤全部：各分组的 ordering_key 不同，要等全部分组的批次都完成再发，否则窗口里的委托会躲过撤单
+                batcher.FlushAll(send_cancel);
+            }
         }
         return 1;
     }
@@ -268,25 +687,17 @@ __declspec(dllexport) int WINAPI STOCK_POSITIONS(DLLCALCINFO* pData)
 {
     try {
         if (!pData) return -1;
-        LMDBClient& db = LMDBClient::GetInstance();
-        db.Initialize(GetDbPath(), 100, false);
+        LMDBClient& db = GetDb();
 
         std::string stock_code = pData->m_strStkLabel;
         stock_code = convertStockCodeMarketStartWithDot(stock_code);
-        std::string parent = "positions";
-
-        double vol = 0;
-        db.GetDouble(parent + ":" + stock_code + ":" + "vol", &vol);
-
-        double available_vol = 0;
-        db.GetDouble(parent + ":" + stock_code + ":" + "available_vol", &available_vol);
-
-        double avg_cost = 0;
-        db.GetDouble(parent + ":" + stock_code + ":" + "avg_cost", &avg_cost);
+        // 一次查找取整条记录；没有新格式记录时在同一个读事务里读旧的逐字段 key
+        lmdb_records::PositionRecord position;
+        db.GetPosition(stock_code, &position);
 
-        pData->m_pResultBuf[pData->m_nNumData - 1] = available_vol;
-        pData->m_pResultBuf[pData->m_nNumData - 2] = vol;
-        pData->m_pResultBuf[pData->m_nNumData - 3] = avg_cost;
+        pData->m_pResultBuf[pData->m_nNumData - 1] = position.available_vol;
+        pData->m_pResultBuf[pData->m_nNumData - 2] = position.vol;
+        pData->m_pResultBuf[pData->m_nNumData - 3] = position.avg_cost;
 
         return 1;
     }
@@ -298,21 +709,16 @@ __declspec(dllexport) int WINAPI ACCOUNT_ALL(DLLCALCINFO* pData)
 {
     try {
         if (!pData) return -1;
-        LMDBClient& db = LMDBClient::GetInstance();
-        db.Initialize(GetDbPath(), 100, false);
+        LMDBClient& db = GetDb();
 
-        std::string parent = "account";
+        // 整条账户记录一次读出，各字段来自同一次写入
+        lmdb_records::AccountRecord account;
+        db.GetAccount(&account);
 
-        double total_asset = 0, frozen_cash = 0, cash = 0, market_value = 0;
-        db.GetDouble(parent + ":" + "total_asset", &total_asset);
-        db.GetDouble(parent + ":" + "frozen_cash", &frozen_cash);
-        db.GetDouble(parent + ":" + "cash", &cash);
-        db.GetDouble(parent + ":" + "market_value", &market_value);
-
-        pData->m_pResultBuf[pData->m_nNumData - 1] = cash;
-        pData->m_pResultBuf[pData->m_nNumData - 2] = frozen_cash;
-        pData->m_pResultBuf[pData->m_nNumData - 3] = market_value;
-        pData->m_pResultBuf[pData->m_nNumData - 4] = total_asset;
+        pData->m_pResultBuf[pData->m_nNumData - 1] = account.cash;
+        pData->m_pResultBuf[pData->m_nNumData - 2] = account.frozen_cash;
+        pData->m_pResultBuf[pData->m_nNumData - 3] = account.market_value;
+        pData->m_pResultBuf[pData->m_nNumData - 4] = account.total_asset;
 
         return 1;
     }
@@ -324,8 +730,7 @@ __declspec(dllexport) int WINAPI ADD_TO_BLOCK(DLLCALCINFO* pData)
 {
     try {
         if (!pData) return -1;
-        LMDBClient& db = LMDBClient::GetInstance();
-        db.Initialize(GetDbPath(), 100, false);
+        KVStore& blocks = GetStore();
 
         std::string stock_code = pData->m_strStkLabel;
         if (stock_code.size() > 6) stock_code = stock_code.substr(stock_code.size() - 6);
@@ -333,10 +738,8 @@ __declspec(dllexport) int WINAPI ADD_TO_BLOCK(DLLCALCINFO* pData)
         if (pData->m_nNumParam >= 1 && pData->m_pParam[0] != NULL)
         {
             int index1 = (int)pData->m_pParam[0]->m_dSingleData;
-            std::string parent = "blk_size:";
             if (index1 >= 0) {
-                db.AtomicSetStringBit(STRING_BIT_PREFIX + stock_code, index1, '1');
-                db.AtomicIncrement(parent + std::to_string(index1), 1);
+                blocks.BlockAdd(static_cast<uint32_t>(index1), stock_code);
             }
         }
         return 1;
@@ -348,8 +751,7 @@ __declspec(dllexport) int WINAPI IS_IN_BLOCK(DLLCALCINFO* pData)
 {
     try {
         if (!pData) return -1;
-        LMDBClient& db = LMDBClient::GetInstance();
-        db.Initialize(GetDbPath(), 100, false);
+        KVStore& blocks = GetStore();
 
         std::string stock_code = pData->m_strStkLabel;
         if (stock_code.size() > 6) stock_code = stock_code.substr(stock_code.size() - 6);
@@ -358,8 +760,7 @@ __declspec(dllexport) int WINAPI IS_IN_BLOCK(DLLCALCINFO* pData)
         {
             int index1 = (int)pData->m_pParam[0]->m_dSingleData;
             if (index1 >= 0) {
-                bool bit_val = false;
-                db.GetStringBit(STRING_BIT_PREFIX + stock_code, index1, &bit_val);
+                bool bit_val = blocks.BlockContains(static_cast<uint32_t>(index1), stock_code);
                 pData->m_pResultBuf[pData->m_nNumData - 1] = (bit_val ? 1 : 0);
             }
         }
@@ -372,8 +773,7 @@ __declspec(dllexport) int WINAPI RESET_STATUS(DLLCALCINFO* pData)
 {
     try {
         if (!pData) return -1;
-        LMDBClient& db = LMDBClient::GetInstance();
-        db.Initialize(GetDbPath(), 100, false);
+        KVStore& store = GetStore();
 
         if (pData->m_nNumParam >= 3 && pData->m_pParam[0] && pData->m_pParam[1] && pData->m_pParam[2])
         {
@@ -381,12 +781,14 @@ __declspec(dllexport) int WINAPI RESET_STATUS(DLLCALCINFO* pData)
             const char* p1_str = pData->m_pParam[0]->m_pszText;
             if (!p1_str) return -1;
 
+            // 排在前面的合并写必须先落库，否则会在清理之后被提交
+            store.Flush(std::chrono::milliseconds(GetTimeoutMs()));
+
             if (strcmp(p1_str, "block") == 0) {
-                db.DeleteKeys(STRING_BIT_PREFIX);
-                db.DeleteKeys("blk_size");
+                store.ResetBlocks();
             }
             else {
-                db.DeleteKeys(p1_str);
+                store.DeleteKeys(p1_str);
             }
         }
         return 1;
@@ -410,13 +812,12 @@ __declspec(dllexport) int WINAPI GET_KEY(DLLCALCINFO* pData)
 
             auto account_id_opt = ConfigManager::getStr("ths_account", acc_str);
             if (!account_id_opt) {
-                if (auto log = GetLogger()) log->error("ȡͬ˳ʽ˺ʧ: {}", acc_str);
+                if (auto log = GetLogger()) log->error("读取同花顺资金账号失败: {}", acc_str);
                 return 0;
             }
 
             std::string ths_acount_id = account_id_opt.value();
-            LMDBClient& db = LMDBClient::GetInstance();
-            db.Initialize(GetDbPath(), 100, false);
+            KVStore& db = GetStore();
 
       
             int key_int = (int)pData->m_pParam[0]->m_dSingleData;
@@ -458,15 +859,14 @@ __declspec(dllexport) int WINAPI ADD_KEY(DLLCALCINFO* pData)
 
             auto account_id_opt = ConfigManager::getStr("ths_account", acc_str);
             if (!account_id_opt) {
-                if (auto log = GetLogger()) log->error("ȡͬ˳ʽ˺ʧ: {}", acc_str);
+                if (auto log = GetLogger()) log->error("读取同花顺资金账号失败: {}", acc_str);
                 return 0;
             }
 
             std::string ths_acount_id = account_id_opt.value();
 
 
-            LMDBClient& db = LMDBClient::GetInstance();
-            db.Initialize(GetDbPath(), 100, false);
+            KVStore& db = GetStore();
 
             int key_int = (int)pData->m_pParam[0]->m_dSingleData;
 
@@ -483,7 +883,7 @@ __declspec(dllexport) int WINAPI ADD_KEY(DLLCALCINFO* pData)
             double value = (double)pData->m_pParam[1]->m_dSingleData;
 
             std::string parent = std::format("key:{}:", ths_acount_id);
-            db.AtomicIncrementDouble(parent + key, value);
+            db.IncrementDouble(parent + key, value);
         }
         return 1;
     }
@@ -508,15 +908,14 @@ __declspec(dllexport) int WINAPI SET_KEY(DLLCALCINFO* pData)
 
             auto account_id_opt = ConfigManager::getStr("ths_account", acc_str);
             if (!account_id_opt) {
-                if (auto log = GetLogger()) log->error("ȡͬ˳ʽ˺ʧ: {}", acc_str);
+                if (auto log = GetLogger()) log->error("读取同花顺资金账号失败: {}", acc_str);
                 return 0;
             }
 
             std::string ths_acount_id = account_id_opt.value();
 
 
-            LMDBClient& db = LMDBClient::GetInstance();
-            db.Initialize(GetDbPath(), 100, false);
+            KVStore& db = GetStore();
 
 
             int key_int = (int)pData->m_pParam[0]->m_dSingleData;
@@ -560,15 +959,14 @@ __declspec(dllexport) int WINAPI DEL_KEY(DLLCALCINFO* pData)
 
             auto account_id_opt = ConfigManager::getStr("ths_account", acc_str);
             if (!account_id_opt) {
-                if (auto log = GetLogger()) log->error("ȡͬ˳ʽ˺ʧ: {}", acc_str);
+                if (auto log = GetLogger()) log->error("读取同花顺资金账号失败: {}", acc_str);
                 return 0;
             }
 
             std::string ths_acount_id = account_id_opt.value();
 
 
-            LMDBClient& db = LMDBClient::GetInstance();
-            db.Initialize(GetDbPath(), 100, false);
+            KVStore& db = GetStore();
 
 
             int key_int = (int)pData->m_pParam[0]->m_dSingleData;
@@ -594,21 +992,145 @@ __declspec(dllexport) int WINAPI DEL_KEY(DLLCALCINFO* pData)
 
 }
 
+// GET_KEY 系列 key 的汇总：KEY_SUM / KEY_MIN / KEY_MAX / KEY_COUNT('前缀', '账号')
+// 对 "key:<资金账号>:<前缀>" 开头的全部 key 一次遍历，前缀为空时汇总该账号的全部 key；
+// 前缀为数字时与 GET_KEY 相同按整数转成文本。没有匹配的 key 时 KEY_MIN / KEY_MAX 返回无效值
+enum class KeyStat { Sum, Min, Max, Count };
+
+int KeyAggregate(DLLCALCINFO* pData, KeyStat stat) {
+    try {
+        if (!pData) return -1;
+        if (pData->m_nNumParam < 2 || !pData->m_pParam[0] || !pData->m_pParam[1]) return -1;
+
+        const char* acc_str = pData->m_pParam[1]->m_pszText;
+        if (!acc_str) return -1;
+        auto account_id_opt = ConfigManager::getStr("ths_account", acc_str);
+        if (!account_id_opt) {
+            if (auto log = GetLogger()) log->error("读取同花顺资金账号失败: {}", acc_str);
+            return 0;
+        }
+
+        const char* prefix_str = pData->m_pParam[0]->m_pszText;
+        std::string prefix = std::format("key:{}:", account_id_opt.value());
+        prefix += prefix_str ? std::string(prefix_str) : std::to_string((int)pData->m_pParam[0]->m_dSingleData);
+
+        KVStore::Aggregate aggregate;
+        if (!GetStore().AggregateDoubles(prefix, &aggregate)) return 0;
+
+        double result = 0;
+        switch (stat) {
+        case KeyStat::Sum: result = aggregate.sum; break;
+        case KeyStat::Min: result = aggregate.count > 0 ? aggregate.min : DBL_MAX; break;
+        case KeyStat::Max: result = aggregate.count > 0 ? aggregate.max : DBL_MAX; break;
+        case KeyStat::Count: result = static_cast<double>(aggregate.count); break;
+        }
+        pData->m_pResultBuf[pData->m_nNumData - 1] = result;
+        return 1;
+    }
+    catch (...) { return -1; }
+}
+
+__declspec(dllexport) int WINAPI KEY_SUM(DLLCALCINFO* pData)
+{
+    return KeyAggregate(pData, KeyStat::Sum);
+}
+
+__declspec(dllexport) int WINAPI KEY_MIN(DLLCALCINFO* pData)
+{
+    return KeyAggregate(pData, KeyStat::Min);
+}
+
+__declspec(dllexport) int WINAPI KEY_MAX(DLLCALCINFO* pData)
+{
+    return KeyAggregate(pData, KeyStat::Max);
+}
+
+__declspec(dllexport) int WINAPI KEY_COUNT(DLLCALCINFO* pData)
+{
+    return KeyAggregate(pData, KeyStat::Count);
+}
+
 __declspec(dllexport) int WINAPI GET_BLOCK_SIZE(DLLCALCINFO* pData)
 {
     try {
         if (!pData) return -1;
-        LMDBClient& db = LMDBClient::GetInstance();
-        db.Initialize(GetDbPath(), 100, false);
+        KVStore& blocks = GetStore();
 
         if (pData->m_nNumParam >= 1 && pData->m_pParam[0])
         {
             int key1 = (int)pData->m_pParam[0]->m_dSingleData;
-            int current_val = 0;
-            std::string parent = "blk_size:";
-            db.GetInt(parent + std::to_string(key1), &current_val);
-            pData->m_pResultBuf[pData->m_nNumData - 1] = current_val;
+            uint64_t current_val = key1 >= 0 ? blocks.BlockSize(static_cast<uint32_t>(key1)) : 0;
+            pData->m_pResultBuf[pData->m_nNumData - 1] = static_cast<double>(current_val);
+        }
+        return 1;
+    }
+    catch (...) { return -1; }
+}
+
+// 板块集合运算的参数：从 first 开始的每个参数都是板块号，任一缺失或为负返回 false
+bool ReadBlockIds(const DLLCALCINFO* pData, int first, std::vector<uint32_t>* block_ids) {
+    if (pData->m_nNumParam <= first) return false;
+    for (int i = first; i < pData->m_nNumParam && i < MAX_NUM_DLLPARAM; ++i) {
+        if (!pData->m_pParam[i]) return false;
+        int block_id = (int)pData->m_pParam[i]->m_dSingleData;
+        if (block_id < 0) return false;
+        block_ids->push_back(static_cast<uint32_t>(block_id));
+    }
+    return true;
+}
+
+int BlockSetSize(DLLCALCINFO* pData, BlockEngine::SetOp op) {
+    try {
+        if (!pData) return -1;
+        KVStore& blocks = GetStore();
+
+        std::vector<uint32_t> block_ids;
+        uint64_t size = ReadBlockIds(pData, 0, &block_ids) ? blocks.BlockCombinedSize(op, block_ids) : 0;
+        pData->m_pResultBuf[pData->m_nNumData - 1] = static_cast<double>(size);
+        return 1;
+    }
+    catch (...) { return -1; }
+}
+
+// 多个板块共同的股票数：BLOCK_INTER_SIZE(板块1, 板块2, ...)
+__declspec(dllexport) int WINAPI BLOCK_INTER_SIZE(DLLCALCINFO* pData)
+{
+    return BlockSetSize(pData, BlockEngine::SetOp::Intersect);
+}
+
+// 属于任一板块的股票数：BLOCK_UNION_SIZE(板块1, 板块2, ...)
+__declspec(dllexport) int WINAPI BLOCK_UNION_SIZE(DLLCALCINFO* pData)
+{
+    return BlockSetSize(pData, BlockEngine::SetOp::Union);
+}
+
+// 属于板块1 但不属于其余板块的股票数：BLOCK_DIFF_SIZE(板块1, 板块2, ...)
+__declspec(dllexport) int WINAPI BLOCK_DIFF_SIZE(DLLCALCINFO* pData)
+{
+    return BlockSetSize(pData, BlockEngine::SetOp::Difference);
+}
+
+// 列出板块运算结果：BLOCK_MEMBERS(op, 板块1, [板块2, ...])，op: 0 交集 1 并集 2 差集（只有一个板块时三者相同）
+// 成员按代码升序写入 m_pResultBuf[0..]（6 位数字代码即其数值），其余位置写无效值；
+// 成员多于 K 线数时截断，完整数量用 BLOCK_*_SIZE 取
+__declspec(dllexport) int WINAPI BLOCK_MEMBERS(DLLCALCINFO* pData)
+{
+    try {
+        if (!pData) return -1;
+        KVStore& blocks = GetStore();
+
+        int written = 0;
+        std::vector<uint32_t> block_ids;
+        if (pData->m_nNumParam >= 2 && pData->m_pParam[0] && ReadBlockIds(pData, 1, &block_ids)) {
+            int op = (int)pData->m_pParam[0]->m_dSingleData;
+            if (op >= 0 && op <= 2) {
+                BlockBitmap members = blocks.BlockCombine(static_cast<BlockEngine::SetOp>(op), block_ids);
+                members.ForEach([&](uint32_t stock_id) {
+                    if (written < pData->m_nNumData) pData->m_pResultBuf[written++] = static_cast<double>(stock_id);
+                    });
+            }
         }
+        for (int i = written; i < pData->m_nNumData; ++i) pData->m_pResultBuf[i] = DBL_MAX;
         return 1;
     }
     catch (...) { return -1; }
@@ -616,6 +1138,7 @@ __declspec(dllexport) int WINAPI GET_BLOCK_SIZE(DLLCALCINFO* pData)
 
 __declspec(dllexport) int WINAPI ASK_BID(DLLCALCINFO* pData)
 {
+    ExportTimer timer("ASK_BID");
     try {
         if (!pData || pData->m_dwHeadTag != YDDLL_HEADTAG) return -1;
 
@@ -629,12 +1152,17 @@ __declspec(dllexport) int WINAPI ASK_BID(DLLCALCINFO* pData)
             int DataType = (int)pData->m_pParam[2]->m_dSingleData;
 
             if (isEnable == 0) return -1;
+            if (TradeType != 1 && TradeType != 2) return 1;
+            if (DataType != 1 && DataType != 2) return 1;
 
-            ProtobufHttpClient::Config config{
-               .base_url = GetHttpBaseUrl(),
-               .timeout_ms = (long)GetTimeoutMs()
-            };
-            ProtobufHttpClient client(config);
+            if (UseEntrustsBook()) {
+                auto totals = EntrustsBook::GetInstance().Query(stock_code,
+                    TradeType == 1 ? EntrustsBook::kBuy : EntrustsBook::kSell);
+                pData->m_pResultBuf[pData->m_nNumData - 1] = (DataType == 1) ? totals.pending_vol : totals.pending_amount;
+                return 1;
+            }
+
+            ProtobufHttpClient client(GetHttpConfig(GetQueryTimeoutMs()));
 
             Entrusts entrusts;
             entrusts.set_stock_code(stock_code);
@@ -661,6 +1189,7 @@ __declspec(dllexport) int WINAPI ASK_BID(DLLCALCINFO* pData)
 
 __declspec(dllexport) int WINAPI TODAY_ENTRUSTS(DLLCALCINFO* pData)
 {
+    ExportTimer timer("TODAY_ENTRUSTS");
     try {
         if (!pData) return -1;
 
@@ -669,11 +1198,16 @@ __declspec(dllexport) int WINAPI TODAY_ENTRUSTS(DLLCALCINFO* pData)
             int TradeType = (int)pData->m_pParam[0]->m_dSingleData;
             int EntrustStatus = (int)pData->m_pParam[1]->m_dSingleData;
 
-            ProtobufHttpClient::Config config{
-               .base_url = GetHttpBaseUrl(),
-               .timeout_ms = (long)GetTimeoutMs()
-            };
-            ProtobufHttpClient client(config);
+            if ((TradeType == 1 || TradeType == 2) && UseEntrustsBook()) {
+                auto totals = EntrustsBook::GetInstance().QuerySide(
+                    TradeType == 1 ? EntrustsBook::kBuy : EntrustsBook::kSell);
+                if (EntrustStatus == 1) pData->m_pResultBuf[pData->m_nNumData - 1] = totals.entrusted_value;
+                else if (EntrustStatus == 2) pData->m_pResultBuf[pData->m_nNumData - 1] = totals.pending_amount;
+                else pData->m_pResultBuf[pData->m_nNumData - 1] = 0;
+                return 1;
+            }
+
+            ProtobufHttpClient client(GetHttpConfig(GetQueryTimeoutMs()));
 
             Entrusts entrusts;
             if (TradeType == 1) entrusts.set_trade_type("buy");
@@ -700,4 +1234,68 @@ __declspec(dllexport) int WINAPI TODAY_ENTRUSTS(DLLCALCINFO* pData)
         return 1;
     }
     catch (...) { return -1; }
-}
\ No newline at end of file
+}
+
+// 查询耗时分位数：LATENCY_STATS('key', stage, quantile, 1)
+// key 为 endpoint（如 '/place_order/amount'）或导出函数名（如 'AUTO_TRADE'）
+// stage: 0 export 1 queue 2 serialize 3 connect 4 first_byte 5 parse 6 callback 7 total
+// quantile: 50 / 99 / 99.9 表示 p50 / p99 / p999；结果单位为微秒，无数据时为 -1
+// 参数不全时把全部快照写入日志
+__declspec(dllexport) int WINAPI LATENCY_STATS(DLLCALCINFO* pData)
+{
+    try {
+        if (!pData) return -1;
+
+        LatencyMetrics& metrics = LatencyMetrics::GetInstance();
+        if (pData->m_nNumParam >= 3 && pData->m_pParam[0] && pData->m_pParam[1] && pData->m_pParam[2]
+            && pData->m_pParam[0]->m_pszText)
+        {
+            std::string key = pData->m_pParam[0]->m_pszText;
+            int stage = (int)pData->m_pParam[1]->m_dSingleData;
+            double quantile = pData->m_pParam[2]->m_dSingleData / 100.0;
+
+            uint64_t micros = 0;
+            bool found = stage >= 0 && stage < static_cast<int>(LatencyStage::Count)
+                && quantile > 0 && quantile <= 1
+                && metrics.Quantile(key, static_cast<LatencyStage>(stage), quantile, &micros);
+            pData->m_pResultBuf[pData->m_nNumData - 1] = found ? static_cast<double>(micros) : -1;
+            return 1;
+        }
+
+        std::string text = metrics.FormatSnapshot();
+        if (auto log = GetLogger()) log->info("[Latency]\n{}", text.empty() ? "no samples\n" : text);
+        pData->m_pResultBuf[pData->m_nNumData - 1] = 0;
+        return 1;
+    }
+    catch (...) {
+        if (auto log = GetLogger()) log->error("Unknown exception in LATENCY_STATS");
+        return -1;
+    }
+}
+
+// 关闭前排空：SHUTDOWN(timeout_ms, 1)，timeout_ms 不大于 0 时取 [http] timeout_ms
+// 把合批窗口里的委托发出，等已发出的请求、回调、合并写和 Redis 异步命令全部完成（顺序见 runtime_shutdown.h）
+// 易得卸载 DLL 时不会调用任何关闭入口，要在退出前（如收盘后的公式里）调用一次
+// 返回 1 表示全部排空，0 表示超时；之后交易和查询函数都会失败，直到重启易得
+__declspec(dllexport) int WINAPI SHUTDOWN(DLLCALCINFO* pData)
+{
+    try {
+        if (!pData) return -1;
+
+        long timeout_ms = 0;
+        if (pData->m_nNumParam >= 1 && pData->m_pParam[0]) {
+            timeout_ms = (long)pData->m_pParam[0]->m_dSingleData;
+        }
+        if (timeout_ms <= 0) timeout_ms = GetTimeoutMs();
+
+        bool drained = ShutdownRuntime(std::chrono::milliseconds(timeout_ms));
+        LogHttpStats(drained ? "[Shutdown] drained" : "[Shutdown] timed out");
+        if (auto log = GetLogger()) log->flush();
+        pData->m_pResultBuf[pData->m_nNumData - 1] = drained ? 1 : 0;
+        return 1;
+    }
+    catch (...) {
+        if (auto log = GetLogger()) log->error("Unknown exception in SHUTDOWN");
+        return -1;
+    }
+}
@@ -0,0 +1,163 @@
+﻿#include "bitset_kernels.h"
+#include <atomic>
+#include <bit>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define BITSET_HAVE_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define BITSET_HAVE_X86 0
+#endif
+
+// MSVC 不需要 /arch:AVX2 就能使用 AVX2 intrinsic；GCC / Clang 需要按函数打开
+#if BITSET_HAVE_X86 && (defined(__GNUC__) || defined(__clang__))
+#define BITSET_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define BITSET_TARGET_AVX2
+#endif
+
+namespace {
+
+// === 标量路径 ===
+
+template<BitOp Op>
+inline uint64_t Apply(uint64_t a, uint64_t b) {
+    if constexpr (Op == BitOp::And) return a & b;
+    else if constexpr (Op == BitOp::Or) return a | b;
+    else return a & ~b;
+}
+
+template<BitOp Op>
+uint64_t CombineScalar(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t words) {
+    uint64_t count = 0;
+    for (size_t i = 0; i < words; ++i) {
+        uint64_t value = Apply<Op>(a[i], b[i]);
+        if (out) out[i] = value;
+        count += static_cast<uint64_t>(std::popcount(value));
+    }
+    return count;
+}
+
+uint64_t PopcountScalar(const uint64_t* words, size_t count) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; ++i) total += static_cast<uint64_t>(std::popcount(words[i]));
+    return total;
+}
+
+// === AVX2 路径 ===
+
+#if BITSET_HAVE_X86
+
+bool CpuHasAvx2() {
+#if defined(_MSC_VER)
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    // 操作系统需要保存 YMM 寄存器（XCR0 的 bit 1、2）
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// 每个字节的 1 的个数：高低 4 位分别查表相加，再用 sad 横向累加成 4 个 64 位计数
+BITSET_TARGET_AVX2 inline __m256i Popcount256(__m256i v) {
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(v, low_mask);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+    return _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+}
+
+BITSET_TARGET_AVX2 inline uint64_t HorizontalSum(__m256i v) {
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+template<BitOp Op>
+BITSET_TARGET_AVX2 inline __m256i Apply256(__m256i a, __m256i b) {
+    if constexpr (Op == BitOp::And) return _mm256_and_si256(a, b);
+    else if constexpr (Op == BitOp::Or) return _mm256_or_si256(a, b);
+    else return _mm256_andnot_si256(b, a);
+}
+
+template<BitOp Op>
+BITSET_TARGET_AVX2 uint64_t CombineAvx2(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t words) {
+    __m256i total = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i value = Apply256<Op>(va, vb);
+        if (out) _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), value);
+        total = _mm256_add_epi64(total, Popcount256(value));
+    }
+    return HorizontalSum(total) + CombineScalar<Op>(a + i, b + i, out ? out + i : nullptr, words - i);
+}
+
+BITSET_TARGET_AVX2 uint64_t PopcountAvx2(const uint64_t* words, size_t count) {
+    __m256i total = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+        total = _mm256_add_epi64(total, Popcount256(value));
+    }
+    return HorizontalSum(total) + PopcountScalar(words + i, count - i);
+}
+
+#else
+
+bool CpuHasAvx2() { return false; }
+
+#endif
+
+const bool g_cpu_avx2 = CpuHasAvx2();
+std::atomic<bool> g_use_avx2{ g_cpu_avx2 };
+
+} // namespace
+
+bool BitsetSimdEnabled() {
+    return g_use_avx2.load(std::memory_order_relaxed);
+}
+
+void SetBitsetSimd(bool enabled) {
+    g_use_avx2.store(enabled && g_cpu_avx2, std::memory_order_relaxed);
+}
+
+uint64_t BitsetCombine(BitOp op, const uint64_t* a, const uint64_t* b, uint64_t* out, size_t words) {
+#if BITSET_HAVE_X86
+    if (BitsetSimdEnabled()) {
+        switch (op) {
+        case BitOp::And: return CombineAvx2<BitOp::And>(a, b, out, words);
+        case BitOp::Or: return CombineAvx2<BitOp::Or>(a, b, out, words);
+        case BitOp::AndNot: return CombineAvx2<BitOp::AndNot>(a, b, out, words);
+        }
+    }
+#endif
+    switch (op) {
+    case BitOp::And: return CombineScalar<BitOp::And>(a, b, out, words);
+    case BitOp::Or: return CombineScalar<BitOp::Or>(a, b, out, words);
+    case BitOp::AndNot: return CombineScalar<BitOp::AndNot>(a, b, out, words);
+    }
+    return 0;
+}
+
+uint64_t BitsetPopcount(const uint64_t* words, size_t count) {
+#if BITSET_HAVE_X86
+    if (BitsetSimdEnabled()) return PopcountAvx2(words, count);
+#endif
+    return PopcountScalar(words, count);
+}
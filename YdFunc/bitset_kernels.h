@@ -0,0 +1,19 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// 定长位集的批量运算，供 BlockBitmap 的位图容器使用
+// CPU 支持 AVX2 时每次处理 256 位：与 / 或 / 与非之后用查表法（pshufb）统计 1 的个数，
+// 否则逐个 64 位字用 std::popcount；两条路径结果相同
+enum class BitOp : uint8_t { And, Or, AndNot };
+
+// out[i] = a[i] op b[i]（AndNot 为 a & ~b），返回结果中 1 的个数
+// out 可以与 a 相同；为空时只计数，不写结果
+uint64_t BitsetCombine(BitOp op, const uint64_t* a, const uint64_t* b, uint64_t* out, size_t words);
+
+uint64_t BitsetPopcount(const uint64_t* words, size_t count);
+
+// 当前是否走 AVX2 路径；SetBitsetSimd(false) 强制走标量路径（CPU 不支持时设成 true 也无效）
+bool BitsetSimdEnabled();
+void SetBitsetSimd(bool enabled);
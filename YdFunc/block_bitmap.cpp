@@ -0,0 +1,367 @@
+﻿#include "block_bitmap.h"
+#include "bitset_kernels.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+
+namespace {
+
+constexpr uint32_t kMagic = 0x314D4252; // "RBM1"
+constexpr uint16_t kKindArray = 0;
+constexpr uint16_t kKindBitmap = 1;
+
+template<typename T>
+void AppendRaw(std::string* out, T value) {
+    out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template<typename T>
+bool ReadRaw(std::string_view* bytes, T* value) {
+    if (bytes->size() < sizeof(T)) return false;
+    std::memcpy(value, bytes->data(), sizeof(T));
+    bytes->remove_prefix(sizeof(T));
+    return true;
+}
+
+} // namespace
+
+unsigned BlockBitmap::CountTrailingZeros(uint64_t bits) {
+    return static_cast<unsigned>(std::countr_zero(bits));
+}
+
+BlockBitmap::Container* BlockBitmap::Find(uint16_t key) {
+    auto it = std::lower_bound(containers_.begin(), containers_.end(), key,
+        [](const Container& c, uint16_t k) { return c.key < k; });
+    return (it != containers_.end() && it->key == key) ? &*it : nullptr;
+}
+
+const BlockBitmap::Container* BlockBitmap::Find(uint16_t key) const {
+    return const_cast<BlockBitmap*>(this)->Find(key);
+}
+
+void BlockBitmap::ToBitmap(Container* container) {
+    container->bits.assign(kBitmapWords, 0);
+    for (uint16_t low : container->array) container->bits[low >> 6] |= uint64_t(1) << (low & 63);
+    container->array.clear();
+    container->array.shrink_to_fit();
+}
+
+void BlockBitmap::ToArray(Container* container) {
+    container->array.clear();
+    container->array.reserve(container->cardinality);
+    for (size_t word = 0; word < container->bits.size(); ++word) {
+        uint64_t bits = container->bits[word];
+        while (bits) {
+            container->array.push_back(static_cast<uint16_t>(word * 64 + CountTrailingZeros(bits)));
+            bits &= bits - 1;
+        }
+    }
+    container->bits.clear();
+    container->bits.shrink_to_fit();
+}
+
+void BlockBitmap::Normalize(Container* container) {
+    if (!container->bits.empty() && container->cardinality > 0 && container->cardinality <= kArrayMax) {
+        ToArray(container);
+    }
+}
+
+bool BlockBitmap::Add(uint32_t value) {
+    uint16_t key = static_cast<uint16_t>(value >> 16);
+    uint16_t low = static_cast<uint16_t>(value & 0xFFFF);
+
+    auto it = std::lower_bound(containers_.begin(), containers_.end(), key,
+        [](const Container& c, uint16_t k) { return c.key < k; });
+    if (it == containers_.end() || it->key != key) {
+        it = containers_.insert(it, Container());
+        it->key = key;
+    }
+
+    Container& container = *it;
+    if (!container.bits.empty()) {
+        uint64_t& word = container.bits[low >> 6];
+        uint64_t mask = uint64_t(1) << (low & 63);
+        if (word & mask) return false;
+        word |= mask;
+    }
+    else {
+        auto pos = std::lower_bound(container.array.begin(), container.array.end(), low);
+        if (pos != container.array.end() && *pos == low) return false;
+        container.array.insert(pos, low);
+        if (container.array.size() > kArrayMax) ToBitmap(&container);
+    }
+    ++container.cardinality;
+    ++cardinality_;
+    return true;
+}
+
+bool BlockBitmap::Remove(uint32_t value) {
+    uint16_t key = static_cast<uint16_t>(value >> 16);
+    uint16_t low = static_cast<uint16_t>(value & 0xFFFF);
+
+    Container* container = Find(key);
+    if (!container) return false;
+
+    if (!container->bits.empty()) {
+        uint64_t& word = container->bits[low >> 6];
+        uint64_t mask = uint64_t(1) << (low & 63);
+        if (!(word & mask)) return false;
+        word &= ~mask;
+    }
+    else {
+        auto pos = std::lower_bound(container->array.begin(), container->array.end(), low);
+        if (pos == container->array.end() || *pos != low) return false;
+        container->array.erase(pos);
+    }
+    --container->cardinality;
+    --cardinality_;
+
+    if (container->cardinality == 0) {
+        containers_.erase(containers_.begin() + (container - containers_.data()));
+    }
+    else if (!container->bits.empty() && container->cardinality <= kArrayMax) {
+        ToArray(container);
+    }
+    return true;
+}
+
+bool BlockBitmap::Contains(uint32_t value) const {
+    const Container* container = Find(static_cast<uint16_t>(value >> 16));
+    if (!container) return false;
+    uint16_t low = static_cast<uint16_t>(value & 0xFFFF);
+    if (!container->bits.empty()) return (container->bits[low >> 6] >> (low & 63)) & 1;
+    return std::binary_search(container->array.begin(), container->array.end(), low);
+}
+
+void BlockBitmap::Clear() {
+    containers_.clear();
+    cardinality_ = 0;
+}
+
+// === 集合运算 ===
+
+void BlockBitmap::RecountCardinality() {
+    containers_.erase(std::remove_if(containers_.begin(), containers_.end(),
+        [](const Container& c) { return c.cardinality == 0; }), containers_.end());
+    cardinality_ = 0;
+    for (const Container& c : containers_) cardinality_ += c.cardinality;
+}
+
+uint64_t BlockBitmap::AndCardinality(const Container& a, const Container& b) {
+    if (!a.bits.empty() && !b.bits.empty()) {
+        return BitsetCombine(BitOp::And, a.bits.data(), b.bits.data(), nullptr, kBitmapWords);
+    }
+    if (!a.bits.empty() || !b.bits.empty()) {
+        const Container& array = a.bits.empty() ? a : b;
+        const Container& bitmap = a.bits.empty() ? b : a;
+        uint64_t count = 0;
+        for (uint16_t low : array.array) count += TestBit(bitmap, low);
+        return count;
+    }
+    uint64_t count = 0;
+    auto x = a.array.begin();
+    auto y = b.array.begin();
+    while (x != a.array.end() && y != b.array.end()) {
+        if (*x < *y) ++x;
+        else if (*y < *x) ++y;
+        else { ++count; ++x; ++y; }
+    }
+    return count;
+}
+
+uint64_t BlockBitmap::AndCardinality(const BlockBitmap& a, const BlockBitmap& b) {
+    uint64_t count = 0;
+    auto x = a.containers_.begin();
+    auto y = b.containers_.begin();
+    while (x != a.containers_.end() && y != b.containers_.end()) {
+        if (x->key < y->key) ++x;
+        else if (y->key < x->key) ++y;
+        else count += AndCardinality(*x++, *y++);
+    }
+    return count;
+}
+
+void BlockBitmap::And(const BlockBitmap& other) {
+    auto y = other.containers_.begin();
+    for (Container& c : containers_) {
+        while (y != other.containers_.end() && y->key < c.key) ++y;
+        if (y == other.containers_.end() || y->key != c.key) {
+            c.cardinality = 0;
+            continue;
+        }
+        const Container& o = *y;
+        if (!c.bits.empty() && !o.bits.empty()) {
+            c.cardinality = static_cast<uint32_t>(
+                BitsetCombine(BitOp::And, c.bits.data(), o.bits.data(), c.bits.data(), kBitmapWords));
+            Normalize(&c);
+        }
+        else if (!c.bits.empty()) {
+            // 结果不会多于对方数组，直接生成数组容器
+            std::vector<uint16_t> result;
+            result.reserve(o.array.size());
+            for (uint16_t low : o.array) {
+                if (TestBit(c, low)) result.push_back(low);
+            }
+            c.bits.clear();
+            c.bits.shrink_to_fit();
+            c.array = std::move(result);
+            c.cardinality = static_cast<uint32_t>(c.array.size());
+        }
+        else if (!o.bits.empty()) {
+            std::erase_if(c.array, [&](uint16_t low) { return !TestBit(o, low); });
+            c.cardinality = static_cast<uint32_t>(c.array.size());
+        }
+        else {
+            std::vector<uint16_t> result;
+            std::set_intersection(c.array.begin(), c.array.end(), o.array.begin(), o.array.end(),
+                std::back_inserter(result));
+            c.array = std::move(result);
+            c.cardinality = static_cast<uint32_t>(c.array.size());
+        }
+    }
+    RecountCardinality();
+}
+
+void BlockBitmap::Or(const BlockBitmap& other) {
+    std::vector<Container> merged;
+    merged.reserve(containers_.size() + other.containers_.size());
+    auto x = containers_.begin();
+    auto y = other.containers_.begin();
+    while (x != containers_.end() || y != other.containers_.end()) {
+        if (y == other.containers_.end() || (x != containers_.end() && x->key < y->key)) {
+            merged.push_back(std::move(*x++));
+            continue;
+        }
+        if (x == containers_.end() || y->key < x->key) {
+            merged.push_back(*y++);
+            continue;
+        }
+
+        Container c = std::move(*x++);
+        const Container& o = *y++;
+        if (c.bits.empty() && o.bits.empty()) {
+            std::vector<uint16_t> result;
+            result.reserve(c.array.size() + o.array.size());
+            std::set_union(c.array.begin(), c.array.end(), o.array.begin(), o.array.end(),
+                std::back_inserter(result));
+            c.array = std::move(result);
+            c.cardinality = static_cast<uint32_t>(c.array.size());
+            if (c.cardinality > kArrayMax) ToBitmap(&c);
+        }
+        else {
+            if (c.bits.empty()) ToBitmap(&c);
+            if (!o.bits.empty()) {
+                c.cardinality = static_cast<uint32_t>(
+                    BitsetCombine(BitOp::Or, c.bits.data(), o.bits.data(), c.bits.data(), kBitmapWords));
+            }
+            else {
+                for (uint16_t low : o.array) c.bits[low >> 6] |= uint64_t(1) << (low & 63);
+                c.cardinality = static_cast<uint32_t>(BitsetPopcount(c.bits.data(), kBitmapWords));
+            }
+        }
+        merged.push_back(std::move(c));
+    }
+    containers_ = std::move(merged);
+    RecountCardinality();
+}
+
+void BlockBitmap::AndNot(const BlockBitmap& other) {
+    auto y = other.containers_.begin();
+    for (Container& c : containers_) {
+        while (y != other.containers_.end() && y->key < c.key) ++y;
+        if (y == other.containers_.end() || y->key != c.key) continue;
+        const Container& o = *y;
+        if (!c.bits.empty() && !o.bits.empty()) {
+            c.cardinality = static_cast<uint32_t>(
+                BitsetCombine(BitOp::AndNot, c.bits.data(), o.bits.data(), c.bits.data(), kBitmapWords));
+        }
+        else if (!c.bits.empty()) {
+            for (uint16_t low : o.array) {
+                uint64_t& word = c.bits[low >> 6];
+                uint64_t mask = uint64_t(1) << (low & 63);
+                if (word & mask) {
+                    word &= ~mask;
+                    --c.cardinality;
+                }
+            }
+        }
+        else if (!o.bits.empty()) {
+            std::erase_if(c.array, [&](uint16_t low) { return TestBit(o, low); });
+            c.cardinality = static_cast<uint32_t>(c.array.size());
+        }
+        else {
+            std::vector<uint16_t> result;
+            std::set_difference(c.array.begin(), c.array.end(), o.array.begin(), o.array.end(),
+                std::back_inserter(result));
+            c.array = std::move(result);
+            c.cardinality = static_cast<uint32_t>(c.array.size());
+        }
+        Normalize(&c);
+    }
+    RecountCardinality();
+}
+
+void BlockBitmap::Serialize(std::string* out) const {
+    out->clear();
+    size_t size = 8;
+    for (const Container& c : containers_) {
+        size += 8 + (c.bits.empty() ? c.array.size() * sizeof(uint16_t) : kBitmapWords * sizeof(uint64_t));
+    }
+    out->reserve(size);
+
+    AppendRaw(out, kMagic);
+    AppendRaw(out, static_cast<uint32_t>(containers_.size()));
+    for (const Container& c : containers_) {
+        AppendRaw(out, c.key);
+        AppendRaw(out, c.bits.empty() ? kKindArray : kKindBitmap);
+        AppendRaw(out, c.cardinality);
+        if (c.bits.empty()) {
+            out->append(reinterpret_cast<const char*>(c.array.data()), c.array.size() * sizeof(uint16_t));
+        }
+        else {
+            out->append(reinterpret_cast<const char*>(c.bits.data()), kBitmapWords * sizeof(uint64_t));
+        }
+    }
+}
+
+bool BlockBitmap::Deserialize(std::string_view bytes, BlockBitmap* out) {
+    uint32_t magic = 0;
+    uint32_t count = 0;
+    if (!ReadRaw(&bytes, &magic) || magic != kMagic || !ReadRaw(&bytes, &count)) return false;
+    if (count > 65536) return false;
+
+    BlockBitmap result;
+    result.containers_.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        Container c;
+        uint16_t kind = 0;
+        if (!ReadRaw(&bytes, &c.key) || !ReadRaw(&bytes, &kind) || !ReadRaw(&bytes, &c.cardinality)) return false;
+        if (!result.containers_.empty() && result.containers_.back().key >= c.key) return false;
+        if (c.cardinality == 0 || c.cardinality > 65536) return false;
+
+        if (kind == kKindArray) {
+            size_t length = c.cardinality * sizeof(uint16_t);
+            if (c.cardinality > kArrayMax || bytes.size() < length) return false;
+            c.array.resize(c.cardinality);
+            std::memcpy(c.array.data(), bytes.data(), length);
+            bytes.remove_prefix(length);
+        }
+        else if (kind == kKindBitmap) {
+            size_t length = kBitmapWords * sizeof(uint64_t);
+            if (bytes.size() < length) return false;
+            c.bits.resize(kBitmapWords);
+            std::memcpy(c.bits.data(), bytes.data(), length);
+            bytes.remove_prefix(length);
+        }
+        else {
+            return false;
+        }
+        result.cardinality_ += c.cardinality;
+        result.containers_.push_back(std::move(c));
+    }
+    if (!bytes.empty()) return false;
+
+    *out = std::move(result);
+    return true;
+}
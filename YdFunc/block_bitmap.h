@@ -0,0 +1,82 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 压缩位图（roaring 的做法）：按高 16 位分桶，每桶一个容器
+// 1. 桶内元素不超过 4096 个时用有序 uint16 数组，超过时转成 8KB 位图
+// 2. 股票代码（6 位数字）都落在前 16 个桶里，几千只股票的板块只有几 KB
+// 3. 集合运算按桶进行，位图与位图之间走 bitset_kernels（AVX2 / 标量）
+// 4. 序列化格式（小端）：u32 magic, u32 容器数，之后每个容器 u16 key, u16 kind, u32 基数, 数据
+class BlockBitmap {
+public:
+    bool Add(uint32_t value);      // 新加入返回 true
+    bool Remove(uint32_t value);   // 原来存在返回 true
+    bool Contains(uint32_t value) const;
+    uint64_t Cardinality() const { return cardinality_; }
+    bool Empty() const { return cardinality_ == 0; }
+    void Clear();
+
+    // === 集合运算，结果写回 *this ===
+    void And(const BlockBitmap& other);
+    void Or(const BlockBitmap& other);
+    void AndNot(const BlockBitmap& other);   // *this - other
+
+    // 交集的基数，不生成结果
+    static uint64_t AndCardinality(const BlockBitmap& a, const BlockBitmap& b);
+
+    void Serialize(std::string* out) const;
+    // 格式不对时返回 false，out 不变
+    static bool Deserialize(std::string_view bytes, BlockBitmap* out);
+
+    // 按从小到大的顺序回调每个元素
+    template<typename Fn>
+    void ForEach(Fn&& fn) const {
+        for (const Container& container : containers_) {
+            uint32_t high = static_cast<uint32_t>(container.key) << 16;
+            if (container.bits.empty()) {
+                for (uint16_t low : container.array) fn(high | low);
+                continue;
+            }
+            for (size_t word = 0; word < container.bits.size(); ++word) {
+                uint64_t bits = container.bits[word];
+                while (bits) {
+                    unsigned bit = CountTrailingZeros(bits);
+                    fn(high | static_cast<uint32_t>(word * 64 + bit));
+                    bits &= bits - 1;
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t kArrayMax = 4096;
+    static constexpr size_t kBitmapWords = 65536 / 64;
+
+    struct Container {
+        uint16_t key = 0;
+        uint32_t cardinality = 0;
+        std::vector<uint16_t> array;   // 数组容器
+        std::vector<uint64_t> bits;    // 位图容器（非空即为位图）
+    };
+
+    static unsigned CountTrailingZeros(uint64_t bits);
+
+    Container* Find(uint16_t key);
+    const Container* Find(uint16_t key) const;
+    static void ToBitmap(Container* container);
+    static void ToArray(Container* container);
+    // 位图容器运算后按新的基数决定是否转回数组
+    static void Normalize(Container* container);
+    static bool TestBit(const Container& bitmap, uint16_t low) {
+        return (bitmap.bits[low >> 6] >> (low & 63)) & 1;
+    }
+    static uint64_t AndCardinality(const Container& a, const Container& b);
+    void RecountCardinality();
+
+    std::vector<Container> containers_;  // 按 key 升序
+    uint64_t cardinality_ = 0;
+};
@@ -0,0 +1,234 @@
+﻿#include "block_engine.h"
+#include "LMDBClient.h"
+#include "write_combiner.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+const std::string kBlockPrefix = "blkmap:";
+// 旧格式：BLK_<代码> 的第 n 位表示属于板块 n，blk_size:<n> 为单独维护的计数
+const std::string kLegacyBitsPrefix = "BLK_";
+const std::string kLegacySizePrefix = "blk_size:";
+
+std::shared_ptr<const BlockBitmap> EmptyBitmap() {
+    static const std::shared_ptr<const BlockBitmap> empty = std::make_shared<const BlockBitmap>();
+    return empty;
+}
+
+} // namespace
+
+void BlockEngine::Configure(LMDBClient* db, WriteCombiner* writes) {
+    db_ = db;
+    writes_ = writes;
+    if (db_) MigrateLegacy();
+}
+
+uint32_t BlockEngine::StockId(std::string_view stock_code) {
+    if (stock_code.size() == 6) {
+        uint32_t value = 0;
+        bool numeric = true;
+        for (char c : stock_code) {
+            if (c < '0' || c > '9') { numeric = false; break; }
+            value = value * 10 + static_cast<uint32_t>(c - '0');
+        }
+        if (numeric) return value;
+    }
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (char c : stock_code) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return 0x80000000u | hash;
+}
+
+std::string BlockEngine::BlockKey(uint32_t block_id) {
+    return kBlockPrefix + std::to_string(block_id);
+}
+
+// === 读写 ===
+
+bool BlockEngine::Add(uint32_t block_id, std::string_view stock_code) {
+    if (!writes_) return false;
+    return writes_->UpdateBitmap(BlockKey(block_id), StockId(stock_code), true);
+}
+
+bool BlockEngine::Remove(uint32_t block_id, std::string_view stock_code) {
+    if (!writes_) return false;
+    return writes_->UpdateBitmap(BlockKey(block_id), StockId(stock_code), false);
+}
+
+bool BlockEngine::Contains(uint32_t block_id, std::string_view stock_code) {
+    return Load(block_id)->Contains(StockId(stock_code));
+}
+
+uint64_t BlockEngine::Size(uint32_t block_id) {
+    return Load(block_id)->Cardinality();
+}
+
+// === 集合运算 ===
+
+uint64_t BlockEngine::CombinedSize(SetOp op, std::span<const uint32_t> block_ids) {
+    if (block_ids.empty()) return 0;
+    if (block_ids.size() == 1) return Size(block_ids[0]);
+    std::vector<std::shared_ptr<const BlockBitmap>> bitmaps;
+    bitmaps.reserve(block_ids.size());
+    for (uint32_t block_id : block_ids) bitmaps.push_back(Load(block_id));
+    return CombinedSizeOf(op, bitmaps);
+}
+
+BlockBitmap BlockEngine::Combine(SetOp op, std::span<const uint32_t> block_ids) {
+    std::vector<std::shared_ptr<const BlockBitmap>> bitmaps;
+    bitmaps.reserve(block_ids.size());
+    for (uint32_t block_id : block_ids) bitmaps.push_back(Load(block_id));
+    return CombineBitmaps(op, std::move(bitmaps));
+}
+
+uint64_t BlockEngine::CombinedSizeOf(SetOp op, const std::vector<std::shared_ptr<const BlockBitmap>>& bitmaps) {
+    if (bitmaps.empty()) return 0;
+    if (bitmaps.size() == 1) return bitmaps[0]->Cardinality();
+    if (bitmaps.size() == 2) {
+        const BlockBitmap& a = *bitmaps[0];
+        const BlockBitmap& b = *bitmaps[1];
+        uint64_t both = BlockBitmap::AndCardinality(a, b);
+        switch (op) {
+        case SetOp::Intersect: return both;
+        case SetOp::Union: return a.Cardinality() + b.Cardinality() - both;
+        case SetOp::Difference: return a.Cardinality() - both;
+        }
+    }
+    return CombineBitmaps(op, bitmaps).Cardinality();
+}
+
+BlockBitmap BlockEngine::CombineBitmaps(SetOp op, std::vector<std::shared_ptr<const BlockBitmap>> bitmaps) {
+    if (bitmaps.empty()) return BlockBitmap();
+
+    auto by_size = [](const auto& x, const auto& y) { return x->Cardinality() < y->Cardinality(); };
+    if (op == SetOp::Intersect) {
+        // 从最小的板块开始，结果只会越来越小
+        std::sort(bitmaps.begin(), bitmaps.end(), by_size);
+    }
+    else if (op == SetOp::Union) {
+        // 从最大的板块开始，少搬动容器
+        std::sort(bitmaps.begin(), bitmaps.end(), [&](const auto& x, const auto& y) { return by_size(y, x); });
+    }
+
+    BlockBitmap result = *bitmaps[0];
+    for (size_t i = 1; i < bitmaps.size(); ++i) {
+        if (op != SetOp::Union && result.Empty()) break;
+        switch (op) {
+        case SetOp::Intersect: result.And(*bitmaps[i]); break;
+        case SetOp::Union: result.Or(*bitmaps[i]); break;
+        case SetOp::Difference: result.AndNot(*bitmaps[i]); break;
+        }
+    }
+    return result;
+}
+
+std::shared_ptr<const BlockBitmap> BlockEngine::Load(uint32_t block_id) {
+    if (!db_) return EmptyBitmap();
+    std::string key = BlockKey(block_id);
+
+    // 本线程还有未提交的变更：按叠加后的值现算，不进镜像
+    if (writes_ && writes_->HasPending(key)) {
+        std::string raw;
+        auto bitmap = std::make_shared<BlockBitmap>();
+        if (writes_->Get(key, &raw)) BlockBitmap::Deserialize(raw, bitmap.get());
+        return bitmap;
+    }
+
+    uint64_t last = db_->LastTxnId();
+    {
+        std::shared_lock<std::shared_mutex> lock(mirror_mutex_);
+        auto it = mirror_.find(block_id);
+        if (it != mirror_.end() && it->second.txn_id == last) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second.bitmap;
+        }
+    }
+
+    Entry entry;
+    {
+        LMDBClient::ReadScope scope(*db_);
+        if (!scope.ok()) return EmptyBitmap();
+        entry.txn_id = scope.TxnId();
+        std::string_view raw;
+        auto bitmap = std::make_shared<BlockBitmap>();
+        if (scope.Get(key, &raw)) BlockBitmap::Deserialize(raw, bitmap.get());
+        entry.bitmap = std::move(bitmap);
+    }
+    reloads_.fetch_add(1, std::memory_order_relaxed);
+
+    std::unique_lock<std::shared_mutex> lock(mirror_mutex_);
+    Entry& slot = mirror_[block_id];
+    // 并发加载时保留较新的快照
+    if (!slot.bitmap || slot.txn_id <= entry.txn_id) slot = entry;
+    return entry.bitmap;
+}
+
+bool BlockEngine::Reset() {
+    if (!db_) return false;
+    bool ok = db_->DeleteKeys(kBlockPrefix);
+    ok = db_->DeleteKeys(kLegacyBitsPrefix) && ok;
+    ok = db_->DeleteKeys(kLegacySizePrefix) && ok;
+
+    std::unique_lock<std::shared_mutex> lock(mirror_mutex_);
+    mirror_.clear();
+    return ok;
+}
+
+// === 旧格式迁移 ===
+
+void BlockEngine::MigrateLegacy() {
+    std::map<uint32_t, BlockBitmap> blocks;
+    uint64_t members = 0;
+    {
+        LMDBClient::ReadScope scope(*db_);
+        if (!scope.ok()) return;
+        for (const auto& [code, bits] : scope.Prefix(kLegacyBitsPrefix)) {
+            uint32_t stock = StockId(code);
+            for (size_t byte = 0; byte < bits.size(); ++byte) {
+                unsigned char value = static_cast<unsigned char>(bits[byte]);
+                for (int bit = 0; bit < 8; ++bit) {
+                    if (!((value >> bit) & 1)) continue;
+                    uint32_t block_id = static_cast<uint32_t>(byte * 8 + bit);
+                    auto [it, inserted] = blocks.try_emplace(block_id);
+                    std::string_view existing;
+                    // 与已有的位图合并：上次迁移中途失败时旧 key 还在，重复执行结果相同
+                    if (inserted && scope.Get(BlockKey(block_id), &existing)) BlockBitmap::Deserialize(existing, &it->second);
+                    if (it->second.Add(stock)) ++members;
+                }
+            }
+        }
+    }
+    if (blocks.empty()) return;
+
+    std::vector<LMDBClient::Mutation> mutations;
+    mutations.reserve(blocks.size());
+    for (const auto& [block_id, bitmap] : blocks) {
+        LMDBClient::Mutation mutation;
+        mutation.op = LMDBClient::Mutation::Op::Put;
+        mutation.key = BlockKey(block_id);
+        bitmap.Serialize(&mutation.value);
+        mutations.push_back(std::move(mutation));
+    }
+    if (!db_->ApplyMutations(mutations)) return;
+    migrated_.fetch_add(members, std::memory_order_relaxed);
+    db_->DeleteKeys(kLegacyBitsPrefix);
+    db_->DeleteKeys(kLegacySizePrefix);
+}
+
+BlockEngine::Stats BlockEngine::GetStats() const {
+    Stats stats;
+    {
+        std::shared_lock<std::shared_mutex> lock(mirror_mutex_);
+        stats.blocks = mirror_.size();
+    }
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.reloads = reloads_.load(std::memory_order_relaxed);
+    stats.migrated = migrated_.load(std::memory_order_relaxed);
+    return stats;
+}
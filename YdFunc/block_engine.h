@@ -0,0 +1,95 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "block_bitmap.h"
+
+class LMDBClient;
+class WriteCombiner;
+
+// 板块成员引擎：每个板块一张压缩位图（blkmap:<板块号>），成员为股票编号
+// 1. 板块号不再受 MAX_BIT_INDEX 限制，0 ~ 999999999 均可
+// 2. 板块大小直接取位图基数，重复加入不会让计数漂移
+// 3. 查询走内存镜像：每个板块记下加载时的 LMDB 事务号，库里有新提交（本进程或其他进程）时才重新加载
+// 4. 本线程还在合并写队列里的变更通过 WriteCombiner 读出，保证读己之写
+// 5. 多个板块的交 / 并 / 差直接在位图上算，不再逐只股票调用 IS_IN_BLOCK
+class BlockEngine {
+public:
+    enum class SetOp : uint8_t {
+        Intersect,   // 全部板块的交集
+        Union,       // 并集
+        Difference,  // 第一个板块减去其余板块
+    };
+
+    struct Stats {
+        size_t blocks = 0;        // 镜像中的板块数
+        uint64_t hits = 0;
+        uint64_t reloads = 0;     // 因事务号变化重新加载
+        uint64_t migrated = 0;    // 从旧 BLK_ 位串迁移的成员数
+    };
+
+    BlockEngine(const BlockEngine&) = delete;
+    BlockEngine& operator=(const BlockEngine&) = delete;
+
+    static BlockEngine& GetInstance() {
+        static BlockEngine instance;
+        return instance;
+    }
+
+    // 必须在第一次读写之前调用；db 需已 Initialize
+    // 库里还有旧格式的 BLK_ / blk_size: key 时合并进位图后删除（重复执行结果相同）
+    void Configure(LMDBClient* db, WriteCombiner* writes);
+
+    // 6 位数字代码直接用数值，其他代码取哈希并置最高位，不与数字代码冲突
+    static uint32_t StockId(std::string_view stock_code);
+
+    bool Add(uint32_t block_id, std::string_view stock_code);
+    bool Remove(uint32_t block_id, std::string_view stock_code);
+    bool Contains(uint32_t block_id, std::string_view stock_code);
+    uint64_t Size(uint32_t block_id);
+
+    // 两个板块时只计数不生成结果；block_ids 为空返回 0
+    uint64_t CombinedSize(SetOp op, std::span<const uint32_t> block_ids);
+    // 运算结果，成员为 StockId
+    BlockBitmap Combine(SetOp op, std::span<const uint32_t> block_ids);
+
+    // 上面两个函数的运算部分，输入为已加载的位图（Redis 后端从本地缓存取位图后也用它）
+    static uint64_t CombinedSizeOf(SetOp op, const std::vector<std::shared_ptr<const BlockBitmap>>& bitmaps);
+    static BlockBitmap CombineBitmaps(SetOp op, std::vector<std::shared_ptr<const BlockBitmap>> bitmaps);
+
+    // 清空全部板块（包括旧格式的 key）；调用方先 Flush 合并写队列
+    bool Reset();
+
+    Stats GetStats() const;
+
+private:
+    BlockEngine() = default;
+
+    struct Entry {
+        uint64_t txn_id = 0;
+        std::shared_ptr<const BlockBitmap> bitmap;
+    };
+
+    static std::string BlockKey(uint32_t block_id);
+
+    // 取板块当前的位图；不存在时返回空位图
+    std::shared_ptr<const BlockBitmap> Load(uint32_t block_id);
+    void MigrateLegacy();
+
+    LMDBClient* db_ = nullptr;
+    WriteCombiner* writes_ = nullptr;
+
+    mutable std::shared_mutex mirror_mutex_;
+    std::unordered_map<uint32_t, Entry> mirror_;
+
+    std::atomic<uint64_t> hits_{ 0 };
+    std::atomic<uint64_t> reloads_{ 0 };
+    std::atomic<uint64_t> migrated_{ 0 };
+};
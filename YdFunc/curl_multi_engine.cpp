@@ -0,0 +1,297 @@
+﻿#include "curl_multi_engine.h"
+#include "curl_transport.h"
+#include "mpsc_queue.h"
+#include <curl/curl.h>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+struct CurlMultiEngine::Transfer {
+    Request request;
+    Completion done;
+    std::string response;
+    CURL* easy = nullptr;
+    std::chrono::steady_clock::time_point submitted_at;
+    std::chrono::steady_clock::time_point started_at;
+};
+
+struct CurlMultiEngine::State {
+    CURLM* multi = nullptr;
+    MpscQueue<Transfer*> incoming;
+    // 已完成请求归还的 easy handle，reset 后复用
+    std::vector<CURL*> idle_handles;
+    // ordering_key -> 排在传输中请求后面的请求；key 存在即表示该 key 有请求在传输
+    std::unordered_map<std::string, std::deque<Transfer*>> ordered;
+};
+
+namespace {
+
+size_t WriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+    auto* buffer = static_cast<std::string*>(userp);
+    buffer->append(static_cast<char*>(contents), size * nmemb);
+    return size * nmemb;
+}
+
+// 失败的传输是否可能已经把请求发出去；要在 curl_easy_reset 之前调用
+MessageTransport::SendPhase PhaseOf(CURLcode code, CURL* curl) {
+    using SendPhase = MessageTransport::SendPhase;
+    switch (code) {
+    case CURLE_FAILED_INIT:
+    case CURLE_COULDNT_RESOLVE_PROXY:
+    case CURLE_COULDNT_RESOLVE_HOST:
+    case CURLE_COULDNT_CONNECT:
+        return SendPhase::NotSent;
+    case CURLE_OPERATION_TIMEDOUT: {
+        // 建连（含 TLS 握手）阶段就超时的，PRETRANSFER 还没有记录，请求一个字节都没发
+        curl_off_t pretransfer_us = 0;
+        if (curl && curl_easy_getinfo(curl, CURLINFO_PRETRANSFER_TIME_T, &pretransfer_us) == CURLE_OK
+            && pretransfer_us == 0) {
+            return SendPhase::NotSent;
+        }
+        return SendPhase::MaybeSent;
+    }
+    default:
+        return SendPhase::MaybeSent;
+    }
+}
+
+} // namespace
+
+CurlMultiEngine::~CurlMultiEngine() {
+    // 与 OrderExecutor 相同：析构处于 loader lock 下，只通知 I/O 线程退出并 detach
+    Stop(std::chrono::milliseconds(0));
+}
+
+void CurlMultiEngine::Configure(size_t max_pending, long max_host_connections) {
+    if (state_) return;
+    if (max_pending > 0) max_pending_ = max_pending;
+    if (max_host_connections > 0) max_host_connections_ = max_host_connections;
+}
+
+void CurlMultiEngine::EnsureStarted() {
+    std::call_once(start_flag_, [this]() {
+        CurlTransport::GetInstance(); // curl_global_init
+
+        state_ = new State();
+        state_->multi = curl_multi_init();
+        if (state_->multi) {
+            // 请求数超过连接上限时由 curl 内部排队，不会耗尽本机端口
+            curl_multi_setopt(state_->multi, CURLMOPT_MAX_HOST_CONNECTIONS, max_host_connections_);
+            curl_multi_setopt(state_->multi, CURLMOPT_MAXCONNECTS, max_host_connections_);
+
+            io_running_ = true;
+            io_thread_ = std::thread(&CurlMultiEngine::IoLoop, this);
+        }
+        });
+}
+
+bool CurlMultiEngine::Submit(Request request, Completion done) {
+    if (!done || !accepting_.load(std::memory_order_acquire)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    EnsureStarted();
+    if (!state_->multi) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    size_t pending = pending_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (pending > max_pending_) {
+        pending_.fetch_sub(1, std::memory_order_acq_rel);
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto* transfer = new Transfer();
+    transfer->request = std::move(request);
+    transfer->done = std::move(done);
+    transfer->submitted_at = std::chrono::steady_clock::now();
+
+    state_->incoming.Push(transfer);
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+    curl_multi_wakeup(state_->multi);
+    return true;
+}
+
+void CurlMultiEngine::IoLoop() {
+    CURLM* multi = state_->multi;
+
+    while (!stopping_.load(std::memory_order_acquire)) {
+        Transfer* transfer = nullptr;
+        while (state_->incoming.Pop(transfer)) {
+            Admit(transfer);
+        }
+
+        int running = 0;
+        curl_multi_perform(multi, &running);
+
+        int left = 0;
+        while (CURLMsg* msg = curl_multi_info_read(multi, &left)) {
+            if (msg->msg != CURLMSG_DONE) continue;
+            Transfer* done = nullptr;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, reinterpret_cast<char**>(&done));
+            if (done) Finish(done, msg->data.result);
+        }
+
+        // 无事可做时阻塞等待 socket 事件或 Submit 唤醒
+        curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+    }
+
+    io_running_.store(false, std::memory_order_release);
+}
+
+void CurlMultiEngine::Admit(Transfer* transfer) {
+    const std::string& key = transfer->request.ordering_key;
+    if (!key.empty()) {
+        auto it = state_->ordered.find(key);
+        if (it != state_->ordered.end()) {
+            it->second.push_back(transfer);
+            return;
+        }
+        state_->ordered.emplace(key, std::deque<Transfer*>());
+    }
+    Start(transfer);
+}
+
+void CurlMultiEngine::Start(Transfer* transfer) {
+    CURL* curl = nullptr;
+    if (!state_->idle_handles.empty()) {
+        curl = state_->idle_handles.back();
+        state_->idle_handles.pop_back();
+    }
+    else {
+        curl = curl_easy_init();
+    }
+    if (!curl) {
+        Finish(transfer, CURLE_FAILED_INIT);
+        return;
+    }
+
+    const Request& req = transfer->request;
+    CurlTransport& transport = CurlTransport::GetInstance();
+    transport.PrepareHandle(curl, req.timeout_ms);
+
+    curl_easy_setopt(curl, CURLOPT_URL, req.url.c_str());
+    if (!req.unix_socket_path.empty()) {
+        // 连接走 AF_UNIX，URL 里的主机名只用于 Host 头
+        curl_easy_setopt(curl, CURLOPT_UNIX_SOCKET_PATH, req.unix_socket_path.c_str());
+    }
+    curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, req.method.c_str());
+    if (req.method != "GET") {
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, req.body.data());
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, (long)req.body.size());
+    }
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, transport.ProtobufHeaders());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    if (!req.ca_cert_path.empty()) {
+        curl_easy_setopt(curl, CURLOPT_CAINFO, req.ca_cert_path.c_str());
+    }
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, &WriteCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &transfer->response);
+    curl_easy_setopt(curl, CURLOPT_PRIVATE, transfer);
+
+    if (curl_multi_add_handle(state_->multi, curl) != CURLM_OK) {
+        curl_easy_reset(curl);
+        state_->idle_handles.push_back(curl);
+        Finish(transfer, CURLE_FAILED_INIT);
+        return;
+    }
+    transfer->easy = curl;
+    transfer->started_at = std::chrono::steady_clock::now();
+    in_flight_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CurlMultiEngine::Finish(Transfer* transfer, int curl_code) {
+    Result result;
+    result.ok = (curl_code == CURLE_OK);
+    if (!result.ok) {
+        result.error = curl_easy_strerror(static_cast<CURLcode>(curl_code));
+        result.phase = PhaseOf(static_cast<CURLcode>(curl_code), transfer->easy);
+    }
+
+    if (CURL* curl = transfer->easy) {
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &result.http_code);
+        result.queue_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            transfer->started_at - transfer->submitted_at).count();
+        // curl 的时间点都从传输开始算，首字节减去建连才是服务端处理 + 传输
+        curl_off_t connect_us = 0;
+        curl_off_t first_byte_us = 0;
+        if (curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME_T, &connect_us) == CURLE_OK) {
+            result.connect_us = connect_us;
+        }
+        if (curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &first_byte_us) == CURLE_OK && first_byte_us > 0) {
+            result.first_byte_us = first_byte_us - (connect_us > 0 ? connect_us : 0);
+        }
+        curl_multi_remove_handle(state_->multi, curl);
+        curl_easy_reset(curl);
+        state_->idle_handles.push_back(curl);
+        in_flight_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    result.body = std::move(transfer->response);
+
+    // 同 key 的下一个请求出队
+    const std::string& key = transfer->request.ordering_key;
+    if (!key.empty()) {
+        auto it = state_->ordered.find(key);
+        if (it != state_->ordered.end()) {
+            if (it->second.empty()) {
+                state_->ordered.erase(it);
+            }
+            else {
+                Transfer* next = it->second.front();
+                it->second.pop_front();
+                Start(next);
+            }
+        }
+    }
+
+    try {
+        transfer->done(result);
+    }
+    catch (...) {
+        // 回调异常不能打断 I/O 线程
+    }
+    delete transfer;
+
+    completed_.fetch_add(1, std::memory_order_relaxed);
+    pending_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool CurlMultiEngine::Drain(std::chrono::milliseconds timeout) {
+    accepting_.store(false, std::memory_order_release);
+    if (!state_) return true;
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (pending_.load(std::memory_order_acquire) > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    bool drained = pending_.load(std::memory_order_acquire) == 0;
+
+    Stop(std::chrono::milliseconds(200));
+    return drained;
+}
+
+void CurlMultiEngine::Stop(std::chrono::milliseconds grace) {
+    if (stopping_.exchange(true, std::memory_order_acq_rel)) return;
+    if (!state_) return;
+
+    if (state_->multi) curl_multi_wakeup(state_->multi);
+
+    // 析构时处于 loader lock 下，不能 join；I/O 线程退出后 multi 句柄随进程回收
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (io_running_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (io_thread_.joinable()) io_thread_.detach();
+}
+
+CurlMultiEngine::Stats CurlMultiEngine::GetStats() const {
+    Stats stats;
+    stats.pending = pending_.load(std::memory_order_relaxed);
+    stats.in_flight = in_flight_.load(std::memory_order_relaxed);
+    stats.submitted = submitted_.load(std::memory_order_relaxed);
+    stats.completed = completed_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    return stats;
+}
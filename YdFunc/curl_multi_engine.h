@@ -0,0 +1,68 @@
+﻿#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "message_transport.h"
+
+// 单 I/O 线程的 curl_multi 引擎，tcp / unix 两种传输都在这里多路复用
+// 1. 任何线程都可以 Submit，请求通过无锁队列交给 I/O 线程，curl_multi_wakeup 唤醒
+// 2. ordering_key 相同的请求串行发送（前一个完成才发下一个），保证同一只股票的委托顺序
+// 3. 完成回调在 I/O 线程上执行，必须很轻；解析和业务回调应转交给其他线程
+class CurlMultiEngine : public MessageTransport {
+public:
+    CurlMultiEngine(const CurlMultiEngine&) = delete;
+    CurlMultiEngine& operator=(const CurlMultiEngine&) = delete;
+
+    static CurlMultiEngine& GetInstance() {
+        static CurlMultiEngine instance;
+        return instance;
+    }
+
+    // 必须在第一次 Submit 之前调用
+    // max_pending: 未完成请求上限；max_host_connections: 到后端的最大并发连接数
+    void Configure(size_t max_pending, long max_host_connections);
+
+    bool Submit(Request request, Completion done) override;
+    bool Drain(std::chrono::milliseconds timeout) override;
+    Stats GetStats() const override;
+    const char* Name() const override { return "curl"; }
+
+private:
+    CurlMultiEngine() = default;
+    ~CurlMultiEngine();
+
+    struct State;
+    struct Transfer;
+
+    void EnsureStarted();
+    void Stop(std::chrono::milliseconds grace);
+
+    // 以下只在 I/O 线程上调用
+    void IoLoop();
+    void Admit(Transfer* transfer);
+    void Start(Transfer* transfer);
+    void Finish(Transfer* transfer, int curl_code);
+
+    size_t max_pending_ = 4096;
+    long max_host_connections_ = 32;
+
+    std::once_flag start_flag_;
+    State* state_ = nullptr;   // I/O 线程私有数据，定义在 cpp 中，避免头文件依赖 curl
+    std::thread io_thread_;
+
+    std::atomic<bool> accepting_{ true };
+    std::atomic<bool> stopping_{ false };
+    std::atomic<bool> io_running_{ false };
+
+    std::atomic<size_t> pending_{ 0 };
+    std::atomic<size_t> in_flight_{ 0 };
+    std::atomic<uint64_t> submitted_{ 0 };
+    std::atomic<uint64_t> completed_{ 0 };
+    std::atomic<uint64_t> rejected_{ 0 };
+};
@@ -0,0 +1,53 @@
+﻿#include "curl_transport.h"
+
+CurlTransport::CurlTransport() {
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    share_ = curl_share_init();
+    if (share_) {
+        curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, &CurlTransport::LockCallback);
+        curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, &CurlTransport::UnlockCallback);
+        curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+
+    protobuf_headers_ = curl_slist_append(protobuf_headers_, "Content-Type: application/protobuf");
+    protobuf_headers_ = curl_slist_append(protobuf_headers_, "Accept: application/protobuf");
+    // 禁止 Expect: 100-continue，省掉一次等待
+    protobuf_headers_ = curl_slist_append(protobuf_headers_, "Expect:");
+}
+
+CurlTransport::~CurlTransport() {
+    if (protobuf_headers_) curl_slist_free_all(protobuf_headers_);
+    // 仍有线程持有 handle 时 cleanup 会返回 CURLSHE_IN_USE，进程退出时忽略即可
+    if (share_) curl_share_cleanup(share_);
+}
+
+void CurlTransport::LockCallback(CURL*, curl_lock_data data, curl_lock_access, void* userptr) {
+    auto* self = static_cast<CurlTransport*>(userptr);
+    self->locks_[data].lock();
+}
+
+void CurlTransport::UnlockCallback(CURL*, curl_lock_data data, void* userptr) {
+    auto* self = static_cast<CurlTransport*>(userptr);
+    self->locks_[data].unlock();
+}
+
+void CurlTransport::PrepareHandle(CURL* curl, long timeout_ms) const {
+    if (share_) {
+        curl_easy_setopt(curl, CURLOPT_SHARE, share_);
+    }
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, timeout_ms);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+    // 长连接：开启 TCP keep-alive，关闭 Nagle
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPIDLE, 30L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPINTVL, 10L);
+    curl_easy_setopt(curl, CURLOPT_TCP_NODELAY, 1L);
+
+    // 本机后端地址不会变，DNS 结果缓存久一点
+    curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, 600L);
+}
@@ -0,0 +1,37 @@
+﻿#pragma once
+
+#include <curl/curl.h>
+#include <mutex>
+#include <string>
+
+// 进程级 CURL 传输层
+// 1. curl_global_init 只做一次
+// 2. 通过 CURLSH 在所有 easy handle 之间共享 DNS / 连接池 / TLS 会话缓存
+// 3. easy handle 由 CurlMultiEngine 统一持有和复用
+class CurlTransport {
+public:
+    CurlTransport(const CurlTransport&) = delete;
+    CurlTransport& operator=(const CurlTransport&) = delete;
+
+    static CurlTransport& GetInstance() {
+        static CurlTransport instance;
+        return instance;
+    }
+
+    // 对 handle 设置公共参数，curl_easy_reset 之后必须重新调用
+    void PrepareHandle(CURL* curl, long timeout_ms) const;
+
+    // protobuf 请求公用的 HTTP 头，只构造一次
+    curl_slist* ProtobufHeaders() const { return protobuf_headers_; }
+
+private:
+    CurlTransport();
+    ~CurlTransport();
+
+    static void LockCallback(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void UnlockCallback(CURL* handle, curl_lock_data data, void* userptr);
+
+    CURLSH* share_ = nullptr;
+    curl_slist* protobuf_headers_ = nullptr;
+    std::mutex locks_[CURL_LOCK_DATA_LAST];
+};
@@ -1,4 +1,4 @@
-// dllmain.cpp :  DLL Ӧóڵ㡣
+// dllmain.cpp : 定义 DLL 应用程序的入口点。
 #include "stdafx.h"
 #pragma comment(lib, "crypt32.lib")
 #pragma comment(lib, "iphlpapi.lib")
@@ -12,6 +12,16 @@ BOOL APIENTRY DllMain( HMODULE hModule,
 	switch (ul_reason_for_call)
 	{
 	case DLL_PROCESS_ATTACH:
+		// 固定模块，FreeLibrary 不再卸载本 DLL：
+		// 发送、合并写、订阅等后台线程只在进程退出时随进程结束，不会在代码被卸载后继续执行。
+		// DllMain 里既不能 join 也等不到这些线程退出，易得也不会在卸载前调用任何关闭入口，所以这里不做排空；
+		// 需要排空时在退出前调用导出函数 SHUTDOWN（见 runtime_shutdown.h），否则尚未发出的委托和尚未提交的合并写随进程丢弃。
+		{
+			HMODULE pinned = NULL;
+			GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_PIN,
+				reinterpret_cast<LPCWSTR>(&DllMain), &pinned);
+		}
+		break;
 	case DLL_THREAD_ATTACH:
 	case DLL_THREAD_DETACH:
 	case DLL_PROCESS_DETACH:
@@ -19,4 +29,3 @@ BOOL APIENTRY DllMain( HMODULE hModule,
 	}
 	return TRUE;
 }
-
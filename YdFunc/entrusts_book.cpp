@@ -0,0 +1,242 @@
+﻿#include "entrusts_book.h"
+#include "order_executor.h"
+#include <cctype>
+
+namespace {
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// xtconstant 委托状态
+constexpr int kOrderPartCancel = 53;   // 部成已撤
+constexpr int kOrderCanceled = 54;     // 已撤
+constexpr int kOrderJunk = 57;         // 废单
+
+} // namespace
+
+void EntrustsBook::Configure(const ProtobufHttpClient::Config& http, const std::string& orders_endpoint, int resync_s) {
+    if (refreshing_.load(std::memory_order_acquire) || Ready()) return;
+    http_ = http;
+    if (!orders_endpoint.empty()) orders_endpoint_ = orders_endpoint;
+    resync_interval_ = std::chrono::seconds(resync_s > 0 ? resync_s : 0);
+}
+
+std::string EntrustsBook::NormalizeCode(std::string_view stock_code) {
+    std::string digits;
+    digits.reserve(stock_code.size());
+    for (char c : stock_code) {
+        if (std::isdigit(static_cast<unsigned char>(c))) digits.push_back(c);
+    }
+    if (digits.size() > 6) digits.erase(0, digits.size() - 6);
+    return digits;
+}
+
+// 未报 / 待报 / 已报 / 已报待撤 / 部成待撤 / 部成
+bool EntrustsBook::IsPending(int status) {
+    return (status >= 48 && status <= 52) || status == 55;
+}
+
+// 未报 → 待报 → 已报 → 已报待撤 / 部成 → 部成待撤 → 已结束（部撤、已撤、已成、废单）
+// 撤单被拒时实际会从待撤回到已报 / 部成，这里仍按待撤处理：两者都是挂单，汇总值一样
+// 未知状态（255 等）排在最前，不覆盖任何已知状态
+int EntrustsBook::StatusRank(int status) {
+    switch (status) {
+    case 48: return 1;   // 未报
+    case 49: return 2;   // 待报
+    case 50: return 3;   // 已报
+    case 51: return 4;   // 已报待撤
+    case 55: return 4;   // 部成
+    case 52: return 5;   // 部成待撤
+    case 53:             // 部成已撤
+    case 54:             // 已撤
+    case 56:             // 已成
+    case 57:             // 废单
+        return 6;
+    default: return 0;
+    }
+}
+
+EntrustsBook::Totals EntrustsBook::Contribution(const OrderState& order) {
+    Totals t;
+    if (IsPending(order.status)) {
+        int left = order.order_vol - order.traded_vol;
+        if (left > 0) {
+            t.pending_vol = left;
+            t.pending_amount = left * order.price;
+        }
+    }
+    if (order.status == kOrderCanceled || order.status == kOrderJunk || order.status == kOrderPartCancel) {
+        t.entrusted_value = order.traded_vol * order.price;
+    }
+    else {
+        t.entrusted_value = order.order_vol * order.price;
+    }
+    return t;
+}
+
+void EntrustsBook::AddLocked(const OrderState& order, double sign) {
+    Totals c = Contribution(order);
+    Totals* targets[2] = { &by_stock_[order.stock_code][order.side], &by_side_[order.side] };
+    for (Totals* t : targets) {
+        t->pending_vol += sign * c.pending_vol;
+        t->pending_amount += sign * c.pending_amount;
+        t->entrusted_value += sign * c.entrusted_value;
+    }
+}
+
+void EntrustsBook::UpsertLocked(int order_id, const OrderState& order) {
+    auto it = orders_.find(order_id);
+    if (it != orders_.end()) {
+        AddLocked(it->second, -1);
+        it->second = order;
+    }
+    else {
+        it = orders_.emplace(order_id, order).first;
+    }
+    AddLocked(it->second, +1);
+}
+
+void EntrustsBook::OnFeedback(const std::string& message) {
+    OnFeedbackBatch({ std::string_view(message) });
+}
+
+void EntrustsBook::OnFeedbackBatch(const std::vector<std::string_view>& messages) {
+    // 解析放在锁外
+    std::vector<TradeFeedback> feedbacks;
+    feedbacks.reserve(messages.size());
+    for (std::string_view message : messages) {
+        TradeFeedback feedback;
+        if (!feedback.ParseFromArray(message.data(), static_cast<int>(message.size()))) continue;
+        feedbacks.push_back(std::move(feedback));
+    }
+    if (feedbacks.empty()) return;
+    feedbacks_.fetch_add(feedbacks.size(), std::memory_order_relaxed);
+
+    uint64_t unknown = 0;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        for (const TradeFeedback& feedback : feedbacks) {
+            auto it = orders_.find(feedback.order_id());
+            if (it == orders_.end()) {
+                ++unknown;
+                continue;
+            }
+            OrderState order = it->second;
+            // 乱序到达的推送不回退：状态只往后走，成交量是累计值取大者
+            if (StatusRank(feedback.order_status()) >= StatusRank(order.status)) order.status = feedback.order_status();
+            if (feedback.traded_vol() > order.traded_vol) order.traded_vol = feedback.traded_vol();
+            UpsertLocked(feedback.order_id(), order);
+        }
+    }
+
+    if (unknown > 0) {
+        // 新委托：推送里没有委托数量和价格，只能重新拉一次底账
+        unknown_.fetch_add(unknown, std::memory_order_relaxed);
+        RequestRefresh();
+    }
+}
+
+void EntrustsBook::RequestRefresh() {
+    refresh_pending_.store(true, std::memory_order_release);
+    if (refreshing_.exchange(true, std::memory_order_acq_rel)) return;
+    if (!OrderExecutor::GetInstance().Submit("entrusts_book", [this]() { Refresh(); })) {
+        // 队列满：refresh_pending_ 保留，下一次 RequestRefresh 再提交
+        refreshing_.store(false, std::memory_order_release);
+    }
+}
+
+void EntrustsBook::Refresh() {
+    do {
+        // 先清标记再拉取：拉取期间到来的请求会再置位，结束后再拉一轮
+        while (refresh_pending_.exchange(false, std::memory_order_acq_rel)) RefreshOnce();
+        refreshing_.store(false, std::memory_order_release);
+        // 清 refreshing_ 之前置位的请求看到拉取在进行就返回了，由这里接着处理
+    } while (refresh_pending_.load(std::memory_order_acquire) && !refreshing_.exchange(true, std::memory_order_acq_rel));
+}
+
+bool EntrustsBook::RefreshOnce() {
+    std::unique_ptr<OrderResponse> response;
+    try {
+        ProtobufHttpClient client(http_);
+        response = client.get<OrderResponse>(orders_endpoint_);
+    }
+    catch (...) {
+        response.reset();
+    }
+
+    if (!response || response->status() != "success") {
+        refresh_failed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        std::unordered_map<int, OrderState> previous;
+        previous.swap(orders_);
+        by_stock_.clear();
+        by_side_[kBuy] = Totals();
+        by_side_[kSell] = Totals();
+
+        for (const Order& o : response->orders()) {
+            int side = o.order_type() == kStockBuy ? kBuy : (o.order_type() == kStockSell ? kSell : -1);
+            if (side < 0) continue;
+
+            OrderState order;
+            order.stock_code = NormalizeCode(o.stock_code());
+            order.side = side;
+            order.order_vol = o.order_vol();
+            order.traded_vol = o.traded_vol();
+            order.status = o.order_status();
+            order.price = o.price();
+
+            // 拉取期间推送可能已经走在快照前面：成交量取大者，状态取更靠后的阶段
+            auto it = previous.find(o.order_id());
+            if (it != previous.end()) {
+                const OrderState& seen = it->second;
+                if (seen.traded_vol > order.traded_vol) order.traded_vol = seen.traded_vol;
+                if (StatusRank(seen.status) > StatusRank(order.status)) order.status = seen.status;
+            }
+            UpsertLocked(o.order_id(), order);
+        }
+    }
+
+    refreshes_.fetch_add(1, std::memory_order_relaxed);
+    last_refresh_ms_.store(NowMs(), std::memory_order_relaxed);
+    ready_.store(true, std::memory_order_release);
+    return true;
+}
+
+void EntrustsBook::MaybeResync() {
+    if (resync_interval_.count() <= 0) return;
+    int64_t elapsed = NowMs() - last_refresh_ms_.load(std::memory_order_relaxed);
+    if (elapsed >= std::chrono::duration_cast<std::chrono::milliseconds>(resync_interval_).count()) {
+        RequestRefresh();
+    }
+}
+
+EntrustsBook::Totals EntrustsBook::Query(std::string_view stock_code, Side side) {
+    MaybeResync();
+    std::string code = NormalizeCode(stock_code);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = by_stock_.find(code);
+    return it == by_stock_.end() ? Totals() : it->second[side];
+}
+
+EntrustsBook::Totals EntrustsBook::QuerySide(Side side) {
+    MaybeResync();
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return by_side_[side];
+}
+
+EntrustsBook::Stats EntrustsBook::GetStats() const {
+    Stats stats;
+    stats.feedbacks = feedbacks_.load(std::memory_order_relaxed);
+    stats.unknown = unknown_.load(std::memory_order_relaxed);
+    stats.refreshes = refreshes_.load(std::memory_order_relaxed);
+    stats.refresh_failed = refresh_failed_.load(std::memory_order_relaxed);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    stats.orders = orders_.size();
+    return stats;
+}
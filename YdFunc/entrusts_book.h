@@ -0,0 +1,122 @@
+﻿#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "little_goal.pb.h"
+#include "protobuf_http_client.hpp"
+
+// 本地委托簿：ASK_BID / TODAY_ENTRUSTS 直接在内存里按 (股票, 方向) 取值，公式线程不再同步等 HTTP
+// 1. 启动时 GET /orders 取当日全部委托作为底账
+// 2. 之后由 Redis "stock_trade" 频道推送（或 Streams 消费组按批读取）的 TradeFeedback 增量更新状态和成交量
+// 3. 推送里没有委托数量和价格，遇到本地没有的 order_id 时在后台重新拉一次 /orders
+// 4. 每只股票、每个方向的汇总值随每次更新增减，查询 O(1)
+// 底账拉取成功之前 Ready() 为 false，调用方应回退到 HTTP 查询
+class EntrustsBook {
+public:
+    enum Side { kBuy = 0, kSell = 1 };
+
+    // 与 qmt_api 的 xtconstant 一致
+    static constexpr int kStockBuy = 23;
+    static constexpr int kStockSell = 24;
+
+    struct Totals {
+        double pending_vol = 0;       // 未成交数量：挂单中的 order_vol - traded_vol
+        double pending_amount = 0;    // 未成交金额：上面的数量 * 委托价
+        double entrusted_value = 0;   // 当日有效委托金额（已撤、废单只计已成交部分）
+    };
+
+    struct Stats {
+        uint64_t feedbacks = 0;   // 收到的推送
+        uint64_t unknown = 0;     // 推送中本地没有的委托
+        uint64_t refreshes = 0;   // 成功拉取 /orders 的次数
+        uint64_t refresh_failed = 0;
+        size_t orders = 0;
+    };
+
+    EntrustsBook(const EntrustsBook&) = delete;
+    EntrustsBook& operator=(const EntrustsBook&) = delete;
+
+    static EntrustsBook& GetInstance() {
+        static EntrustsBook instance;
+        return instance;
+    }
+
+    // 必须在第一次 RequestRefresh 之前调用
+    // resync_s: 距上次拉取超过该秒数时，下一次查询顺带在后台重新对账，0 表示不定期对账
+    void Configure(const ProtobufHttpClient::Config& http, const std::string& orders_endpoint, int resync_s);
+
+    bool Ready() const { return ready_.load(std::memory_order_acquire); }
+
+    // 在后台（OrderExecutor）拉取 /orders；已有拉取在进行时不另起一个，
+    // 而是在它结束后再拉一次，保证请求之后发生的委托一定会出现在某次拉取结果里
+    void RequestRefresh();
+
+    // Redis 订阅回调，message 为序列化的 TradeFeedback
+    void OnFeedback(const std::string& message);
+    // 一批推送只加一次锁（Streams 消费组按批交付）；有本地没有的委托时只拉一次底账
+    void OnFeedbackBatch(const std::vector<std::string_view>& messages);
+
+    // 按股票和方向取汇总，stock_code 可以带或不带市场前后缀；没有委托时返回全 0
+    Totals Query(std::string_view stock_code, Side side);
+
+    // 全市场某个方向的汇总
+    Totals QuerySide(Side side);
+
+    Stats GetStats() const;
+
+    // 统一成 6 位代码：SH600000 / 600000.SH / 600000 都得到 600000
+    static std::string NormalizeCode(std::string_view stock_code);
+
+private:
+    EntrustsBook() = default;
+
+    struct OrderState {
+        std::string stock_code;
+        int side = kBuy;
+        int order_vol = 0;
+        int traded_vol = 0;
+        int status = 0;
+        double price = 0;
+    };
+
+    static bool IsPending(int status);
+    // 状态在委托生命周期中的先后，推送乱序或快照落后时不把状态改回更早的阶段
+    static int StatusRank(int status);
+    static Totals Contribution(const OrderState& order);
+
+    // 以下调用时必须持有 mutex_ 写锁
+    void AddLocked(const OrderState& order, double sign);
+    void UpsertLocked(int order_id, const OrderState& order);
+
+    // 循环拉取，直到期间没有新的 RequestRefresh
+    void Refresh();
+    bool RefreshOnce();
+    void MaybeResync();
+
+    ProtobufHttpClient::Config http_;
+    std::string orders_endpoint_ = "/orders";
+    std::chrono::seconds resync_interval_{ 300 };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<int, OrderState> orders_;
+    std::unordered_map<std::string, std::array<Totals, 2>> by_stock_;
+    Totals by_side_[2];
+
+    std::atomic<bool> ready_{ false };
+    std::atomic<bool> refreshing_{ false };
+    std::atomic<bool> refresh_pending_{ false };   // 拉取进行中又收到了 RequestRefresh
+    std::atomic<int64_t> last_refresh_ms_{ 0 };
+
+    std::atomic<uint64_t> feedbacks_{ 0 };
+    std::atomic<uint64_t> unknown_{ 0 };
+    std::atomic<uint64_t> refreshes_{ 0 };
+    std::atomic<uint64_t> refresh_failed_{ 0 };
+};
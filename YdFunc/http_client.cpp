@@ -5,20 +5,20 @@
 #include <curl/curl.h>
 #include <jansson.h>
 
-// HttpClientṹCʵ
+// HttpClient结构体的C语言实现
 struct HttpClient {
     CURL* curl;
-    char* buffer;     // ̬Ļ
-    size_t size;      // ǰݴС
-    size_t capacity;  // 
+    char* buffer;     // 动态分配的缓冲区
+    size_t size;      // 当前数据大小
+    size_t capacity;  // 缓冲区容量
 };
 
-// дص
+// 写回调函数
 static size_t write_callback(char* ptr, size_t size, size_t nmemb, void* userdata) {
     size_t realsize = size * nmemb;
     HttpClient* client = (HttpClient*)userdata;
 
-    // ǷҪ
+    // 检查是否需要扩容
     if (client->size + realsize + 1 > client->capacity) {
         size_t new_capacity = client->capacity * 2;
         if (new_capacity < client->size + realsize + 1) {
@@ -32,7 +32,7 @@ static size_t write_callback(char* ptr, size_t size, size_t nmemb, void* userdat
         client->capacity = new_capacity;
     }
 
-    // ׷
+    // 追加数据
     memcpy(client->buffer + client->size, ptr, realsize);
     client->size += realsize;
     client->buffer[client->size] = '\0';
@@ -44,13 +44,13 @@ HTTP_API HttpClient* http_client_create(void) {
     HttpClient* client = (HttpClient*)malloc(sizeof(HttpClient));
     if (!client) return NULL;
 
-    // ʼԱ
+    // 初始化成员
     client->curl = curl_easy_init();
     client->buffer = NULL;
     client->size = 0;
     client->capacity = 0;
 
-    // ʼ(ʼС1KB)
+    // 初始化缓冲区(初始大小1KB)
     client->capacity = 1024;
     client->buffer = (char*)malloc(client->capacity);
     if (!client->buffer || !client->curl) {
@@ -60,7 +60,7 @@ HTTP_API HttpClient* http_client_create(void) {
         return NULL;
     }
 
-    // ĬHTTPͷ
+    // 设置默认HTTP头
     struct curl_slist* headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
     curl_easy_setopt(client->curl, CURLOPT_HTTPHEADER, headers);
@@ -85,7 +85,7 @@ HTTP_API void http_client_destroy(HttpClient* client) {
 HTTP_API char* http_client_get(HttpClient* client, const char* url) {
     if (!client || !url) return NULL;
 
-    // û
+    // 重置缓冲区
     client->size = 0;
     client->buffer[0] = '\0';
 
@@ -97,7 +97,7 @@ HTTP_API char* http_client_get(HttpClient* client, const char* url) {
         return NULL;
     }
 
-    // ݵĸ(ɵ߸ͷ)
+    // 返回数据的副本(由调用者负责释放)
     char* result = (char*)malloc(client->size + 1);
     if (result) {
         memcpy(result, client->buffer, client->size + 1);
@@ -108,7 +108,7 @@ HTTP_API char* http_client_get(HttpClient* client, const char* url) {
 HTTP_API char* http_client_post(HttpClient* client, const char* url, const char* json_data) {
     if (!client || !url || !json_data) return NULL;
 
-    // û
+    // 重置缓冲区
     client->size = 0;
     client->buffer[0] = '\0';
 
@@ -123,7 +123,7 @@ HTTP_API char* http_client_post(HttpClient* client, const char* url, const char*
         return NULL;
     }
 
-    // ݵĸ(ɵ߸ͷ)
+    // 返回数据的副本(由调用者负责释放)
     char* result = (char*)malloc(client->size + 1);
     if (result) {
         memcpy(result, client->buffer, client->size + 1);
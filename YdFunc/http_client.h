@@ -8,10 +8,10 @@
 extern "C" {
 #endif
 
-// ǰṹ壨͸ָ룩
+// 前向声明结构体（不透明指针）
 typedef struct HttpClient HttpClient;
 
-// APICӿڣ
+// 核心API（纯C接口）
 HTTP_API HttpClient* http_client_create(void);
 HTTP_API void http_client_destroy(HttpClient* client);
 HTTP_API char* http_client_get(HttpClient* client, const char* url);
@@ -0,0 +1,47 @@
+﻿#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include "LMDBClient.h"
+#include "block_bitmap.h"
+#include "block_engine.h"
+
+// 导出函数（GET_KEY / SET_KEY / ADD_KEY / DEL_KEY / KEY_* / RESET_STATUS / 板块）之下的可插拔存储，由 config.ini [kv] backend 选择
+//   lmdb  : 本机 LMDB，经 WriteCombiner（合并写、读己之写）、ReadCache 和 BlockEngine
+//   redis : 共享的 Redis，多台机器上的实例共用策略状态；读经本地缓存，RESP3 CLIENT TRACKING 推送失效保持一致
+// 所有实现都满足：可在任意线程调用；本线程写完之后本线程立即能读到
+// key 与 LMDB 的一致（"key:<资金账号>:<名字>"），板块成员为 BlockEngine::StockId
+class KVStore {
+public:
+    using Aggregate = LMDBClient::Aggregate;
+
+    // 与 LMDBClient 同名函数一致：不存在时返回 false 且 *value 为 0
+    virtual bool GetDouble(const std::string& key, double* value) = 0;
+    virtual bool PutDouble(const std::string& key, double value) = 0;
+    virtual bool IncrementDouble(const std::string& key, double delta) = 0;
+    virtual bool Delete(const std::string& key) = 0;
+    // 删除 prefix 开头的全部 key
+    virtual bool DeleteKeys(const std::string& prefix) = 0;
+    // prefix 开头、值为 double 的 key 的汇总
+    virtual bool AggregateDoubles(const std::string& prefix, Aggregate* result) = 0;
+
+    // === 板块 ===
+    virtual bool BlockAdd(uint32_t block_id, std::string_view stock_code) = 0;
+    virtual bool BlockContains(uint32_t block_id, std::string_view stock_code) = 0;
+    virtual uint64_t BlockSize(uint32_t block_id) = 0;
+    virtual uint64_t BlockCombinedSize(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) = 0;
+    virtual BlockBitmap BlockCombine(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) = 0;
+    virtual bool ResetBlocks() = 0;
+
+    // 等待此前的写全部落地（批量删除之前调用，避免排队的写在删除之后才提交）
+    virtual bool Flush(std::chrono::milliseconds timeout) = 0;
+
+    virtual const char* Name() const = 0;
+
+protected:
+    // 实现都是进程级单例，不通过基类指针析构
+    ~KVStore() = default;
+};
@@ -0,0 +1,275 @@
+﻿#include "latency_metrics.h"
+#include <bit>
+#include <cmath>
+#include <format>
+#include <unordered_map>
+
+namespace {
+
+thread_local std::chrono::steady_clock::time_point t_export_start{};
+
+} // namespace
+
+const char* LatencyStageName(LatencyStage stage) {
+    switch (stage) {
+    case LatencyStage::Export: return "export";
+    case LatencyStage::Queue: return "queue";
+    case LatencyStage::Serialize: return "serialize";
+    case LatencyStage::Connect: return "connect";
+    case LatencyStage::FirstByte: return "first_byte";
+    case LatencyStage::Parse: return "parse";
+    case LatencyStage::Callback: return "callback";
+    case LatencyStage::Total: return "total";
+    default: return "unknown";
+    }
+}
+
+LatencyMetrics::Histogram::Histogram() {
+    for (auto& c : counts) c.store(0, std::memory_order_relaxed);
+}
+
+LatencyMetrics::Shard::Shard() {
+    for (auto& row : slots) {
+        for (auto& slot : row) slot.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+LatencyMetrics::~LatencyMetrics() {
+    // 分片随进程回收；只通知上报线程退出，不 join（可能处于 loader lock 下）
+    StopReporter(std::chrono::milliseconds(0));
+}
+
+size_t LatencyMetrics::BucketOf(uint64_t micros) {
+    if (micros < (uint64_t(2) << kSubBits)) return static_cast<size_t>(micros);
+    int msb = std::bit_width(micros) - 1;
+    if (msb > kMaxMsb) {
+        msb = kMaxMsb;
+        micros = (uint64_t(2) << kMaxMsb) - 1;
+    }
+    int shift = msb - kSubBits;
+    return static_cast<size_t>(shift) * (size_t(1) << kSubBits) + static_cast<size_t>(micros >> shift);
+}
+
+uint64_t LatencyMetrics::BucketUpper(size_t index) {
+    if (index < (size_t(2) << kSubBits)) return index;
+    int shift = static_cast<int>(index >> kSubBits) - 1;
+    uint64_t mantissa = (index & ((size_t(1) << kSubBits) - 1)) + (size_t(1) << kSubBits);
+    return ((mantissa + 1) << shift) - 1;
+}
+
+int LatencyMetrics::KeyId(const std::string& key) {
+    thread_local std::unordered_map<std::string, int> cache;
+    auto it = cache.find(key);
+    if (it != cache.end()) return it->second;
+
+    int id = -1;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            if (keys_[i] == key) {
+                id = static_cast<int>(i);
+                break;
+            }
+        }
+        if (id < 0 && keys_.size() < kMaxKeys) {
+            keys_.push_back(key);
+            id = static_cast<int>(keys_.size() - 1);
+            key_count_.store(keys_.size(), std::memory_order_release);
+        }
+    }
+    if (id >= 0) cache.emplace(key, id);
+    return id;
+}
+
+LatencyMetrics::Shard* LatencyMetrics::LocalShard() {
+    thread_local Shard* shard = nullptr;
+    if (!shard) {
+        shard = new Shard();
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        shards_.push_back(shard);
+    }
+    return shard;
+}
+
+void LatencyMetrics::Record(int key_id, LatencyStage stage, std::chrono::steady_clock::duration elapsed) {
+    RecordMicros(key_id, stage, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+void LatencyMetrics::RecordMicros(int key_id, LatencyStage stage, int64_t micros) {
+    if (key_id < 0 || micros < 0 || !Enabled()) return;
+
+    auto& slot = LocalShard()->slots[key_id][static_cast<size_t>(stage)];
+    Histogram* h = slot.load(std::memory_order_relaxed);
+    if (!h) {
+        h = new Histogram();
+        slot.store(h, std::memory_order_release);
+    }
+
+    // 分片只有本线程写，load + store 即可，不需要加锁前缀的 fetch_add
+    auto& count = h->counts[BucketOf(static_cast<uint64_t>(micros))];
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (static_cast<uint64_t>(micros) > h->max.load(std::memory_order_relaxed)) {
+        h->max.store(static_cast<uint64_t>(micros), std::memory_order_relaxed);
+    }
+}
+
+uint64_t LatencyMetrics::Merge(size_t key_id, size_t stage, std::vector<uint64_t>& merged, uint64_t* max) const {
+    merged.assign(kBuckets, 0);
+    uint64_t total = 0;
+    *max = 0;
+
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    for (const Shard* shard : shards_) {
+        const Histogram* h = shard->slots[key_id][stage].load(std::memory_order_acquire);
+        if (!h) continue;
+        for (size_t b = 0; b < kBuckets; ++b) {
+            uint64_t c = h->counts[b].load(std::memory_order_relaxed);
+            merged[b] += c;
+            total += c;
+        }
+        uint64_t m = h->max.load(std::memory_order_relaxed);
+        if (m > *max) *max = m;
+    }
+    return total;
+}
+
+uint64_t LatencyMetrics::QuantileOf(const std::vector<uint64_t>& merged, uint64_t total, double quantile) {
+    if (total == 0) return 0;
+    uint64_t rank = static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(total)));
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (size_t b = 0; b < merged.size(); ++b) {
+        seen += merged[b];
+        if (seen >= rank) return BucketUpper(b);
+    }
+    return BucketUpper(merged.size() - 1);
+}
+
+std::vector<LatencySnapshot> LatencyMetrics::Snapshot() const {
+    std::vector<std::string> keys;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        keys = keys_;
+    }
+
+    std::vector<LatencySnapshot> result;
+    std::vector<uint64_t> merged;
+    for (size_t k = 0; k < keys.size(); ++k) {
+        for (size_t s = 0; s < kStages; ++s) {
+            uint64_t max = 0;
+            uint64_t total = Merge(k, s, merged, &max);
+            if (total == 0) continue;
+
+            LatencySnapshot snap;
+            snap.key = keys[k];
+            snap.stage = static_cast<LatencyStage>(s);
+            snap.count = total;
+            snap.p50 = QuantileOf(merged, total, 0.50);
+            snap.p99 = QuantileOf(merged, total, 0.99);
+            snap.p999 = QuantileOf(merged, total, 0.999);
+            // 桶上界可能超过真实最大值，以实际最大值为准
+            snap.max = max;
+            if (snap.p50 > max) snap.p50 = max;
+            if (snap.p99 > max) snap.p99 = max;
+            if (snap.p999 > max) snap.p999 = max;
+            result.push_back(std::move(snap));
+        }
+    }
+    return result;
+}
+
+bool LatencyMetrics::Quantile(const std::string& key, LatencyStage stage, double quantile, uint64_t* micros) const {
+    if (stage >= LatencyStage::Count || !micros) return false;
+
+    size_t key_id = kMaxKeys;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            if (keys_[i] == key) {
+                key_id = i;
+                break;
+            }
+        }
+    }
+    if (key_id == kMaxKeys) return false;
+
+    std::vector<uint64_t> merged;
+    uint64_t max = 0;
+    uint64_t total = Merge(key_id, static_cast<size_t>(stage), merged, &max);
+    if (total == 0) return false;
+
+    uint64_t value = QuantileOf(merged, total, quantile);
+    *micros = value > max ? max : value;
+    return true;
+}
+
+std::string LatencyMetrics::FormatSnapshot() const {
+    std::string out;
+    for (const auto& snap : Snapshot()) {
+        out += std::format("[latency] {} {} n={} p50={}us p99={}us p999={}us max={}us\n",
+            snap.key, LatencyStageName(snap.stage), snap.count, snap.p50, snap.p99, snap.p999, snap.max);
+    }
+    return out;
+}
+
+void LatencyMetrics::StartReporter(std::chrono::seconds interval, std::function<void(const std::string&)> sink) {
+    if (interval.count() <= 0 || !sink) return;
+    std::lock_guard<std::mutex> lock(reporter_mutex_);
+    if (reporter_thread_.joinable()) return;
+
+    reporter_running_ = true;
+    reporter_thread_ = std::thread(&LatencyMetrics::ReporterLoop, this, interval, std::move(sink));
+}
+
+void LatencyMetrics::ReporterLoop(std::chrono::seconds interval, std::function<void(const std::string&)> sink) {
+    std::unique_lock<std::mutex> lock(reporter_mutex_);
+    while (!reporter_stop_.load(std::memory_order_acquire)) {
+        reporter_cv_.wait_for(lock, interval, [this] { return reporter_stop_.load(std::memory_order_acquire); });
+        if (reporter_stop_.load(std::memory_order_acquire)) break;
+
+        lock.unlock();
+        std::string text = FormatSnapshot();
+        if (!text.empty()) {
+            try {
+                sink(text);
+            }
+            catch (...) {
+                // 写日志失败不影响统计
+            }
+        }
+        lock.lock();
+    }
+    reporter_running_.store(false, std::memory_order_release);
+}
+
+void LatencyMetrics::StopReporter(std::chrono::milliseconds grace) {
+    {
+        std::lock_guard<std::mutex> lock(reporter_mutex_);
+        if (reporter_stop_.exchange(true, std::memory_order_acq_rel)) return;
+    }
+    reporter_cv_.notify_all();
+
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (reporter_running_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (reporter_thread_.joinable()) reporter_thread_.detach();
+}
+
+std::chrono::steady_clock::time_point LatencyMetrics::CurrentExportStart() {
+    return t_export_start;
+}
+
+ExportTimer::ExportTimer(const char* export_name)
+    : key_id_(LatencyMetrics::GetInstance().KeyId(export_name)),
+      start_(std::chrono::steady_clock::now()),
+      outer_start_(t_export_start) {
+    // 嵌套调用时以最外层为准
+    if (outer_start_ == std::chrono::steady_clock::time_point{}) t_export_start = start_;
+}
+
+ExportTimer::~ExportTimer() {
+    LatencyMetrics::GetInstance().Record(key_id_, LatencyStage::Export, std::chrono::steady_clock::now() - start_);
+    t_export_start = outer_start_;
+}
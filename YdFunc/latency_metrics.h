@@ -0,0 +1,140 @@
+﻿#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 下单链路各阶段耗时
+enum class LatencyStage : uint8_t {
+    Export = 0,   // 导出函数从进入到返回（按导出函数名统计）
+    Queue,        // Submit 到 I/O 线程真正开始发送
+    Serialize,    // protobuf 序列化
+    Connect,      // curl 建连（复用连接时为 0；shm 没有这个阶段）
+    FirstByte,    // 开始发送到收到第一个字节
+    Parse,        // protobuf 解析
+    Callback,     // 业务回调本身
+    Total,        // 导出函数进入到回调结束
+    Count
+};
+
+const char* LatencyStageName(LatencyStage stage);
+
+struct LatencySnapshot {
+    std::string key;
+    LatencyStage stage = LatencyStage::Export;
+    uint64_t count = 0;
+    uint64_t p50 = 0;    // 以下单位均为微秒
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+    uint64_t max = 0;
+};
+
+// HDR 风格的对数-线性直方图，常驻生产环境
+// 1. 每 2 的幂区间再分 16 格，相对误差约 6%，单个直方图约 3.7KB
+// 2. 每个线程一组分片，记录时只写自己的分片（单写者，无锁无竞争）
+// 3. 读取时把所有线程的分片合并，线程退出后分片保留，历史数据不丢
+// 4. key 为 endpoint（"/place_order/amount"）或导出函数名（"AUTO_TRADE"）
+class LatencyMetrics {
+public:
+    static constexpr size_t kMaxKeys = 64;
+
+    LatencyMetrics(const LatencyMetrics&) = delete;
+    LatencyMetrics& operator=(const LatencyMetrics&) = delete;
+
+    static LatencyMetrics& GetInstance() {
+        static LatencyMetrics instance;
+        return instance;
+    }
+
+    void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool Enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // key 转为编号，同一线程重复查询走线程本地缓存；key 数超过上限返回 -1
+    int KeyId(const std::string& key);
+
+    void Record(int key_id, LatencyStage stage, std::chrono::steady_clock::duration elapsed);
+    void RecordMicros(int key_id, LatencyStage stage, int64_t micros);
+
+    // 合并所有线程的分片，只返回有数据的 (key, stage)
+    std::vector<LatencySnapshot> Snapshot() const;
+
+    // quantile 取 0~1，例如 0.999；没有数据返回 false
+    bool Quantile(const std::string& key, LatencyStage stage, double quantile, uint64_t* micros) const;
+
+    // 每 interval 把快照格式化后交给 sink；interval 为 0 不启动
+    void StartReporter(std::chrono::seconds interval, std::function<void(const std::string&)> sink);
+    void StopReporter(std::chrono::milliseconds grace);
+
+    std::string FormatSnapshot() const;
+
+    // 当前线程所在导出函数的进入时刻，由 ExportTimer 设置，没有时为默认值
+    static std::chrono::steady_clock::time_point CurrentExportStart();
+
+private:
+    friend class ExportTimer;
+
+    static constexpr int kSubBits = 4;                 // 每个 2 的幂区间 16 格
+    static constexpr int kMaxMsb = 31;                 // 超过 2^32 微秒的值归入最后一格
+    // 小于 32 的值每个一格，之后每个 2 的幂区间 16 格
+    static constexpr size_t kBuckets = (size_t(2) << kSubBits) + (size_t(1) << kSubBits) * (kMaxMsb - kSubBits);
+    static constexpr size_t kStages = static_cast<size_t>(LatencyStage::Count);
+
+    struct Histogram {
+        std::atomic<uint64_t> counts[kBuckets];
+        std::atomic<uint64_t> max{ 0 };
+        Histogram();
+    };
+
+    // 每线程一份，slots 由本线程懒分配，读取方只做 acquire load
+    struct Shard {
+        std::atomic<Histogram*> slots[kMaxKeys][kStages];
+        Shard();
+    };
+
+    LatencyMetrics() = default;
+    ~LatencyMetrics();
+
+    static size_t BucketOf(uint64_t micros);
+    static uint64_t BucketUpper(size_t index);
+
+    Shard* LocalShard();
+    void ReporterLoop(std::chrono::seconds interval, std::function<void(const std::string&)> sink);
+    // 把 (key, stage) 在所有分片上的计数合并到 merged，返回总数
+    uint64_t Merge(size_t key_id, size_t stage, std::vector<uint64_t>& merged, uint64_t* max) const;
+    static uint64_t QuantileOf(const std::vector<uint64_t>& merged, uint64_t total, double quantile);
+
+    std::atomic<bool> enabled_{ true };
+
+    mutable std::mutex registry_mutex_;
+    std::vector<Shard*> shards_;
+    std::vector<std::string> keys_;
+    std::atomic<size_t> key_count_{ 0 };
+
+    std::mutex reporter_mutex_;
+    std::condition_variable reporter_cv_;
+    std::thread reporter_thread_;
+    std::atomic<bool> reporter_stop_{ false };
+    std::atomic<bool> reporter_running_{ false };
+};
+
+// 放在导出函数开头：记录 Export 阶段，并让本线程发起的请求能统计端到端 Total
+class ExportTimer {
+public:
+    explicit ExportTimer(const char* export_name);
+    ~ExportTimer();
+
+    ExportTimer(const ExportTimer&) = delete;
+    ExportTimer& operator=(const ExportTimer&) = delete;
+
+private:
+    int key_id_;
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::time_point outer_start_;
+};
@@ -1,6771 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: little_goal.proto
-// Protobuf C++ Version: 5.29.5
-
-#include "little_goal.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-
-inline constexpr TradeFeedback::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_time_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_status_{0},
-        order_id_{0},
-        traded_price_{0},
-        order_type_{0},
-        traded_vol_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TradeFeedback::TradeFeedback(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TradeFeedbackDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TradeFeedbackDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TradeFeedbackDefaultTypeInternal() {}
-  union {
-    TradeFeedback _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TradeFeedbackDefaultTypeInternal _TradeFeedback_default_instance_;
-
-inline constexpr Trade::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : account_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        traded_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        traded_time_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_type_{0},
-        traded_vol_{0},
-        traded_price_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR Trade::Trade(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TradeDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TradeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TradeDefaultTypeInternal() {}
-  union {
-    Trade _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TradeDefaultTypeInternal _Trade_default_instance_;
-
-inline constexpr TodayEntrustsValueResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        unvalue_{0},
-        envalue_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TodayEntrustsValueResponse::TodayEntrustsValueResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TodayEntrustsValueResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TodayEntrustsValueResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TodayEntrustsValueResponseDefaultTypeInternal() {}
-  union {
-    TodayEntrustsValueResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TodayEntrustsValueResponseDefaultTypeInternal _TodayEntrustsValueResponse_default_instance_;
-
-inline constexpr StockPositions::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR StockPositions::StockPositions(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct StockPositionsDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR StockPositionsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~StockPositionsDefaultTypeInternal() {}
-  union {
-    StockPositions _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StockPositionsDefaultTypeInternal _StockPositions_default_instance_;
-
-inline constexpr Position::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : account_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        vol_{0},
-        available_vol_{0},
-        avg_cost_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR Position::Position(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct PositionDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR PositionDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~PositionDefaultTypeInternal() {}
-  union {
-    Position _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PositionDefaultTypeInternal _Position_default_instance_;
-
-inline constexpr PlaceOrderResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR PlaceOrderResponse::PlaceOrderResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct PlaceOrderResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR PlaceOrderResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~PlaceOrderResponseDefaultTypeInternal() {}
-  union {
-    PlaceOrderResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlaceOrderResponseDefaultTypeInternal _PlaceOrderResponse_default_instance_;
-
-inline constexpr PlaceOrder::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : account_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        place_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        price_{0},
-        how_many_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR PlaceOrder::PlaceOrder(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct PlaceOrderDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR PlaceOrderDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~PlaceOrderDefaultTypeInternal() {}
-  union {
-    PlaceOrder _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlaceOrderDefaultTypeInternal _PlaceOrder_default_instance_;
-
-inline constexpr Order::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : account_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_time_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_id_{0},
-        order_type_{0},
-        order_vol_{0},
-        price_type_{0},
-        price_{0},
-        traded_vol_{0},
-        order_status_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR Order::Order(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct OrderDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR OrderDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~OrderDefaultTypeInternal() {}
-  union {
-    Order _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderDefaultTypeInternal _Order_default_instance_;
-
-inline constexpr EntrustsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        result_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR EntrustsResponse::EntrustsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct EntrustsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR EntrustsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~EntrustsResponseDefaultTypeInternal() {}
-  union {
-    EntrustsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EntrustsResponseDefaultTypeInternal _EntrustsResponse_default_instance_;
-
-inline constexpr Entrusts::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        trade_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        data_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR Entrusts::Entrusts(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct EntrustsDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR EntrustsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~EntrustsDefaultTypeInternal() {}
-  union {
-    Entrusts _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EntrustsDefaultTypeInternal _Entrusts_default_instance_;
-
-inline constexpr CancelStockScopeResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        order_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CancelStockScopeResponse::CancelStockScopeResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CancelStockScopeResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CancelStockScopeResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CancelStockScopeResponseDefaultTypeInternal() {}
-  union {
-    CancelStockScopeResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelStockScopeResponseDefaultTypeInternal _CancelStockScopeResponse_default_instance_;
-
-inline constexpr CancelStockScope::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : order_type_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CancelStockScope::CancelStockScope(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CancelStockScopeDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CancelStockScopeDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CancelStockScopeDefaultTypeInternal() {}
-  union {
-    CancelStockScope _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelStockScopeDefaultTypeInternal _CancelStockScope_default_instance_;
-
-inline constexpr CancelOrderIdResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CancelOrderIdResponse::CancelOrderIdResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CancelOrderIdResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CancelOrderIdResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CancelOrderIdResponseDefaultTypeInternal() {}
-  union {
-    CancelOrderIdResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelOrderIdResponseDefaultTypeInternal _CancelOrderIdResponse_default_instance_;
-
-inline constexpr CancelOrderId::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : order_id_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CancelOrderId::CancelOrderId(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CancelOrderIdDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CancelOrderIdDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CancelOrderIdDefaultTypeInternal() {}
-  union {
-    CancelOrderId _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelOrderIdDefaultTypeInternal _CancelOrderId_default_instance_;
-
-inline constexpr AccountInfo::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : account_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        cash_{0},
-        frozen_cash_{0},
-        total_asset_{0},
-        market_value_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AccountInfo::AccountInfo(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AccountInfoDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AccountInfoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AccountInfoDefaultTypeInternal() {}
-  union {
-    AccountInfo _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AccountInfoDefaultTypeInternal _AccountInfo_default_instance_;
-
-inline constexpr TradeResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : trades_{},
-        status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TradeResponse::TradeResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TradeResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TradeResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TradeResponseDefaultTypeInternal() {}
-  union {
-    TradeResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TradeResponseDefaultTypeInternal _TradeResponse_default_instance_;
-
-inline constexpr PositionsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : positions_{},
-        status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR PositionsResponse::PositionsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct PositionsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR PositionsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~PositionsResponseDefaultTypeInternal() {}
-  union {
-    PositionsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PositionsResponseDefaultTypeInternal _PositionsResponse_default_instance_;
-
-inline constexpr OrderResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : orders_{},
-        status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR OrderResponse::OrderResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct OrderResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR OrderResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~OrderResponseDefaultTypeInternal() {}
-  union {
-    OrderResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderResponseDefaultTypeInternal _OrderResponse_default_instance_;
-
-inline constexpr AccountInfoResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        status_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        data_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AccountInfoResponse::AccountInfoResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AccountInfoResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AccountInfoResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AccountInfoResponseDefaultTypeInternal() {}
-  union {
-    AccountInfoResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AccountInfoResponseDefaultTypeInternal _AccountInfoResponse_default_instance_;
-static constexpr const ::_pb::EnumDescriptor**
-    file_level_enum_descriptors_little_5fgoal_2eproto = nullptr;
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_little_5fgoal_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_little_5fgoal_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::TradeFeedback, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::TradeFeedback, _impl_.stock_code_),
-        PROTOBUF_FIELD_OFFSET(::TradeFeedback, _impl_.order_status_),
-        PROTOBUF_FIELD_OFFSET(::TradeFeedback, _impl_.order_id_),
-        PROTOBUF_FIELD_OFFSET(::TradeFeedback, _impl_.order_type_),
-        PROTOBUF_FIELD_OFFSET(::TradeFeedback, _impl_.traded_price_),
-        PROTOBUF_FIELD_OFFSET(::TradeFeedback, _impl_.traded_vol_),
-        PROTOBUF_FIELD_OFFSET(::TradeFeedback, _impl_.order_time_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::AccountInfo, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::AccountInfo, _impl_.account_id_),
-        PROTOBUF_FIELD_OFFSET(::AccountInfo, _impl_.cash_),
-        PROTOBUF_FIELD_OFFSET(::AccountInfo, _impl_.frozen_cash_),
-        PROTOBUF_FIELD_OFFSET(::AccountInfo, _impl_.total_asset_),
-        PROTOBUF_FIELD_OFFSET(::AccountInfo, _impl_.market_value_),
-        PROTOBUF_FIELD_OFFSET(::AccountInfoResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::AccountInfoResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::AccountInfoResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::AccountInfoResponse, _impl_.data_),
-        ~0u,
-        0,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::Position, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::Position, _impl_.account_id_),
-        PROTOBUF_FIELD_OFFSET(::Position, _impl_.stock_code_),
-        PROTOBUF_FIELD_OFFSET(::Position, _impl_.vol_),
-        PROTOBUF_FIELD_OFFSET(::Position, _impl_.available_vol_),
-        PROTOBUF_FIELD_OFFSET(::Position, _impl_.avg_cost_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::PositionsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::PositionsResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::PositionsResponse, _impl_.positions_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::Order, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.account_id_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.stock_code_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.order_id_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.order_time_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.order_type_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.order_vol_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.price_type_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.price_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.traded_vol_),
-        PROTOBUF_FIELD_OFFSET(::Order, _impl_.order_status_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::OrderResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::OrderResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::OrderResponse, _impl_.orders_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::Trade, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::Trade, _impl_.account_id_),
-        PROTOBUF_FIELD_OFFSET(::Trade, _impl_.stock_code_),
-        PROTOBUF_FIELD_OFFSET(::Trade, _impl_.order_type_),
-        PROTOBUF_FIELD_OFFSET(::Trade, _impl_.traded_id_),
-        PROTOBUF_FIELD_OFFSET(::Trade, _impl_.traded_time_),
-        PROTOBUF_FIELD_OFFSET(::Trade, _impl_.traded_price_),
-        PROTOBUF_FIELD_OFFSET(::Trade, _impl_.traded_vol_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::TradeResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::TradeResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::TradeResponse, _impl_.trades_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::PlaceOrder, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::PlaceOrder, _impl_.account_id_),
-        PROTOBUF_FIELD_OFFSET(::PlaceOrder, _impl_.stock_code_),
-        PROTOBUF_FIELD_OFFSET(::PlaceOrder, _impl_.how_many_),
-        PROTOBUF_FIELD_OFFSET(::PlaceOrder, _impl_.price_),
-        PROTOBUF_FIELD_OFFSET(::PlaceOrder, _impl_.order_type_),
-        PROTOBUF_FIELD_OFFSET(::PlaceOrder, _impl_.place_type_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::PlaceOrderResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::PlaceOrderResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::PlaceOrderResponse, _impl_.msg_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::CancelOrderId, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::CancelOrderId, _impl_.order_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::CancelOrderIdResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::CancelOrderIdResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::CancelOrderIdResponse, _impl_.msg_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::CancelStockScope, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::CancelStockScope, _impl_.order_type_),
-        PROTOBUF_FIELD_OFFSET(::CancelStockScope, _impl_.stock_code_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::CancelStockScopeResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::CancelStockScopeResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::CancelStockScopeResponse, _impl_.order_type_),
-        PROTOBUF_FIELD_OFFSET(::CancelStockScopeResponse, _impl_.stock_code_),
-        PROTOBUF_FIELD_OFFSET(::CancelStockScopeResponse, _impl_.msg_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::Entrusts, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::Entrusts, _impl_.stock_code_),
-        PROTOBUF_FIELD_OFFSET(::Entrusts, _impl_.trade_type_),
-        PROTOBUF_FIELD_OFFSET(::Entrusts, _impl_.data_type_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::EntrustsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::EntrustsResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::EntrustsResponse, _impl_.result_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::TodayEntrustsValueResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::TodayEntrustsValueResponse, _impl_.status_),
-        PROTOBUF_FIELD_OFFSET(::TodayEntrustsValueResponse, _impl_.unvalue_),
-        PROTOBUF_FIELD_OFFSET(::TodayEntrustsValueResponse, _impl_.envalue_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::StockPositions, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::StockPositions, _impl_.stock_code_),
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::TradeFeedback)},
-        {15, -1, -1, sizeof(::AccountInfo)},
-        {28, 38, -1, sizeof(::AccountInfoResponse)},
-        {40, -1, -1, sizeof(::Position)},
-        {53, -1, -1, sizeof(::PositionsResponse)},
-        {63, -1, -1, sizeof(::Order)},
-        {81, -1, -1, sizeof(::OrderResponse)},
-        {91, -1, -1, sizeof(::Trade)},
-        {106, -1, -1, sizeof(::TradeResponse)},
-        {116, -1, -1, sizeof(::PlaceOrder)},
-        {130, -1, -1, sizeof(::PlaceOrderResponse)},
-        {140, -1, -1, sizeof(::CancelOrderId)},
-        {149, -1, -1, sizeof(::CancelOrderIdResponse)},
-        {159, -1, -1, sizeof(::CancelStockScope)},
-        {169, -1, -1, sizeof(::CancelStockScopeResponse)},
-        {181, -1, -1, sizeof(::Entrusts)},
-        {192, -1, -1, sizeof(::EntrustsResponse)},
-        {202, -1, -1, sizeof(::TodayEntrustsValueResponse)},
-        {213, -1, -1, sizeof(::StockPositions)},
-};
-static const ::_pb::Message* const file_default_instances[] = {
-    &::_TradeFeedback_default_instance_._instance,
-    &::_AccountInfo_default_instance_._instance,
-    &::_AccountInfoResponse_default_instance_._instance,
-    &::_Position_default_instance_._instance,
-    &::_PositionsResponse_default_instance_._instance,
-    &::_Order_default_instance_._instance,
-    &::_OrderResponse_default_instance_._instance,
-    &::_Trade_default_instance_._instance,
-    &::_TradeResponse_default_instance_._instance,
-    &::_PlaceOrder_default_instance_._instance,
-    &::_PlaceOrderResponse_default_instance_._instance,
-    &::_CancelOrderId_default_instance_._instance,
-    &::_CancelOrderIdResponse_default_instance_._instance,
-    &::_CancelStockScope_default_instance_._instance,
-    &::_CancelStockScopeResponse_default_instance_._instance,
-    &::_Entrusts_default_instance_._instance,
-    &::_EntrustsResponse_default_instance_._instance,
-    &::_TodayEntrustsValueResponse_default_instance_._instance,
-    &::_StockPositions_default_instance_._instance,
-};
-const char descriptor_table_protodef_little_5fgoal_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\021little_goal.proto\"\235\001\n\rTradeFeedback\022\022\n"
-    "\nstock_code\030\001 \001(\t\022\024\n\014order_status\030\002 \001(\005\022"
-    "\020\n\010order_id\030\003 \001(\005\022\022\n\norder_type\030\004 \001(\005\022\024\n"
-    "\014traded_price\030\005 \001(\001\022\022\n\ntraded_vol\030\006 \001(\005\022"
-    "\022\n\norder_time\030\007 \001(\t\"o\n\013AccountInfo\022\022\n\nac"
-    "count_id\030\001 \001(\t\022\014\n\004cash\030\002 \001(\001\022\023\n\013frozen_c"
-    "ash\030\003 \001(\001\022\023\n\013total_asset\030\004 \001(\001\022\024\n\014market"
-    "_value\030\005 \001(\001\"A\n\023AccountInfoResponse\022\016\n\006s"
-    "tatus\030\001 \001(\t\022\032\n\004data\030\002 \001(\0132\014.AccountInfo\""
-    "h\n\010Position\022\022\n\naccount_id\030\001 \001(\t\022\022\n\nstock"
-    "_code\030\002 \001(\t\022\013\n\003vol\030\003 \001(\005\022\025\n\ravailable_vo"
-    "l\030\004 \001(\005\022\020\n\010avg_cost\030\005 \001(\001\"A\n\021PositionsRe"
-    "sponse\022\016\n\006status\030\001 \001(\t\022\034\n\tpositions\030\002 \003("
-    "\0132\t.Position\"\311\001\n\005Order\022\022\n\naccount_id\030\001 \001"
-    "(\t\022\022\n\nstock_code\030\002 \001(\t\022\020\n\010order_id\030\003 \001(\005"
-    "\022\022\n\norder_time\030\004 \001(\t\022\022\n\norder_type\030\005 \001(\005"
-    "\022\021\n\torder_vol\030\006 \001(\005\022\022\n\nprice_type\030\007 \001(\005\022"
-    "\r\n\005price\030\010 \001(\001\022\022\n\ntraded_vol\030\t \001(\005\022\024\n\014or"
-    "der_status\030\n \001(\005\"7\n\rOrderResponse\022\016\n\006sta"
-    "tus\030\001 \001(\t\022\026\n\006orders\030\002 \003(\0132\006.Order\"\225\001\n\005Tr"
-    "ade\022\022\n\naccount_id\030\001 \001(\t\022\022\n\nstock_code\030\002 "
-    "\001(\t\022\022\n\norder_type\030\003 \001(\005\022\021\n\ttraded_id\030\004 \001"
-    "(\t\022\023\n\013traded_time\030\005 \001(\t\022\024\n\014traded_price\030"
-    "\006 \001(\001\022\022\n\ntraded_vol\030\007 \001(\005\"7\n\rTradeRespon"
-    "se\022\016\n\006status\030\001 \001(\t\022\026\n\006trades\030\002 \003(\0132\006.Tra"
-    "de\"}\n\nPlaceOrder\022\022\n\naccount_id\030\001 \001(\t\022\022\n\n"
-    "stock_code\030\002 \001(\t\022\020\n\010how_many\030\003 \001(\005\022\r\n\005pr"
-    "ice\030\004 \001(\001\022\022\n\norder_type\030\005 \001(\t\022\022\n\nplace_t"
-    "ype\030\006 \001(\t\"1\n\022PlaceOrderResponse\022\016\n\006statu"
-    "s\030\001 \001(\t\022\013\n\003msg\030\002 \001(\t\"!\n\rCancelOrderId\022\020\n"
-    "\010order_id\030\001 \001(\005\"4\n\025CancelOrderIdResponse"
-    "\022\016\n\006status\030\001 \001(\t\022\013\n\003msg\030\002 \001(\t\":\n\020CancelS"
-    "tockScope\022\022\n\norder_type\030\001 \001(\t\022\022\n\nstock_c"
-    "ode\030\002 \001(\t\"_\n\030CancelStockScopeResponse\022\016\n"
-    "\006status\030\001 \001(\t\022\022\n\norder_type\030\002 \001(\t\022\022\n\nsto"
-    "ck_code\030\003 \001(\t\022\013\n\003msg\030\004 \001(\t\"E\n\010Entrusts\022\022"
-    "\n\nstock_code\030\001 \001(\t\022\022\n\ntrade_type\030\002 \001(\t\022\021"
-    "\n\tdata_type\030\003 \001(\t\"2\n\020EntrustsResponse\022\016\n"
-    "\006status\030\001 \001(\t\022\016\n\006result\030\002 \001(\001\"N\n\032TodayEn"
-    "trustsValueResponse\022\016\n\006status\030\001 \001(\t\022\017\n\007u"
-    "nvalue\030\002 \001(\001\022\017\n\007envalue\030\003 \001(\001\"$\n\016StockPo"
-    "sitions\022\022\n\nstock_code\030\001 \001(\tb\006proto3"
-};
-static ::absl::once_flag descriptor_table_little_5fgoal_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_little_5fgoal_2eproto = {
-    false,
-    false,
-    1675,
-    descriptor_table_protodef_little_5fgoal_2eproto,
-    "little_goal.proto",
-    &descriptor_table_little_5fgoal_2eproto_once,
-    nullptr,
-    0,
-    19,
-    schemas,
-    file_default_instances,
-    TableStruct_little_5fgoal_2eproto::offsets,
-    file_level_enum_descriptors_little_5fgoal_2eproto,
-    file_level_service_descriptors_little_5fgoal_2eproto,
-};
-// ===================================================================
-
-class TradeFeedback::_Internal {
- public:
-};
-
-TradeFeedback::TradeFeedback(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:TradeFeedback)
-}
-inline PROTOBUF_NDEBUG_INLINE TradeFeedback::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::TradeFeedback& from_msg)
-      : stock_code_(arena, from.stock_code_),
-        order_time_(arena, from.order_time_),
-        _cached_size_{0} {}
-
-TradeFeedback::TradeFeedback(
-    ::google::protobuf::Arena* arena,
-    const TradeFeedback& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TradeFeedback* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, order_status_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, order_status_),
-           offsetof(Impl_, traded_vol_) -
-               offsetof(Impl_, order_status_) +
-               sizeof(Impl_::traded_vol_));
-
-  // @@protoc_insertion_point(copy_constructor:TradeFeedback)
-}
-inline PROTOBUF_NDEBUG_INLINE TradeFeedback::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : stock_code_(arena),
-        order_time_(arena),
-        _cached_size_{0} {}
-
-inline void TradeFeedback::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, order_status_),
-           0,
-           offsetof(Impl_, traded_vol_) -
-               offsetof(Impl_, order_status_) +
-               sizeof(Impl_::traded_vol_));
-}
-TradeFeedback::~TradeFeedback() {
-  // @@protoc_insertion_point(destructor:TradeFeedback)
-  SharedDtor(*this);
-}
-inline void TradeFeedback::SharedDtor(MessageLite& self) {
-  TradeFeedback& this_ = static_cast<TradeFeedback&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.order_time_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* TradeFeedback::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) TradeFeedback(arena);
-}
-constexpr auto TradeFeedback::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(TradeFeedback),
-                                            alignof(TradeFeedback));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull TradeFeedback::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_TradeFeedback_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &TradeFeedback::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<TradeFeedback>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &TradeFeedback::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<TradeFeedback>(), &TradeFeedback::ByteSizeLong,
-            &TradeFeedback::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_._cached_size_),
-        false,
-    },
-    &TradeFeedback::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* TradeFeedback::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 7, 0, 42, 2> TradeFeedback::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    7, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967168,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    7,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::TradeFeedback>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string stock_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.stock_code_)}},
-    // int32 order_status = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TradeFeedback, _impl_.order_status_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_status_)}},
-    // int32 order_id = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TradeFeedback, _impl_.order_id_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_id_)}},
-    // int32 order_type = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TradeFeedback, _impl_.order_type_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_type_)}},
-    // double traded_price = 5;
-    {::_pbi::TcParser::FastF64S1,
-     {41, 63, 0, PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.traded_price_)}},
-    // int32 traded_vol = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TradeFeedback, _impl_.traded_vol_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.traded_vol_)}},
-    // string order_time = 7;
-    {::_pbi::TcParser::FastUS1,
-     {58, 63, 0, PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_time_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string stock_code = 1;
-    {PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 order_status = 2;
-    {PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 order_id = 3;
-    {PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 order_type = 4;
-    {PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // double traded_price = 5;
-    {PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.traded_price_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // int32 traded_vol = 6;
-    {PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.traded_vol_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string order_time = 7;
-    {PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_time_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\15\12\0\0\0\0\0\12"
-    "TradeFeedback"
-    "stock_code"
-    "order_time"
-  }},
-};
-
-PROTOBUF_NOINLINE void TradeFeedback::Clear() {
-// @@protoc_insertion_point(message_clear_start:TradeFeedback)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.stock_code_.ClearToEmpty();
-  _impl_.order_time_.ClearToEmpty();
-  ::memset(&_impl_.order_status_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.traded_vol_) -
-      reinterpret_cast<char*>(&_impl_.order_status_)) + sizeof(_impl_.traded_vol_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* TradeFeedback::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const TradeFeedback& this_ = static_cast<const TradeFeedback&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* TradeFeedback::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const TradeFeedback& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:TradeFeedback)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string stock_code = 1;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "TradeFeedback.stock_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // int32 order_status = 2;
-          if (this_._internal_order_status() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_order_status(), target);
-          }
-
-          // int32 order_id = 3;
-          if (this_._internal_order_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_order_id(), target);
-          }
-
-          // int32 order_type = 4;
-          if (this_._internal_order_type() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_order_type(), target);
-          }
-
-          // double traded_price = 5;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_traded_price()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                5, this_._internal_traded_price(), target);
-          }
-
-          // int32 traded_vol = 6;
-          if (this_._internal_traded_vol() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<6>(
-                    stream, this_._internal_traded_vol(), target);
-          }
-
-          // string order_time = 7;
-          if (!this_._internal_order_time().empty()) {
-            const std::string& _s = this_._internal_order_time();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "TradeFeedback.order_time");
-            target = stream->WriteStringMaybeAliased(7, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:TradeFeedback)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t TradeFeedback::ByteSizeLong(const MessageLite& base) {
-          const TradeFeedback& this_ = static_cast<const TradeFeedback&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t TradeFeedback::ByteSizeLong() const {
-          const TradeFeedback& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:TradeFeedback)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string stock_code = 1;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-            // string order_time = 7;
-            if (!this_._internal_order_time().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_order_time());
-            }
-            // int32 order_status = 2;
-            if (this_._internal_order_status() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_status());
-            }
-            // int32 order_id = 3;
-            if (this_._internal_order_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_id());
-            }
-            // double traded_price = 5;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_traded_price()) != 0) {
-              total_size += 9;
-            }
-            // int32 order_type = 4;
-            if (this_._internal_order_type() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_type());
-            }
-            // int32 traded_vol = 6;
-            if (this_._internal_traded_vol() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_traded_vol());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void TradeFeedback::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<TradeFeedback*>(&to_msg);
-  auto& from = static_cast<const TradeFeedback&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:TradeFeedback)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  if (!from._internal_order_time().empty()) {
-    _this->_internal_set_order_time(from._internal_order_time());
-  }
-  if (from._internal_order_status() != 0) {
-    _this->_impl_.order_status_ = from._impl_.order_status_;
-  }
-  if (from._internal_order_id() != 0) {
-    _this->_impl_.order_id_ = from._impl_.order_id_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_traded_price()) != 0) {
-    _this->_impl_.traded_price_ = from._impl_.traded_price_;
-  }
-  if (from._internal_order_type() != 0) {
-    _this->_impl_.order_type_ = from._impl_.order_type_;
-  }
-  if (from._internal_traded_vol() != 0) {
-    _this->_impl_.traded_vol_ = from._impl_.traded_vol_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void TradeFeedback::CopyFrom(const TradeFeedback& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:TradeFeedback)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void TradeFeedback::InternalSwap(TradeFeedback* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.order_time_, &other->_impl_.order_time_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.traded_vol_)
-      + sizeof(TradeFeedback::_impl_.traded_vol_)
-      - PROTOBUF_FIELD_OFFSET(TradeFeedback, _impl_.order_status_)>(
-          reinterpret_cast<char*>(&_impl_.order_status_),
-          reinterpret_cast<char*>(&other->_impl_.order_status_));
-}
-
-::google::protobuf::Metadata TradeFeedback::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AccountInfo::_Internal {
- public:
-};
-
-AccountInfo::AccountInfo(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:AccountInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE AccountInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::AccountInfo& from_msg)
-      : account_id_(arena, from.account_id_),
-        _cached_size_{0} {}
-
-AccountInfo::AccountInfo(
-    ::google::protobuf::Arena* arena,
-    const AccountInfo& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AccountInfo* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, cash_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, cash_),
-           offsetof(Impl_, market_value_) -
-               offsetof(Impl_, cash_) +
-               sizeof(Impl_::market_value_));
-
-  // @@protoc_insertion_point(copy_constructor:AccountInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE AccountInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : account_id_(arena),
-        _cached_size_{0} {}
-
-inline void AccountInfo::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, cash_),
-           0,
-           offsetof(Impl_, market_value_) -
-               offsetof(Impl_, cash_) +
-               sizeof(Impl_::market_value_));
-}
-AccountInfo::~AccountInfo() {
-  // @@protoc_insertion_point(destructor:AccountInfo)
-  SharedDtor(*this);
-}
-inline void AccountInfo::SharedDtor(MessageLite& self) {
-  AccountInfo& this_ = static_cast<AccountInfo&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.account_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* AccountInfo::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AccountInfo(arena);
-}
-constexpr auto AccountInfo::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AccountInfo),
-                                            alignof(AccountInfo));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AccountInfo::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AccountInfo_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AccountInfo::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AccountInfo>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AccountInfo::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AccountInfo>(), &AccountInfo::ByteSizeLong,
-            &AccountInfo::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_._cached_size_),
-        false,
-    },
-    &AccountInfo::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AccountInfo::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 0, 30, 2> AccountInfo::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    5, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967264,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::AccountInfo>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string account_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.account_id_)}},
-    // double cash = 2;
-    {::_pbi::TcParser::FastF64S1,
-     {17, 63, 0, PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.cash_)}},
-    // double frozen_cash = 3;
-    {::_pbi::TcParser::FastF64S1,
-     {25, 63, 0, PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.frozen_cash_)}},
-    // double total_asset = 4;
-    {::_pbi::TcParser::FastF64S1,
-     {33, 63, 0, PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.total_asset_)}},
-    // double market_value = 5;
-    {::_pbi::TcParser::FastF64S1,
-     {41, 63, 0, PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.market_value_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string account_id = 1;
-    {PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.account_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // double cash = 2;
-    {PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.cash_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double frozen_cash = 3;
-    {PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.frozen_cash_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double total_asset = 4;
-    {PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.total_asset_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double market_value = 5;
-    {PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.market_value_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-  }},
-  // no aux_entries
-  {{
-    "\13\12\0\0\0\0\0\0"
-    "AccountInfo"
-    "account_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void AccountInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:AccountInfo)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.account_id_.ClearToEmpty();
-  ::memset(&_impl_.cash_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.market_value_) -
-      reinterpret_cast<char*>(&_impl_.cash_)) + sizeof(_impl_.market_value_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AccountInfo::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AccountInfo& this_ = static_cast<const AccountInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AccountInfo::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AccountInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:AccountInfo)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string account_id = 1;
-          if (!this_._internal_account_id().empty()) {
-            const std::string& _s = this_._internal_account_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "AccountInfo.account_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // double cash = 2;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_cash()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                2, this_._internal_cash(), target);
-          }
-
-          // double frozen_cash = 3;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_frozen_cash()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                3, this_._internal_frozen_cash(), target);
-          }
-
-          // double total_asset = 4;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_total_asset()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                4, this_._internal_total_asset(), target);
-          }
-
-          // double market_value = 5;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_market_value()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                5, this_._internal_market_value(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:AccountInfo)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AccountInfo::ByteSizeLong(const MessageLite& base) {
-          const AccountInfo& this_ = static_cast<const AccountInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AccountInfo::ByteSizeLong() const {
-          const AccountInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:AccountInfo)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string account_id = 1;
-            if (!this_._internal_account_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account_id());
-            }
-            // double cash = 2;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_cash()) != 0) {
-              total_size += 9;
-            }
-            // double frozen_cash = 3;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_frozen_cash()) != 0) {
-              total_size += 9;
-            }
-            // double total_asset = 4;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_total_asset()) != 0) {
-              total_size += 9;
-            }
-            // double market_value = 5;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_market_value()) != 0) {
-              total_size += 9;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AccountInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AccountInfo*>(&to_msg);
-  auto& from = static_cast<const AccountInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:AccountInfo)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_account_id().empty()) {
-    _this->_internal_set_account_id(from._internal_account_id());
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_cash()) != 0) {
-    _this->_impl_.cash_ = from._impl_.cash_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_frozen_cash()) != 0) {
-    _this->_impl_.frozen_cash_ = from._impl_.frozen_cash_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_total_asset()) != 0) {
-    _this->_impl_.total_asset_ = from._impl_.total_asset_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_market_value()) != 0) {
-    _this->_impl_.market_value_ = from._impl_.market_value_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AccountInfo::CopyFrom(const AccountInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:AccountInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AccountInfo::InternalSwap(AccountInfo* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_id_, &other->_impl_.account_id_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.market_value_)
-      + sizeof(AccountInfo::_impl_.market_value_)
-      - PROTOBUF_FIELD_OFFSET(AccountInfo, _impl_.cash_)>(
-          reinterpret_cast<char*>(&_impl_.cash_),
-          reinterpret_cast<char*>(&other->_impl_.cash_));
-}
-
-::google::protobuf::Metadata AccountInfo::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AccountInfoResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<AccountInfoResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(AccountInfoResponse, _impl_._has_bits_);
-};
-
-AccountInfoResponse::AccountInfoResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:AccountInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE AccountInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::AccountInfoResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        status_(arena, from.status_) {}
-
-AccountInfoResponse::AccountInfoResponse(
-    ::google::protobuf::Arena* arena,
-    const AccountInfoResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AccountInfoResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.data_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::AccountInfo>(
-                              arena, *from._impl_.data_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:AccountInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE AccountInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        status_(arena) {}
-
-inline void AccountInfoResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.data_ = {};
-}
-AccountInfoResponse::~AccountInfoResponse() {
-  // @@protoc_insertion_point(destructor:AccountInfoResponse)
-  SharedDtor(*this);
-}
-inline void AccountInfoResponse::SharedDtor(MessageLite& self) {
-  AccountInfoResponse& this_ = static_cast<AccountInfoResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  delete this_._impl_.data_;
-  this_._impl_.~Impl_();
-}
-
-inline void* AccountInfoResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AccountInfoResponse(arena);
-}
-constexpr auto AccountInfoResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AccountInfoResponse),
-                                            alignof(AccountInfoResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AccountInfoResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AccountInfoResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AccountInfoResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AccountInfoResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AccountInfoResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AccountInfoResponse>(), &AccountInfoResponse::ByteSizeLong,
-            &AccountInfoResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AccountInfoResponse, _impl_._cached_size_),
-        false,
-    },
-    &AccountInfoResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AccountInfoResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 34, 2> AccountInfoResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(AccountInfoResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::AccountInfoResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .AccountInfo data = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 0, 0, PROTOBUF_FIELD_OFFSET(AccountInfoResponse, _impl_.data_)}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(AccountInfoResponse, _impl_.status_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(AccountInfoResponse, _impl_.status_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // .AccountInfo data = 2;
-    {PROTOBUF_FIELD_OFFSET(AccountInfoResponse, _impl_.data_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::AccountInfo>()},
-  }}, {{
-    "\23\6\0\0\0\0\0\0"
-    "AccountInfoResponse"
-    "status"
-  }},
-};
-
-PROTOBUF_NOINLINE void AccountInfoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:AccountInfoResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.status_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.data_ != nullptr);
-    _impl_.data_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AccountInfoResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AccountInfoResponse& this_ = static_cast<const AccountInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AccountInfoResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AccountInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:AccountInfoResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "AccountInfoResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .AccountInfo data = 2;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.data_, this_._impl_.data_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:AccountInfoResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AccountInfoResponse::ByteSizeLong(const MessageLite& base) {
-          const AccountInfoResponse& this_ = static_cast<const AccountInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AccountInfoResponse::ByteSizeLong() const {
-          const AccountInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:AccountInfoResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-          }
-           {
-            // .AccountInfo data = 2;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.data_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AccountInfoResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AccountInfoResponse*>(&to_msg);
-  auto& from = static_cast<const AccountInfoResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:AccountInfoResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.data_ != nullptr);
-    if (_this->_impl_.data_ == nullptr) {
-      _this->_impl_.data_ =
-          ::google::protobuf::Message::CopyConstruct<::AccountInfo>(arena, *from._impl_.data_);
-    } else {
-      _this->_impl_.data_->MergeFrom(*from._impl_.data_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AccountInfoResponse::CopyFrom(const AccountInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:AccountInfoResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AccountInfoResponse::InternalSwap(AccountInfoResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-  swap(_impl_.data_, other->_impl_.data_);
-}
-
-::google::protobuf::Metadata AccountInfoResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class Position::_Internal {
- public:
-};
-
-Position::Position(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:Position)
-}
-inline PROTOBUF_NDEBUG_INLINE Position::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::Position& from_msg)
-      : account_id_(arena, from.account_id_),
-        stock_code_(arena, from.stock_code_),
-        _cached_size_{0} {}
-
-Position::Position(
-    ::google::protobuf::Arena* arena,
-    const Position& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  Position* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, vol_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, vol_),
-           offsetof(Impl_, avg_cost_) -
-               offsetof(Impl_, vol_) +
-               sizeof(Impl_::avg_cost_));
-
-  // @@protoc_insertion_point(copy_constructor:Position)
-}
-inline PROTOBUF_NDEBUG_INLINE Position::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : account_id_(arena),
-        stock_code_(arena),
-        _cached_size_{0} {}
-
-inline void Position::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, vol_),
-           0,
-           offsetof(Impl_, avg_cost_) -
-               offsetof(Impl_, vol_) +
-               sizeof(Impl_::avg_cost_));
-}
-Position::~Position() {
-  // @@protoc_insertion_point(destructor:Position)
-  SharedDtor(*this);
-}
-inline void Position::SharedDtor(MessageLite& self) {
-  Position& this_ = static_cast<Position&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.account_id_.Destroy();
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* Position::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) Position(arena);
-}
-constexpr auto Position::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(Position),
-                                            alignof(Position));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull Position::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_Position_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &Position::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<Position>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &Position::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<Position>(), &Position::ByteSizeLong,
-            &Position::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(Position, _impl_._cached_size_),
-        false,
-    },
-    &Position::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* Position::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 0, 37, 2> Position::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    5, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967264,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::Position>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string account_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.account_id_)}},
-    // string stock_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.stock_code_)}},
-    // int32 vol = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Position, _impl_.vol_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.vol_)}},
-    // int32 available_vol = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Position, _impl_.available_vol_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.available_vol_)}},
-    // double avg_cost = 5;
-    {::_pbi::TcParser::FastF64S1,
-     {41, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.avg_cost_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string account_id = 1;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.account_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string stock_code = 2;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 vol = 3;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.vol_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 available_vol = 4;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.available_vol_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // double avg_cost = 5;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.avg_cost_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-  }},
-  // no aux_entries
-  {{
-    "\10\12\12\0\0\0\0\0"
-    "Position"
-    "account_id"
-    "stock_code"
-  }},
-};
-
-PROTOBUF_NOINLINE void Position::Clear() {
-// @@protoc_insertion_point(message_clear_start:Position)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.account_id_.ClearToEmpty();
-  _impl_.stock_code_.ClearToEmpty();
-  ::memset(&_impl_.vol_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.avg_cost_) -
-      reinterpret_cast<char*>(&_impl_.vol_)) + sizeof(_impl_.avg_cost_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* Position::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const Position& this_ = static_cast<const Position&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* Position::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const Position& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:Position)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string account_id = 1;
-          if (!this_._internal_account_id().empty()) {
-            const std::string& _s = this_._internal_account_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Position.account_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string stock_code = 2;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Position.stock_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int32 vol = 3;
-          if (this_._internal_vol() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_vol(), target);
-          }
-
-          // int32 available_vol = 4;
-          if (this_._internal_available_vol() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_available_vol(), target);
-          }
-
-          // double avg_cost = 5;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_avg_cost()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                5, this_._internal_avg_cost(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:Position)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t Position::ByteSizeLong(const MessageLite& base) {
-          const Position& this_ = static_cast<const Position&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t Position::ByteSizeLong() const {
-          const Position& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:Position)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string account_id = 1;
-            if (!this_._internal_account_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account_id());
-            }
-            // string stock_code = 2;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-            // int32 vol = 3;
-            if (this_._internal_vol() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_vol());
-            }
-            // int32 available_vol = 4;
-            if (this_._internal_available_vol() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_available_vol());
-            }
-            // double avg_cost = 5;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_avg_cost()) != 0) {
-              total_size += 9;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void Position::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<Position*>(&to_msg);
-  auto& from = static_cast<const Position&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Position)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_account_id().empty()) {
-    _this->_internal_set_account_id(from._internal_account_id());
-  }
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  if (from._internal_vol() != 0) {
-    _this->_impl_.vol_ = from._impl_.vol_;
-  }
-  if (from._internal_available_vol() != 0) {
-    _this->_impl_.available_vol_ = from._impl_.available_vol_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_avg_cost()) != 0) {
-    _this->_impl_.avg_cost_ = from._impl_.avg_cost_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Position::CopyFrom(const Position& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Position)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void Position::InternalSwap(Position* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_id_, &other->_impl_.account_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Position, _impl_.avg_cost_)
-      + sizeof(Position::_impl_.avg_cost_)
-      - PROTOBUF_FIELD_OFFSET(Position, _impl_.vol_)>(
-          reinterpret_cast<char*>(&_impl_.vol_),
-          reinterpret_cast<char*>(&other->_impl_.vol_));
-}
-
-::google::protobuf::Metadata Position::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class PositionsResponse::_Internal {
- public:
-};
-
-PositionsResponse::PositionsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:PositionsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE PositionsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::PositionsResponse& from_msg)
-      : positions_{visibility, arena, from.positions_},
-        status_(arena, from.status_),
-        _cached_size_{0} {}
-
-PositionsResponse::PositionsResponse(
-    ::google::protobuf::Arena* arena,
-    const PositionsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  PositionsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:PositionsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE PositionsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : positions_{visibility, arena},
-        status_(arena),
-        _cached_size_{0} {}
-
-inline void PositionsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-PositionsResponse::~PositionsResponse() {
-  // @@protoc_insertion_point(destructor:PositionsResponse)
-  SharedDtor(*this);
-}
-inline void PositionsResponse::SharedDtor(MessageLite& self) {
-  PositionsResponse& this_ = static_cast<PositionsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PositionsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) PositionsResponse(arena);
-}
-constexpr auto PositionsResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(PositionsResponse, _impl_.positions_) +
-          decltype(PositionsResponse::_impl_.positions_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(PositionsResponse), alignof(PositionsResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&PositionsResponse::PlacementNew_,
-                                 sizeof(PositionsResponse),
-                                 alignof(PositionsResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull PositionsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_PositionsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &PositionsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<PositionsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &PositionsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<PositionsResponse>(), &PositionsResponse::ByteSizeLong,
-            &PositionsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(PositionsResponse, _impl_._cached_size_),
-        false,
-    },
-    &PositionsResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* PositionsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 32, 2> PositionsResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::PositionsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .Position positions = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(PositionsResponse, _impl_.positions_)}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(PositionsResponse, _impl_.status_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(PositionsResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated .Position positions = 2;
-    {PROTOBUF_FIELD_OFFSET(PositionsResponse, _impl_.positions_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::Position>()},
-  }}, {{
-    "\21\6\0\0\0\0\0\0"
-    "PositionsResponse"
-    "status"
-  }},
-};
-
-PROTOBUF_NOINLINE void PositionsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:PositionsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.positions_.Clear();
-  _impl_.status_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* PositionsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const PositionsResponse& this_ = static_cast<const PositionsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* PositionsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const PositionsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:PositionsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "PositionsResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // repeated .Position positions = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_positions_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_positions().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:PositionsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t PositionsResponse::ByteSizeLong(const MessageLite& base) {
-          const PositionsResponse& this_ = static_cast<const PositionsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t PositionsResponse::ByteSizeLong() const {
-          const PositionsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:PositionsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .Position positions = 2;
-            {
-              total_size += 1UL * this_._internal_positions_size();
-              for (const auto& msg : this_._internal_positions()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void PositionsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<PositionsResponse*>(&to_msg);
-  auto& from = static_cast<const PositionsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:PositionsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_positions()->MergeFrom(
-      from._internal_positions());
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void PositionsResponse::CopyFrom(const PositionsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:PositionsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void PositionsResponse::InternalSwap(PositionsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.positions_.InternalSwap(&other->_impl_.positions_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-}
-
-::google::protobuf::Metadata PositionsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class Order::_Internal {
- public:
-};
-
-Order::Order(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:Order)
-}
-inline PROTOBUF_NDEBUG_INLINE Order::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::Order& from_msg)
-      : account_id_(arena, from.account_id_),
-        stock_code_(arena, from.stock_code_),
-        order_time_(arena, from.order_time_),
-        _cached_size_{0} {}
-
-Order::Order(
-    ::google::protobuf::Arena* arena,
-    const Order& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  Order* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, order_id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, order_id_),
-           offsetof(Impl_, order_status_) -
-               offsetof(Impl_, order_id_) +
-               sizeof(Impl_::order_status_));
-
-  // @@protoc_insertion_point(copy_constructor:Order)
-}
-inline PROTOBUF_NDEBUG_INLINE Order::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : account_id_(arena),
-        stock_code_(arena),
-        order_time_(arena),
-        _cached_size_{0} {}
-
-inline void Order::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, order_id_),
-           0,
-           offsetof(Impl_, order_status_) -
-               offsetof(Impl_, order_id_) +
-               sizeof(Impl_::order_status_));
-}
-Order::~Order() {
-  // @@protoc_insertion_point(destructor:Order)
-  SharedDtor(*this);
-}
-inline void Order::SharedDtor(MessageLite& self) {
-  Order& this_ = static_cast<Order&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.account_id_.Destroy();
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.order_time_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* Order::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) Order(arena);
-}
-constexpr auto Order::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(Order),
-                                            alignof(Order));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull Order::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_Order_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &Order::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<Order>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &Order::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<Order>(), &Order::ByteSizeLong,
-            &Order::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(Order, _impl_._cached_size_),
-        false,
-    },
-    &Order::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* Order::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<4, 10, 0, 52, 2> Order::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    10, 120,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294966272,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    10,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::Order>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string account_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.account_id_)}},
-    // string stock_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.stock_code_)}},
-    // int32 order_id = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Order, _impl_.order_id_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.order_id_)}},
-    // string order_time = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.order_time_)}},
-    // int32 order_type = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Order, _impl_.order_type_), 63>(),
-     {40, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.order_type_)}},
-    // int32 order_vol = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Order, _impl_.order_vol_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.order_vol_)}},
-    // int32 price_type = 7;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Order, _impl_.price_type_), 63>(),
-     {56, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.price_type_)}},
-    // double price = 8;
-    {::_pbi::TcParser::FastF64S1,
-     {65, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.price_)}},
-    // int32 traded_vol = 9;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Order, _impl_.traded_vol_), 63>(),
-     {72, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.traded_vol_)}},
-    // int32 order_status = 10;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Order, _impl_.order_status_), 63>(),
-     {80, 63, 0, PROTOBUF_FIELD_OFFSET(Order, _impl_.order_status_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string account_id = 1;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.account_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string stock_code = 2;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 order_id = 3;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.order_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string order_time = 4;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.order_time_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 order_type = 5;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.order_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 order_vol = 6;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.order_vol_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 price_type = 7;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.price_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // double price = 8;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.price_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // int32 traded_vol = 9;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.traded_vol_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int32 order_status = 10;
-    {PROTOBUF_FIELD_OFFSET(Order, _impl_.order_status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\5\12\12\0\12\0\0\0\0\0\0\0\0\0\0\0"
-    "Order"
-    "account_id"
-    "stock_code"
-    "order_time"
-  }},
-};
-
-PROTOBUF_NOINLINE void Order::Clear() {
-// @@protoc_insertion_point(message_clear_start:Order)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.account_id_.ClearToEmpty();
-  _impl_.stock_code_.ClearToEmpty();
-  _impl_.order_time_.ClearToEmpty();
-  ::memset(&_impl_.order_id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.order_status_) -
-      reinterpret_cast<char*>(&_impl_.order_id_)) + sizeof(_impl_.order_status_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* Order::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const Order& this_ = static_cast<const Order&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* Order::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const Order& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:Order)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string account_id = 1;
-          if (!this_._internal_account_id().empty()) {
-            const std::string& _s = this_._internal_account_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Order.account_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string stock_code = 2;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Order.stock_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int32 order_id = 3;
-          if (this_._internal_order_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_order_id(), target);
-          }
-
-          // string order_time = 4;
-          if (!this_._internal_order_time().empty()) {
-            const std::string& _s = this_._internal_order_time();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Order.order_time");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // int32 order_type = 5;
-          if (this_._internal_order_type() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<5>(
-                    stream, this_._internal_order_type(), target);
-          }
-
-          // int32 order_vol = 6;
-          if (this_._internal_order_vol() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<6>(
-                    stream, this_._internal_order_vol(), target);
-          }
-
-          // int32 price_type = 7;
-          if (this_._internal_price_type() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<7>(
-                    stream, this_._internal_price_type(), target);
-          }
-
-          // double price = 8;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                8, this_._internal_price(), target);
-          }
-
-          // int32 traded_vol = 9;
-          if (this_._internal_traded_vol() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<9>(
-                    stream, this_._internal_traded_vol(), target);
-          }
-
-          // int32 order_status = 10;
-          if (this_._internal_order_status() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<10>(
-                    stream, this_._internal_order_status(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:Order)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t Order::ByteSizeLong(const MessageLite& base) {
-          const Order& this_ = static_cast<const Order&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t Order::ByteSizeLong() const {
-          const Order& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:Order)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string account_id = 1;
-            if (!this_._internal_account_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account_id());
-            }
-            // string stock_code = 2;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-            // string order_time = 4;
-            if (!this_._internal_order_time().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_order_time());
-            }
-            // int32 order_id = 3;
-            if (this_._internal_order_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_id());
-            }
-            // int32 order_type = 5;
-            if (this_._internal_order_type() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_type());
-            }
-            // int32 order_vol = 6;
-            if (this_._internal_order_vol() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_vol());
-            }
-            // int32 price_type = 7;
-            if (this_._internal_price_type() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_price_type());
-            }
-            // double price = 8;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-              total_size += 9;
-            }
-            // int32 traded_vol = 9;
-            if (this_._internal_traded_vol() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_traded_vol());
-            }
-            // int32 order_status = 10;
-            if (this_._internal_order_status() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_status());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void Order::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<Order*>(&to_msg);
-  auto& from = static_cast<const Order&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Order)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_account_id().empty()) {
-    _this->_internal_set_account_id(from._internal_account_id());
-  }
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  if (!from._internal_order_time().empty()) {
-    _this->_internal_set_order_time(from._internal_order_time());
-  }
-  if (from._internal_order_id() != 0) {
-    _this->_impl_.order_id_ = from._impl_.order_id_;
-  }
-  if (from._internal_order_type() != 0) {
-    _this->_impl_.order_type_ = from._impl_.order_type_;
-  }
-  if (from._internal_order_vol() != 0) {
-    _this->_impl_.order_vol_ = from._impl_.order_vol_;
-  }
-  if (from._internal_price_type() != 0) {
-    _this->_impl_.price_type_ = from._impl_.price_type_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_price()) != 0) {
-    _this->_impl_.price_ = from._impl_.price_;
-  }
-  if (from._internal_traded_vol() != 0) {
-    _this->_impl_.traded_vol_ = from._impl_.traded_vol_;
-  }
-  if (from._internal_order_status() != 0) {
-    _this->_impl_.order_status_ = from._impl_.order_status_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Order::CopyFrom(const Order& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Order)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void Order::InternalSwap(Order* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_id_, &other->_impl_.account_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.order_time_, &other->_impl_.order_time_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Order, _impl_.order_status_)
-      + sizeof(Order::_impl_.order_status_)
-      - PROTOBUF_FIELD_OFFSET(Order, _impl_.order_id_)>(
-          reinterpret_cast<char*>(&_impl_.order_id_),
-          reinterpret_cast<char*>(&other->_impl_.order_id_));
-}
-
-::google::protobuf::Metadata Order::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class OrderResponse::_Internal {
- public:
-};
-
-OrderResponse::OrderResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:OrderResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE OrderResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::OrderResponse& from_msg)
-      : orders_{visibility, arena, from.orders_},
-        status_(arena, from.status_),
-        _cached_size_{0} {}
-
-OrderResponse::OrderResponse(
-    ::google::protobuf::Arena* arena,
-    const OrderResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  OrderResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:OrderResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE OrderResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : orders_{visibility, arena},
-        status_(arena),
-        _cached_size_{0} {}
-
-inline void OrderResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-OrderResponse::~OrderResponse() {
-  // @@protoc_insertion_point(destructor:OrderResponse)
-  SharedDtor(*this);
-}
-inline void OrderResponse::SharedDtor(MessageLite& self) {
-  OrderResponse& this_ = static_cast<OrderResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* OrderResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) OrderResponse(arena);
-}
-constexpr auto OrderResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.orders_) +
-          decltype(OrderResponse::_impl_.orders_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(OrderResponse), alignof(OrderResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&OrderResponse::PlacementNew_,
-                                 sizeof(OrderResponse),
-                                 alignof(OrderResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull OrderResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_OrderResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &OrderResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<OrderResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &OrderResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<OrderResponse>(), &OrderResponse::ByteSizeLong,
-            &OrderResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_._cached_size_),
-        false,
-    },
-    &OrderResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* OrderResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 28, 2> OrderResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::OrderResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .Order orders = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.orders_)}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.status_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated .Order orders = 2;
-    {PROTOBUF_FIELD_OFFSET(OrderResponse, _impl_.orders_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::Order>()},
-  }}, {{
-    "\15\6\0\0\0\0\0\0"
-    "OrderResponse"
-    "status"
-  }},
-};
-
-PROTOBUF_NOINLINE void OrderResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:OrderResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.orders_.Clear();
-  _impl_.status_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* OrderResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const OrderResponse& this_ = static_cast<const OrderResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* OrderResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const OrderResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:OrderResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "OrderResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // repeated .Order orders = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_orders_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_orders().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:OrderResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t OrderResponse::ByteSizeLong(const MessageLite& base) {
-          const OrderResponse& this_ = static_cast<const OrderResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t OrderResponse::ByteSizeLong() const {
-          const OrderResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:OrderResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .Order orders = 2;
-            {
-              total_size += 1UL * this_._internal_orders_size();
-              for (const auto& msg : this_._internal_orders()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void OrderResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<OrderResponse*>(&to_msg);
-  auto& from = static_cast<const OrderResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:OrderResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_orders()->MergeFrom(
-      from._internal_orders());
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void OrderResponse::CopyFrom(const OrderResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:OrderResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void OrderResponse::InternalSwap(OrderResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.orders_.InternalSwap(&other->_impl_.orders_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-}
-
-::google::protobuf::Metadata OrderResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class Trade::_Internal {
- public:
-};
-
-Trade::Trade(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:Trade)
-}
-inline PROTOBUF_NDEBUG_INLINE Trade::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::Trade& from_msg)
-      : account_id_(arena, from.account_id_),
-        stock_code_(arena, from.stock_code_),
-        traded_id_(arena, from.traded_id_),
-        traded_time_(arena, from.traded_time_),
-        _cached_size_{0} {}
-
-Trade::Trade(
-    ::google::protobuf::Arena* arena,
-    const Trade& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  Trade* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, order_type_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, order_type_),
-           offsetof(Impl_, traded_price_) -
-               offsetof(Impl_, order_type_) +
-               sizeof(Impl_::traded_price_));
-
-  // @@protoc_insertion_point(copy_constructor:Trade)
-}
-inline PROTOBUF_NDEBUG_INLINE Trade::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : account_id_(arena),
-        stock_code_(arena),
-        traded_id_(arena),
-        traded_time_(arena),
-        _cached_size_{0} {}
-
-inline void Trade::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, order_type_),
-           0,
-           offsetof(Impl_, traded_price_) -
-               offsetof(Impl_, order_type_) +
-               sizeof(Impl_::traded_price_));
-}
-Trade::~Trade() {
-  // @@protoc_insertion_point(destructor:Trade)
-  SharedDtor(*this);
-}
-inline void Trade::SharedDtor(MessageLite& self) {
-  Trade& this_ = static_cast<Trade&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.account_id_.Destroy();
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.traded_id_.Destroy();
-  this_._impl_.traded_time_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* Trade::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) Trade(arena);
-}
-constexpr auto Trade::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(Trade),
-                                            alignof(Trade));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull Trade::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_Trade_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &Trade::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<Trade>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &Trade::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<Trade>(), &Trade::ByteSizeLong,
-            &Trade::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(Trade, _impl_._cached_size_),
-        false,
-    },
-    &Trade::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* Trade::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 7, 0, 54, 2> Trade::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    7, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967168,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    7,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::Trade>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string account_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Trade, _impl_.account_id_)}},
-    // string stock_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(Trade, _impl_.stock_code_)}},
-    // int32 order_type = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Trade, _impl_.order_type_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(Trade, _impl_.order_type_)}},
-    // string traded_id = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_id_)}},
-    // string traded_time = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_time_)}},
-    // double traded_price = 6;
-    {::_pbi::TcParser::FastF64S1,
-     {49, 63, 0, PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_price_)}},
-    // int32 traded_vol = 7;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Trade, _impl_.traded_vol_), 63>(),
-     {56, 63, 0, PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_vol_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string account_id = 1;
-    {PROTOBUF_FIELD_OFFSET(Trade, _impl_.account_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string stock_code = 2;
-    {PROTOBUF_FIELD_OFFSET(Trade, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 order_type = 3;
-    {PROTOBUF_FIELD_OFFSET(Trade, _impl_.order_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string traded_id = 4;
-    {PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string traded_time = 5;
-    {PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_time_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // double traded_price = 6;
-    {PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_price_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // int32 traded_vol = 7;
-    {PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_vol_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\5\12\12\0\11\13\0\0"
-    "Trade"
-    "account_id"
-    "stock_code"
-    "traded_id"
-    "traded_time"
-  }},
-};
-
-PROTOBUF_NOINLINE void Trade::Clear() {
-// @@protoc_insertion_point(message_clear_start:Trade)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.account_id_.ClearToEmpty();
-  _impl_.stock_code_.ClearToEmpty();
-  _impl_.traded_id_.ClearToEmpty();
-  _impl_.traded_time_.ClearToEmpty();
-  ::memset(&_impl_.order_type_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.traded_price_) -
-      reinterpret_cast<char*>(&_impl_.order_type_)) + sizeof(_impl_.traded_price_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* Trade::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const Trade& this_ = static_cast<const Trade&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* Trade::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const Trade& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:Trade)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string account_id = 1;
-          if (!this_._internal_account_id().empty()) {
-            const std::string& _s = this_._internal_account_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Trade.account_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string stock_code = 2;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Trade.stock_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int32 order_type = 3;
-          if (this_._internal_order_type() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_order_type(), target);
-          }
-
-          // string traded_id = 4;
-          if (!this_._internal_traded_id().empty()) {
-            const std::string& _s = this_._internal_traded_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Trade.traded_id");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string traded_time = 5;
-          if (!this_._internal_traded_time().empty()) {
-            const std::string& _s = this_._internal_traded_time();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Trade.traded_time");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // double traded_price = 6;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_traded_price()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                6, this_._internal_traded_price(), target);
-          }
-
-          // int32 traded_vol = 7;
-          if (this_._internal_traded_vol() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<7>(
-                    stream, this_._internal_traded_vol(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:Trade)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t Trade::ByteSizeLong(const MessageLite& base) {
-          const Trade& this_ = static_cast<const Trade&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t Trade::ByteSizeLong() const {
-          const Trade& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:Trade)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string account_id = 1;
-            if (!this_._internal_account_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account_id());
-            }
-            // string stock_code = 2;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-            // string traded_id = 4;
-            if (!this_._internal_traded_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_traded_id());
-            }
-            // string traded_time = 5;
-            if (!this_._internal_traded_time().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_traded_time());
-            }
-            // int32 order_type = 3;
-            if (this_._internal_order_type() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_type());
-            }
-            // int32 traded_vol = 7;
-            if (this_._internal_traded_vol() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_traded_vol());
-            }
-            // double traded_price = 6;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_traded_price()) != 0) {
-              total_size += 9;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void Trade::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<Trade*>(&to_msg);
-  auto& from = static_cast<const Trade&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Trade)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_account_id().empty()) {
-    _this->_internal_set_account_id(from._internal_account_id());
-  }
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  if (!from._internal_traded_id().empty()) {
-    _this->_internal_set_traded_id(from._internal_traded_id());
-  }
-  if (!from._internal_traded_time().empty()) {
-    _this->_internal_set_traded_time(from._internal_traded_time());
-  }
-  if (from._internal_order_type() != 0) {
-    _this->_impl_.order_type_ = from._impl_.order_type_;
-  }
-  if (from._internal_traded_vol() != 0) {
-    _this->_impl_.traded_vol_ = from._impl_.traded_vol_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_traded_price()) != 0) {
-    _this->_impl_.traded_price_ = from._impl_.traded_price_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Trade::CopyFrom(const Trade& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Trade)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void Trade::InternalSwap(Trade* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_id_, &other->_impl_.account_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.traded_id_, &other->_impl_.traded_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.traded_time_, &other->_impl_.traded_time_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Trade, _impl_.traded_price_)
-      + sizeof(Trade::_impl_.traded_price_)
-      - PROTOBUF_FIELD_OFFSET(Trade, _impl_.order_type_)>(
-          reinterpret_cast<char*>(&_impl_.order_type_),
-          reinterpret_cast<char*>(&other->_impl_.order_type_));
-}
-
-::google::protobuf::Metadata Trade::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class TradeResponse::_Internal {
- public:
-};
-
-TradeResponse::TradeResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:TradeResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE TradeResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::TradeResponse& from_msg)
-      : trades_{visibility, arena, from.trades_},
-        status_(arena, from.status_),
-        _cached_size_{0} {}
-
-TradeResponse::TradeResponse(
-    ::google::protobuf::Arena* arena,
-    const TradeResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TradeResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:TradeResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE TradeResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : trades_{visibility, arena},
-        status_(arena),
-        _cached_size_{0} {}
-
-inline void TradeResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-TradeResponse::~TradeResponse() {
-  // @@protoc_insertion_point(destructor:TradeResponse)
-  SharedDtor(*this);
-}
-inline void TradeResponse::SharedDtor(MessageLite& self) {
-  TradeResponse& this_ = static_cast<TradeResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* TradeResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) TradeResponse(arena);
-}
-constexpr auto TradeResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(TradeResponse, _impl_.trades_) +
-          decltype(TradeResponse::_impl_.trades_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(TradeResponse), alignof(TradeResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&TradeResponse::PlacementNew_,
-                                 sizeof(TradeResponse),
-                                 alignof(TradeResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull TradeResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_TradeResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &TradeResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<TradeResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &TradeResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<TradeResponse>(), &TradeResponse::ByteSizeLong,
-            &TradeResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(TradeResponse, _impl_._cached_size_),
-        false,
-    },
-    &TradeResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* TradeResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 28, 2> TradeResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::TradeResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .Trade trades = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(TradeResponse, _impl_.trades_)}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(TradeResponse, _impl_.status_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(TradeResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated .Trade trades = 2;
-    {PROTOBUF_FIELD_OFFSET(TradeResponse, _impl_.trades_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::Trade>()},
-  }}, {{
-    "\15\6\0\0\0\0\0\0"
-    "TradeResponse"
-    "status"
-  }},
-};
-
-PROTOBUF_NOINLINE void TradeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:TradeResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.trades_.Clear();
-  _impl_.status_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* TradeResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const TradeResponse& this_ = static_cast<const TradeResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* TradeResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const TradeResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:TradeResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "TradeResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // repeated .Trade trades = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_trades_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_trades().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:TradeResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t TradeResponse::ByteSizeLong(const MessageLite& base) {
-          const TradeResponse& this_ = static_cast<const TradeResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t TradeResponse::ByteSizeLong() const {
-          const TradeResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:TradeResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .Trade trades = 2;
-            {
-              total_size += 1UL * this_._internal_trades_size();
-              for (const auto& msg : this_._internal_trades()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void TradeResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<TradeResponse*>(&to_msg);
-  auto& from = static_cast<const TradeResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:TradeResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_trades()->MergeFrom(
-      from._internal_trades());
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void TradeResponse::CopyFrom(const TradeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:TradeResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void TradeResponse::InternalSwap(TradeResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.trades_.InternalSwap(&other->_impl_.trades_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-}
-
-::google::protobuf::Metadata TradeResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class PlaceOrder::_Internal {
- public:
-};
-
-PlaceOrder::PlaceOrder(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:PlaceOrder)
-}
-inline PROTOBUF_NDEBUG_INLINE PlaceOrder::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::PlaceOrder& from_msg)
-      : account_id_(arena, from.account_id_),
-        stock_code_(arena, from.stock_code_),
-        order_type_(arena, from.order_type_),
-        place_type_(arena, from.place_type_),
-        _cached_size_{0} {}
-
-PlaceOrder::PlaceOrder(
-    ::google::protobuf::Arena* arena,
-    const PlaceOrder& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  PlaceOrder* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, price_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, price_),
-           offsetof(Impl_, how_many_) -
-               offsetof(Impl_, price_) +
-               sizeof(Impl_::how_many_));
-
-  // @@protoc_insertion_point(copy_constructor:PlaceOrder)
-}
-inline PROTOBUF_NDEBUG_INLINE PlaceOrder::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : account_id_(arena),
-        stock_code_(arena),
-        order_type_(arena),
-        place_type_(arena),
-        _cached_size_{0} {}
-
-inline void PlaceOrder::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, price_),
-           0,
-           offsetof(Impl_, how_many_) -
-               offsetof(Impl_, price_) +
-               sizeof(Impl_::how_many_));
-}
-PlaceOrder::~PlaceOrder() {
-  // @@protoc_insertion_point(destructor:PlaceOrder)
-  SharedDtor(*this);
-}
-inline void PlaceOrder::SharedDtor(MessageLite& self) {
-  PlaceOrder& this_ = static_cast<PlaceOrder&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.account_id_.Destroy();
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.order_type_.Destroy();
-  this_._impl_.place_type_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PlaceOrder::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) PlaceOrder(arena);
-}
-constexpr auto PlaceOrder::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(PlaceOrder),
-                                            alignof(PlaceOrder));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull PlaceOrder::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_PlaceOrder_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &PlaceOrder::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<PlaceOrder>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &PlaceOrder::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<PlaceOrder>(), &PlaceOrder::ByteSizeLong,
-            &PlaceOrder::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_._cached_size_),
-        false,
-    },
-    &PlaceOrder::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* PlaceOrder::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 59, 2> PlaceOrder::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::PlaceOrder>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string account_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.account_id_)}},
-    // string stock_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.stock_code_)}},
-    // int32 how_many = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(PlaceOrder, _impl_.how_many_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.how_many_)}},
-    // double price = 4;
-    {::_pbi::TcParser::FastF64S1,
-     {33, 63, 0, PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.price_)}},
-    // string order_type = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.order_type_)}},
-    // string place_type = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.place_type_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string account_id = 1;
-    {PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.account_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string stock_code = 2;
-    {PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 how_many = 3;
-    {PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.how_many_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // double price = 4;
-    {PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.price_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // string order_type = 5;
-    {PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.order_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string place_type = 6;
-    {PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.place_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\12\12\12\0\0\12\12\0"
-    "PlaceOrder"
-    "account_id"
-    "stock_code"
-    "order_type"
-    "place_type"
-  }},
-};
-
-PROTOBUF_NOINLINE void PlaceOrder::Clear() {
-// @@protoc_insertion_point(message_clear_start:PlaceOrder)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.account_id_.ClearToEmpty();
-  _impl_.stock_code_.ClearToEmpty();
-  _impl_.order_type_.ClearToEmpty();
-  _impl_.place_type_.ClearToEmpty();
-  ::memset(&_impl_.price_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.how_many_) -
-      reinterpret_cast<char*>(&_impl_.price_)) + sizeof(_impl_.how_many_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* PlaceOrder::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const PlaceOrder& this_ = static_cast<const PlaceOrder&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* PlaceOrder::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const PlaceOrder& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:PlaceOrder)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string account_id = 1;
-          if (!this_._internal_account_id().empty()) {
-            const std::string& _s = this_._internal_account_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "PlaceOrder.account_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string stock_code = 2;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "PlaceOrder.stock_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int32 how_many = 3;
-          if (this_._internal_how_many() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_how_many(), target);
-          }
-
-          // double price = 4;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                4, this_._internal_price(), target);
-          }
-
-          // string order_type = 5;
-          if (!this_._internal_order_type().empty()) {
-            const std::string& _s = this_._internal_order_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "PlaceOrder.order_type");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // string place_type = 6;
-          if (!this_._internal_place_type().empty()) {
-            const std::string& _s = this_._internal_place_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "PlaceOrder.place_type");
-            target = stream->WriteStringMaybeAliased(6, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:PlaceOrder)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t PlaceOrder::ByteSizeLong(const MessageLite& base) {
-          const PlaceOrder& this_ = static_cast<const PlaceOrder&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t PlaceOrder::ByteSizeLong() const {
-          const PlaceOrder& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:PlaceOrder)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string account_id = 1;
-            if (!this_._internal_account_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account_id());
-            }
-            // string stock_code = 2;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-            // string order_type = 5;
-            if (!this_._internal_order_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_order_type());
-            }
-            // string place_type = 6;
-            if (!this_._internal_place_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_place_type());
-            }
-            // double price = 4;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_price()) != 0) {
-              total_size += 9;
-            }
-            // int32 how_many = 3;
-            if (this_._internal_how_many() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_how_many());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void PlaceOrder::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<PlaceOrder*>(&to_msg);
-  auto& from = static_cast<const PlaceOrder&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:PlaceOrder)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_account_id().empty()) {
-    _this->_internal_set_account_id(from._internal_account_id());
-  }
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  if (!from._internal_order_type().empty()) {
-    _this->_internal_set_order_type(from._internal_order_type());
-  }
-  if (!from._internal_place_type().empty()) {
-    _this->_internal_set_place_type(from._internal_place_type());
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_price()) != 0) {
-    _this->_impl_.price_ = from._impl_.price_;
-  }
-  if (from._internal_how_many() != 0) {
-    _this->_impl_.how_many_ = from._impl_.how_many_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void PlaceOrder::CopyFrom(const PlaceOrder& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:PlaceOrder)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void PlaceOrder::InternalSwap(PlaceOrder* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_id_, &other->_impl_.account_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.order_type_, &other->_impl_.order_type_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.place_type_, &other->_impl_.place_type_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.how_many_)
-      + sizeof(PlaceOrder::_impl_.how_many_)
-      - PROTOBUF_FIELD_OFFSET(PlaceOrder, _impl_.price_)>(
-          reinterpret_cast<char*>(&_impl_.price_),
-          reinterpret_cast<char*>(&other->_impl_.price_));
-}
-
-::google::protobuf::Metadata PlaceOrder::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class PlaceOrderResponse::_Internal {
- public:
-};
-
-PlaceOrderResponse::PlaceOrderResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:PlaceOrderResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE PlaceOrderResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::PlaceOrderResponse& from_msg)
-      : status_(arena, from.status_),
-        msg_(arena, from.msg_),
-        _cached_size_{0} {}
-
-PlaceOrderResponse::PlaceOrderResponse(
-    ::google::protobuf::Arena* arena,
-    const PlaceOrderResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  PlaceOrderResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:PlaceOrderResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE PlaceOrderResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : status_(arena),
-        msg_(arena),
-        _cached_size_{0} {}
-
-inline void PlaceOrderResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-PlaceOrderResponse::~PlaceOrderResponse() {
-  // @@protoc_insertion_point(destructor:PlaceOrderResponse)
-  SharedDtor(*this);
-}
-inline void PlaceOrderResponse::SharedDtor(MessageLite& self) {
-  PlaceOrderResponse& this_ = static_cast<PlaceOrderResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  this_._impl_.msg_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PlaceOrderResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) PlaceOrderResponse(arena);
-}
-constexpr auto PlaceOrderResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(PlaceOrderResponse),
-                                            alignof(PlaceOrderResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull PlaceOrderResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_PlaceOrderResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &PlaceOrderResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<PlaceOrderResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &PlaceOrderResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<PlaceOrderResponse>(), &PlaceOrderResponse::ByteSizeLong,
-            &PlaceOrderResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(PlaceOrderResponse, _impl_._cached_size_),
-        false,
-    },
-    &PlaceOrderResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* PlaceOrderResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 36, 2> PlaceOrderResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::PlaceOrderResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string msg = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(PlaceOrderResponse, _impl_.msg_)}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(PlaceOrderResponse, _impl_.status_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(PlaceOrderResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string msg = 2;
-    {PROTOBUF_FIELD_OFFSET(PlaceOrderResponse, _impl_.msg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\22\6\3\0\0\0\0\0"
-    "PlaceOrderResponse"
-    "status"
-    "msg"
-  }},
-};
-
-PROTOBUF_NOINLINE void PlaceOrderResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:PlaceOrderResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.status_.ClearToEmpty();
-  _impl_.msg_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* PlaceOrderResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const PlaceOrderResponse& this_ = static_cast<const PlaceOrderResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* PlaceOrderResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const PlaceOrderResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:PlaceOrderResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "PlaceOrderResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string msg = 2;
-          if (!this_._internal_msg().empty()) {
-            const std::string& _s = this_._internal_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "PlaceOrderResponse.msg");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:PlaceOrderResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t PlaceOrderResponse::ByteSizeLong(const MessageLite& base) {
-          const PlaceOrderResponse& this_ = static_cast<const PlaceOrderResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t PlaceOrderResponse::ByteSizeLong() const {
-          const PlaceOrderResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:PlaceOrderResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-            // string msg = 2;
-            if (!this_._internal_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msg());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void PlaceOrderResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<PlaceOrderResponse*>(&to_msg);
-  auto& from = static_cast<const PlaceOrderResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:PlaceOrderResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  if (!from._internal_msg().empty()) {
-    _this->_internal_set_msg(from._internal_msg());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void PlaceOrderResponse::CopyFrom(const PlaceOrderResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:PlaceOrderResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void PlaceOrderResponse::InternalSwap(PlaceOrderResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
-}
-
-::google::protobuf::Metadata PlaceOrderResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CancelOrderId::_Internal {
- public:
-};
-
-CancelOrderId::CancelOrderId(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:CancelOrderId)
-}
-CancelOrderId::CancelOrderId(
-    ::google::protobuf::Arena* arena, const CancelOrderId& from)
-    : CancelOrderId(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE CancelOrderId::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void CancelOrderId::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.order_id_ = {};
-}
-CancelOrderId::~CancelOrderId() {
-  // @@protoc_insertion_point(destructor:CancelOrderId)
-  SharedDtor(*this);
-}
-inline void CancelOrderId::SharedDtor(MessageLite& self) {
-  CancelOrderId& this_ = static_cast<CancelOrderId&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* CancelOrderId::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CancelOrderId(arena);
-}
-constexpr auto CancelOrderId::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(CancelOrderId),
-                                            alignof(CancelOrderId));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CancelOrderId::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CancelOrderId_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CancelOrderId::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CancelOrderId>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CancelOrderId::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CancelOrderId>(), &CancelOrderId::ByteSizeLong,
-            &CancelOrderId::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CancelOrderId, _impl_._cached_size_),
-        false,
-    },
-    &CancelOrderId::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CancelOrderId::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> CancelOrderId::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::CancelOrderId>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 order_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CancelOrderId, _impl_.order_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CancelOrderId, _impl_.order_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 order_id = 1;
-    {PROTOBUF_FIELD_OFFSET(CancelOrderId, _impl_.order_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void CancelOrderId::Clear() {
-// @@protoc_insertion_point(message_clear_start:CancelOrderId)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.order_id_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CancelOrderId::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CancelOrderId& this_ = static_cast<const CancelOrderId&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CancelOrderId::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CancelOrderId& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:CancelOrderId)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 order_id = 1;
-          if (this_._internal_order_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_order_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:CancelOrderId)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CancelOrderId::ByteSizeLong(const MessageLite& base) {
-          const CancelOrderId& this_ = static_cast<const CancelOrderId&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CancelOrderId::ByteSizeLong() const {
-          const CancelOrderId& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:CancelOrderId)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // int32 order_id = 1;
-            if (this_._internal_order_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_order_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CancelOrderId::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CancelOrderId*>(&to_msg);
-  auto& from = static_cast<const CancelOrderId&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:CancelOrderId)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_order_id() != 0) {
-    _this->_impl_.order_id_ = from._impl_.order_id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CancelOrderId::CopyFrom(const CancelOrderId& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:CancelOrderId)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CancelOrderId::InternalSwap(CancelOrderId* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.order_id_, other->_impl_.order_id_);
-}
-
-::google::protobuf::Metadata CancelOrderId::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CancelOrderIdResponse::_Internal {
- public:
-};
-
-CancelOrderIdResponse::CancelOrderIdResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:CancelOrderIdResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CancelOrderIdResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::CancelOrderIdResponse& from_msg)
-      : status_(arena, from.status_),
-        msg_(arena, from.msg_),
-        _cached_size_{0} {}
-
-CancelOrderIdResponse::CancelOrderIdResponse(
-    ::google::protobuf::Arena* arena,
-    const CancelOrderIdResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CancelOrderIdResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:CancelOrderIdResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CancelOrderIdResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : status_(arena),
-        msg_(arena),
-        _cached_size_{0} {}
-
-inline void CancelOrderIdResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-CancelOrderIdResponse::~CancelOrderIdResponse() {
-  // @@protoc_insertion_point(destructor:CancelOrderIdResponse)
-  SharedDtor(*this);
-}
-inline void CancelOrderIdResponse::SharedDtor(MessageLite& self) {
-  CancelOrderIdResponse& this_ = static_cast<CancelOrderIdResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  this_._impl_.msg_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CancelOrderIdResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CancelOrderIdResponse(arena);
-}
-constexpr auto CancelOrderIdResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CancelOrderIdResponse),
-                                            alignof(CancelOrderIdResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CancelOrderIdResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CancelOrderIdResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CancelOrderIdResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CancelOrderIdResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CancelOrderIdResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CancelOrderIdResponse>(), &CancelOrderIdResponse::ByteSizeLong,
-            &CancelOrderIdResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CancelOrderIdResponse, _impl_._cached_size_),
-        false,
-    },
-    &CancelOrderIdResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CancelOrderIdResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 39, 2> CancelOrderIdResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::CancelOrderIdResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string msg = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CancelOrderIdResponse, _impl_.msg_)}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(CancelOrderIdResponse, _impl_.status_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(CancelOrderIdResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string msg = 2;
-    {PROTOBUF_FIELD_OFFSET(CancelOrderIdResponse, _impl_.msg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\25\6\3\0\0\0\0\0"
-    "CancelOrderIdResponse"
-    "status"
-    "msg"
-  }},
-};
-
-PROTOBUF_NOINLINE void CancelOrderIdResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:CancelOrderIdResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.status_.ClearToEmpty();
-  _impl_.msg_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CancelOrderIdResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CancelOrderIdResponse& this_ = static_cast<const CancelOrderIdResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CancelOrderIdResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CancelOrderIdResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:CancelOrderIdResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "CancelOrderIdResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string msg = 2;
-          if (!this_._internal_msg().empty()) {
-            const std::string& _s = this_._internal_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "CancelOrderIdResponse.msg");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:CancelOrderIdResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CancelOrderIdResponse::ByteSizeLong(const MessageLite& base) {
-          const CancelOrderIdResponse& this_ = static_cast<const CancelOrderIdResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CancelOrderIdResponse::ByteSizeLong() const {
-          const CancelOrderIdResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:CancelOrderIdResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-            // string msg = 2;
-            if (!this_._internal_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msg());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CancelOrderIdResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CancelOrderIdResponse*>(&to_msg);
-  auto& from = static_cast<const CancelOrderIdResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:CancelOrderIdResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  if (!from._internal_msg().empty()) {
-    _this->_internal_set_msg(from._internal_msg());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CancelOrderIdResponse::CopyFrom(const CancelOrderIdResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:CancelOrderIdResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CancelOrderIdResponse::InternalSwap(CancelOrderIdResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
-}
-
-::google::protobuf::Metadata CancelOrderIdResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CancelStockScope::_Internal {
- public:
-};
-
-CancelStockScope::CancelStockScope(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:CancelStockScope)
-}
-inline PROTOBUF_NDEBUG_INLINE CancelStockScope::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::CancelStockScope& from_msg)
-      : order_type_(arena, from.order_type_),
-        stock_code_(arena, from.stock_code_),
-        _cached_size_{0} {}
-
-CancelStockScope::CancelStockScope(
-    ::google::protobuf::Arena* arena,
-    const CancelStockScope& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CancelStockScope* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:CancelStockScope)
-}
-inline PROTOBUF_NDEBUG_INLINE CancelStockScope::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : order_type_(arena),
-        stock_code_(arena),
-        _cached_size_{0} {}
-
-inline void CancelStockScope::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-CancelStockScope::~CancelStockScope() {
-  // @@protoc_insertion_point(destructor:CancelStockScope)
-  SharedDtor(*this);
-}
-inline void CancelStockScope::SharedDtor(MessageLite& self) {
-  CancelStockScope& this_ = static_cast<CancelStockScope&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.order_type_.Destroy();
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CancelStockScope::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CancelStockScope(arena);
-}
-constexpr auto CancelStockScope::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CancelStockScope),
-                                            alignof(CancelStockScope));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CancelStockScope::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CancelStockScope_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CancelStockScope::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CancelStockScope>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CancelStockScope::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CancelStockScope>(), &CancelStockScope::ByteSizeLong,
-            &CancelStockScope::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CancelStockScope, _impl_._cached_size_),
-        false,
-    },
-    &CancelStockScope::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CancelStockScope::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 45, 2> CancelStockScope::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::CancelStockScope>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string stock_code = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CancelStockScope, _impl_.stock_code_)}},
-    // string order_type = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(CancelStockScope, _impl_.order_type_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string order_type = 1;
-    {PROTOBUF_FIELD_OFFSET(CancelStockScope, _impl_.order_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string stock_code = 2;
-    {PROTOBUF_FIELD_OFFSET(CancelStockScope, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\20\12\12\0\0\0\0\0"
-    "CancelStockScope"
-    "order_type"
-    "stock_code"
-  }},
-};
-
-PROTOBUF_NOINLINE void CancelStockScope::Clear() {
-// @@protoc_insertion_point(message_clear_start:CancelStockScope)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.order_type_.ClearToEmpty();
-  _impl_.stock_code_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CancelStockScope::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CancelStockScope& this_ = static_cast<const CancelStockScope&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CancelStockScope::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CancelStockScope& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:CancelStockScope)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string order_type = 1;
-          if (!this_._internal_order_type().empty()) {
-            const std::string& _s = this_._internal_order_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "CancelStockScope.order_type");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string stock_code = 2;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "CancelStockScope.stock_code");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:CancelStockScope)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CancelStockScope::ByteSizeLong(const MessageLite& base) {
-          const CancelStockScope& this_ = static_cast<const CancelStockScope&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CancelStockScope::ByteSizeLong() const {
-          const CancelStockScope& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:CancelStockScope)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string order_type = 1;
-            if (!this_._internal_order_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_order_type());
-            }
-            // string stock_code = 2;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CancelStockScope::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CancelStockScope*>(&to_msg);
-  auto& from = static_cast<const CancelStockScope&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:CancelStockScope)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_order_type().empty()) {
-    _this->_internal_set_order_type(from._internal_order_type());
-  }
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CancelStockScope::CopyFrom(const CancelStockScope& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:CancelStockScope)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CancelStockScope::InternalSwap(CancelStockScope* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.order_type_, &other->_impl_.order_type_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-}
-
-::google::protobuf::Metadata CancelStockScope::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CancelStockScopeResponse::_Internal {
- public:
-};
-
-CancelStockScopeResponse::CancelStockScopeResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:CancelStockScopeResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CancelStockScopeResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::CancelStockScopeResponse& from_msg)
-      : status_(arena, from.status_),
-        order_type_(arena, from.order_type_),
-        stock_code_(arena, from.stock_code_),
-        msg_(arena, from.msg_),
-        _cached_size_{0} {}
-
-CancelStockScopeResponse::CancelStockScopeResponse(
-    ::google::protobuf::Arena* arena,
-    const CancelStockScopeResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CancelStockScopeResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:CancelStockScopeResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CancelStockScopeResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : status_(arena),
-        order_type_(arena),
-        stock_code_(arena),
-        msg_(arena),
-        _cached_size_{0} {}
-
-inline void CancelStockScopeResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-CancelStockScopeResponse::~CancelStockScopeResponse() {
-  // @@protoc_insertion_point(destructor:CancelStockScopeResponse)
-  SharedDtor(*this);
-}
-inline void CancelStockScopeResponse::SharedDtor(MessageLite& self) {
-  CancelStockScopeResponse& this_ = static_cast<CancelStockScopeResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  this_._impl_.order_type_.Destroy();
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.msg_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CancelStockScopeResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CancelStockScopeResponse(arena);
-}
-constexpr auto CancelStockScopeResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CancelStockScopeResponse),
-                                            alignof(CancelStockScopeResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CancelStockScopeResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CancelStockScopeResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CancelStockScopeResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CancelStockScopeResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CancelStockScopeResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CancelStockScopeResponse>(), &CancelStockScopeResponse::ByteSizeLong,
-            &CancelStockScopeResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_._cached_size_),
-        false,
-    },
-    &CancelStockScopeResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CancelStockScopeResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 62, 2> CancelStockScopeResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::CancelStockScopeResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string msg = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_.msg_)}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_.status_)}},
-    // string order_type = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_.order_type_)}},
-    // string stock_code = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_.stock_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string order_type = 2;
-    {PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_.order_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string stock_code = 3;
-    {PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string msg = 4;
-    {PROTOBUF_FIELD_OFFSET(CancelStockScopeResponse, _impl_.msg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\30\6\12\12\3\0\0\0"
-    "CancelStockScopeResponse"
-    "status"
-    "order_type"
-    "stock_code"
-    "msg"
-  }},
-};
-
-PROTOBUF_NOINLINE void CancelStockScopeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:CancelStockScopeResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.status_.ClearToEmpty();
-  _impl_.order_type_.ClearToEmpty();
-  _impl_.stock_code_.ClearToEmpty();
-  _impl_.msg_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CancelStockScopeResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CancelStockScopeResponse& this_ = static_cast<const CancelStockScopeResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CancelStockScopeResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CancelStockScopeResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:CancelStockScopeResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "CancelStockScopeResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string order_type = 2;
-          if (!this_._internal_order_type().empty()) {
-            const std::string& _s = this_._internal_order_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "CancelStockScopeResponse.order_type");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string stock_code = 3;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "CancelStockScopeResponse.stock_code");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string msg = 4;
-          if (!this_._internal_msg().empty()) {
-            const std::string& _s = this_._internal_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "CancelStockScopeResponse.msg");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:CancelStockScopeResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CancelStockScopeResponse::ByteSizeLong(const MessageLite& base) {
-          const CancelStockScopeResponse& this_ = static_cast<const CancelStockScopeResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CancelStockScopeResponse::ByteSizeLong() const {
-          const CancelStockScopeResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:CancelStockScopeResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-            // string order_type = 2;
-            if (!this_._internal_order_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_order_type());
-            }
-            // string stock_code = 3;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-            // string msg = 4;
-            if (!this_._internal_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msg());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CancelStockScopeResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CancelStockScopeResponse*>(&to_msg);
-  auto& from = static_cast<const CancelStockScopeResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:CancelStockScopeResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  if (!from._internal_order_type().empty()) {
-    _this->_internal_set_order_type(from._internal_order_type());
-  }
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  if (!from._internal_msg().empty()) {
-    _this->_internal_set_msg(from._internal_msg());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CancelStockScopeResponse::CopyFrom(const CancelStockScopeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:CancelStockScopeResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CancelStockScopeResponse::InternalSwap(CancelStockScopeResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.order_type_, &other->_impl_.order_type_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
-}
-
-::google::protobuf::Metadata CancelStockScopeResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class Entrusts::_Internal {
- public:
-};
-
-Entrusts::Entrusts(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:Entrusts)
-}
-inline PROTOBUF_NDEBUG_INLINE Entrusts::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::Entrusts& from_msg)
-      : stock_code_(arena, from.stock_code_),
-        trade_type_(arena, from.trade_type_),
-        data_type_(arena, from.data_type_),
-        _cached_size_{0} {}
-
-Entrusts::Entrusts(
-    ::google::protobuf::Arena* arena,
-    const Entrusts& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  Entrusts* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:Entrusts)
-}
-inline PROTOBUF_NDEBUG_INLINE Entrusts::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : stock_code_(arena),
-        trade_type_(arena),
-        data_type_(arena),
-        _cached_size_{0} {}
-
-inline void Entrusts::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-Entrusts::~Entrusts() {
-  // @@protoc_insertion_point(destructor:Entrusts)
-  SharedDtor(*this);
-}
-inline void Entrusts::SharedDtor(MessageLite& self) {
-  Entrusts& this_ = static_cast<Entrusts&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.trade_type_.Destroy();
-  this_._impl_.data_type_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* Entrusts::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) Entrusts(arena);
-}
-constexpr auto Entrusts::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(Entrusts),
-                                            alignof(Entrusts));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull Entrusts::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_Entrusts_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &Entrusts::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<Entrusts>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &Entrusts::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<Entrusts>(), &Entrusts::ByteSizeLong,
-            &Entrusts::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(Entrusts, _impl_._cached_size_),
-        false,
-    },
-    &Entrusts::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* Entrusts::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 46, 2> Entrusts::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::Entrusts>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string stock_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Entrusts, _impl_.stock_code_)}},
-    // string trade_type = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(Entrusts, _impl_.trade_type_)}},
-    // string data_type = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(Entrusts, _impl_.data_type_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string stock_code = 1;
-    {PROTOBUF_FIELD_OFFSET(Entrusts, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string trade_type = 2;
-    {PROTOBUF_FIELD_OFFSET(Entrusts, _impl_.trade_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string data_type = 3;
-    {PROTOBUF_FIELD_OFFSET(Entrusts, _impl_.data_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\10\12\12\11\0\0\0\0"
-    "Entrusts"
-    "stock_code"
-    "trade_type"
-    "data_type"
-  }},
-};
-
-PROTOBUF_NOINLINE void Entrusts::Clear() {
-// @@protoc_insertion_point(message_clear_start:Entrusts)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.stock_code_.ClearToEmpty();
-  _impl_.trade_type_.ClearToEmpty();
-  _impl_.data_type_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* Entrusts::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const Entrusts& this_ = static_cast<const Entrusts&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* Entrusts::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const Entrusts& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:Entrusts)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string stock_code = 1;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Entrusts.stock_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string trade_type = 2;
-          if (!this_._internal_trade_type().empty()) {
-            const std::string& _s = this_._internal_trade_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Entrusts.trade_type");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string data_type = 3;
-          if (!this_._internal_data_type().empty()) {
-            const std::string& _s = this_._internal_data_type();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Entrusts.data_type");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:Entrusts)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t Entrusts::ByteSizeLong(const MessageLite& base) {
-          const Entrusts& this_ = static_cast<const Entrusts&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t Entrusts::ByteSizeLong() const {
-          const Entrusts& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:Entrusts)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string stock_code = 1;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-            // string trade_type = 2;
-            if (!this_._internal_trade_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_trade_type());
-            }
-            // string data_type = 3;
-            if (!this_._internal_data_type().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_data_type());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void Entrusts::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<Entrusts*>(&to_msg);
-  auto& from = static_cast<const Entrusts&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Entrusts)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  if (!from._internal_trade_type().empty()) {
-    _this->_internal_set_trade_type(from._internal_trade_type());
-  }
-  if (!from._internal_data_type().empty()) {
-    _this->_internal_set_data_type(from._internal_data_type());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Entrusts::CopyFrom(const Entrusts& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Entrusts)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void Entrusts::InternalSwap(Entrusts* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.trade_type_, &other->_impl_.trade_type_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.data_type_, &other->_impl_.data_type_, arena);
-}
-
-::google::protobuf::Metadata Entrusts::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class EntrustsResponse::_Internal {
- public:
-};
-
-EntrustsResponse::EntrustsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:EntrustsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE EntrustsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::EntrustsResponse& from_msg)
-      : status_(arena, from.status_),
-        _cached_size_{0} {}
-
-EntrustsResponse::EntrustsResponse(
-    ::google::protobuf::Arena* arena,
-    const EntrustsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  EntrustsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.result_ = from._impl_.result_;
-
-  // @@protoc_insertion_point(copy_constructor:EntrustsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE EntrustsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : status_(arena),
-        _cached_size_{0} {}
-
-inline void EntrustsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.result_ = {};
-}
-EntrustsResponse::~EntrustsResponse() {
-  // @@protoc_insertion_point(destructor:EntrustsResponse)
-  SharedDtor(*this);
-}
-inline void EntrustsResponse::SharedDtor(MessageLite& self) {
-  EntrustsResponse& this_ = static_cast<EntrustsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* EntrustsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) EntrustsResponse(arena);
-}
-constexpr auto EntrustsResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(EntrustsResponse),
-                                            alignof(EntrustsResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull EntrustsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_EntrustsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &EntrustsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<EntrustsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &EntrustsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<EntrustsResponse>(), &EntrustsResponse::ByteSizeLong,
-            &EntrustsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(EntrustsResponse, _impl_._cached_size_),
-        false,
-    },
-    &EntrustsResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* EntrustsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 31, 2> EntrustsResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::EntrustsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // double result = 2;
-    {::_pbi::TcParser::FastF64S1,
-     {17, 63, 0, PROTOBUF_FIELD_OFFSET(EntrustsResponse, _impl_.result_)}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(EntrustsResponse, _impl_.status_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(EntrustsResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // double result = 2;
-    {PROTOBUF_FIELD_OFFSET(EntrustsResponse, _impl_.result_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-  }},
-  // no aux_entries
-  {{
-    "\20\6\0\0\0\0\0\0"
-    "EntrustsResponse"
-    "status"
-  }},
-};
-
-PROTOBUF_NOINLINE void EntrustsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:EntrustsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.status_.ClearToEmpty();
-  _impl_.result_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* EntrustsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const EntrustsResponse& this_ = static_cast<const EntrustsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* EntrustsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const EntrustsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:EntrustsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "EntrustsResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // double result = 2;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_result()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                2, this_._internal_result(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:EntrustsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t EntrustsResponse::ByteSizeLong(const MessageLite& base) {
-          const EntrustsResponse& this_ = static_cast<const EntrustsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t EntrustsResponse::ByteSizeLong() const {
-          const EntrustsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:EntrustsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-            // double result = 2;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_result()) != 0) {
-              total_size += 9;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void EntrustsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<EntrustsResponse*>(&to_msg);
-  auto& from = static_cast<const EntrustsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:EntrustsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_result()) != 0) {
-    _this->_impl_.result_ = from._impl_.result_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void EntrustsResponse::CopyFrom(const EntrustsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:EntrustsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void EntrustsResponse::InternalSwap(EntrustsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-        swap(_impl_.result_, other->_impl_.result_);
-}
-
-::google::protobuf::Metadata EntrustsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class TodayEntrustsValueResponse::_Internal {
- public:
-};
-
-TodayEntrustsValueResponse::TodayEntrustsValueResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:TodayEntrustsValueResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE TodayEntrustsValueResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::TodayEntrustsValueResponse& from_msg)
-      : status_(arena, from.status_),
-        _cached_size_{0} {}
-
-TodayEntrustsValueResponse::TodayEntrustsValueResponse(
-    ::google::protobuf::Arena* arena,
-    const TodayEntrustsValueResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TodayEntrustsValueResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, unvalue_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, unvalue_),
-           offsetof(Impl_, envalue_) -
-               offsetof(Impl_, unvalue_) +
-               sizeof(Impl_::envalue_));
-
-  // @@protoc_insertion_point(copy_constructor:TodayEntrustsValueResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE TodayEntrustsValueResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : status_(arena),
-        _cached_size_{0} {}
-
-inline void TodayEntrustsValueResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, unvalue_),
-           0,
-           offsetof(Impl_, envalue_) -
-               offsetof(Impl_, unvalue_) +
-               sizeof(Impl_::envalue_));
-}
-TodayEntrustsValueResponse::~TodayEntrustsValueResponse() {
-  // @@protoc_insertion_point(destructor:TodayEntrustsValueResponse)
-  SharedDtor(*this);
-}
-inline void TodayEntrustsValueResponse::SharedDtor(MessageLite& self) {
-  TodayEntrustsValueResponse& this_ = static_cast<TodayEntrustsValueResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.status_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* TodayEntrustsValueResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) TodayEntrustsValueResponse(arena);
-}
-constexpr auto TodayEntrustsValueResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(TodayEntrustsValueResponse),
-                                            alignof(TodayEntrustsValueResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull TodayEntrustsValueResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_TodayEntrustsValueResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &TodayEntrustsValueResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<TodayEntrustsValueResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &TodayEntrustsValueResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<TodayEntrustsValueResponse>(), &TodayEntrustsValueResponse::ByteSizeLong,
-            &TodayEntrustsValueResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_._cached_size_),
-        false,
-    },
-    &TodayEntrustsValueResponse::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* TodayEntrustsValueResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 41, 2> TodayEntrustsValueResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::TodayEntrustsValueResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string status = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_.status_)}},
-    // double unvalue = 2;
-    {::_pbi::TcParser::FastF64S1,
-     {17, 63, 0, PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_.unvalue_)}},
-    // double envalue = 3;
-    {::_pbi::TcParser::FastF64S1,
-     {25, 63, 0, PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_.envalue_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string status = 1;
-    {PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_.status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // double unvalue = 2;
-    {PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_.unvalue_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double envalue = 3;
-    {PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_.envalue_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-  }},
-  // no aux_entries
-  {{
-    "\32\6\0\0\0\0\0\0"
-    "TodayEntrustsValueResponse"
-    "status"
-  }},
-};
-
-PROTOBUF_NOINLINE void TodayEntrustsValueResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:TodayEntrustsValueResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.status_.ClearToEmpty();
-  ::memset(&_impl_.unvalue_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.envalue_) -
-      reinterpret_cast<char*>(&_impl_.unvalue_)) + sizeof(_impl_.envalue_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* TodayEntrustsValueResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const TodayEntrustsValueResponse& this_ = static_cast<const TodayEntrustsValueResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* TodayEntrustsValueResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const TodayEntrustsValueResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:TodayEntrustsValueResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string status = 1;
-          if (!this_._internal_status().empty()) {
-            const std::string& _s = this_._internal_status();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "TodayEntrustsValueResponse.status");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // double unvalue = 2;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_unvalue()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                2, this_._internal_unvalue(), target);
-          }
-
-          // double envalue = 3;
-          if (::absl::bit_cast<::uint64_t>(this_._internal_envalue()) != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-                3, this_._internal_envalue(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:TodayEntrustsValueResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t TodayEntrustsValueResponse::ByteSizeLong(const MessageLite& base) {
-          const TodayEntrustsValueResponse& this_ = static_cast<const TodayEntrustsValueResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t TodayEntrustsValueResponse::ByteSizeLong() const {
-          const TodayEntrustsValueResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:TodayEntrustsValueResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string status = 1;
-            if (!this_._internal_status().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_status());
-            }
-            // double unvalue = 2;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_unvalue()) != 0) {
-              total_size += 9;
-            }
-            // double envalue = 3;
-            if (::absl::bit_cast<::uint64_t>(this_._internal_envalue()) != 0) {
-              total_size += 9;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void TodayEntrustsValueResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<TodayEntrustsValueResponse*>(&to_msg);
-  auto& from = static_cast<const TodayEntrustsValueResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:TodayEntrustsValueResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_status().empty()) {
-    _this->_internal_set_status(from._internal_status());
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_unvalue()) != 0) {
-    _this->_impl_.unvalue_ = from._impl_.unvalue_;
-  }
-  if (::absl::bit_cast<::uint64_t>(from._internal_envalue()) != 0) {
-    _this->_impl_.envalue_ = from._impl_.envalue_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void TodayEntrustsValueResponse::CopyFrom(const TodayEntrustsValueResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:TodayEntrustsValueResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void TodayEntrustsValueResponse::InternalSwap(TodayEntrustsValueResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.status_, &other->_impl_.status_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_.envalue_)
-      + sizeof(TodayEntrustsValueResponse::_impl_.envalue_)
-      - PROTOBUF_FIELD_OFFSET(TodayEntrustsValueResponse, _impl_.unvalue_)>(
-          reinterpret_cast<char*>(&_impl_.unvalue_),
-          reinterpret_cast<char*>(&other->_impl_.unvalue_));
-}
-
-::google::protobuf::Metadata TodayEntrustsValueResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class StockPositions::_Internal {
- public:
-};
-
-StockPositions::StockPositions(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:StockPositions)
-}
-inline PROTOBUF_NDEBUG_INLINE StockPositions::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::StockPositions& from_msg)
-      : stock_code_(arena, from.stock_code_),
-        _cached_size_{0} {}
-
-StockPositions::StockPositions(
-    ::google::protobuf::Arena* arena,
-    const StockPositions& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  StockPositions* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:StockPositions)
-}
-inline PROTOBUF_NDEBUG_INLINE StockPositions::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : stock_code_(arena),
-        _cached_size_{0} {}
-
-inline void StockPositions::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-StockPositions::~StockPositions() {
-  // @@protoc_insertion_point(destructor:StockPositions)
-  SharedDtor(*this);
-}
-inline void StockPositions::SharedDtor(MessageLite& self) {
-  StockPositions& this_ = static_cast<StockPositions&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.stock_code_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* StockPositions::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) StockPositions(arena);
-}
-constexpr auto StockPositions::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(StockPositions),
-                                            alignof(StockPositions));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull StockPositions::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_StockPositions_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &StockPositions::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<StockPositions>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &StockPositions::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<StockPositions>(), &StockPositions::ByteSizeLong,
-            &StockPositions::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(StockPositions, _impl_._cached_size_),
-        false,
-    },
-    &StockPositions::kDescriptorMethods,
-    &descriptor_table_little_5fgoal_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* StockPositions::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 33, 2> StockPositions::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::StockPositions>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string stock_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(StockPositions, _impl_.stock_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string stock_code = 1;
-    {PROTOBUF_FIELD_OFFSET(StockPositions, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\16\12\0\0\0\0\0\0"
-    "StockPositions"
-    "stock_code"
-  }},
-};
-
-PROTOBUF_NOINLINE void StockPositions::Clear() {
-// @@protoc_insertion_point(message_clear_start:StockPositions)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.stock_code_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* StockPositions::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const StockPositions& this_ = static_cast<const StockPositions&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* StockPositions::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const StockPositions& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:StockPositions)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string stock_code = 1;
-          if (!this_._internal_stock_code().empty()) {
-            const std::string& _s = this_._internal_stock_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "StockPositions.stock_code");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:StockPositions)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t StockPositions::ByteSizeLong(const MessageLite& base) {
-          const StockPositions& this_ = static_cast<const StockPositions&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t StockPositions::ByteSizeLong() const {
-          const StockPositions& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:StockPositions)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // string stock_code = 1;
-            if (!this_._internal_stock_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_stock_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void StockPositions::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<StockPositions*>(&to_msg);
-  auto& from = static_cast<const StockPositions&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:StockPositions)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_stock_code().empty()) {
-    _this->_internal_set_stock_code(from._internal_stock_code());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void StockPositions::CopyFrom(const StockPositions& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:StockPositions)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void StockPositions::InternalSwap(StockPositions* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-}
-
-::google::protobuf::Metadata StockPositions::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// @@protoc_insertion_point(namespace_scope)
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_little_5fgoal_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
@@ -1,7248 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: little_goal.proto
-// Protobuf C++ Version: 5.29.5
-
-#ifndef little_5fgoal_2eproto_2epb_2eh
-#define little_5fgoal_2eproto_2epb_2eh
-
-#include <limits>
-#include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/runtime_version.h"
-#if PROTOBUF_VERSION != 5029005
-#error "Protobuf C++ gencode is built with an incompatible version of"
-#error "Protobuf C++ headers/runtime. See"
-#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
-#endif
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/message_lite.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-
-#define PROTOBUF_INTERNAL_EXPORT_little_5fgoal_2eproto
-
-namespace google {
-namespace protobuf {
-namespace internal {
-template <typename T>
-::absl::string_view GetAnyMessageName();
-}  // namespace internal
-}  // namespace protobuf
-}  // namespace google
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_little_5fgoal_2eproto {
-  static const ::uint32_t offsets[];
-};
-extern const ::google::protobuf::internal::DescriptorTable
-    descriptor_table_little_5fgoal_2eproto;
-class AccountInfo;
-struct AccountInfoDefaultTypeInternal;
-extern AccountInfoDefaultTypeInternal _AccountInfo_default_instance_;
-class AccountInfoResponse;
-struct AccountInfoResponseDefaultTypeInternal;
-extern AccountInfoResponseDefaultTypeInternal _AccountInfoResponse_default_instance_;
-class CancelOrderId;
-struct CancelOrderIdDefaultTypeInternal;
-extern CancelOrderIdDefaultTypeInternal _CancelOrderId_default_instance_;
-class CancelOrderIdResponse;
-struct CancelOrderIdResponseDefaultTypeInternal;
-extern CancelOrderIdResponseDefaultTypeInternal _CancelOrderIdResponse_default_instance_;
-class CancelStockScope;
-struct CancelStockScopeDefaultTypeInternal;
-extern CancelStockScopeDefaultTypeInternal _CancelStockScope_default_instance_;
-class CancelStockScopeResponse;
-struct CancelStockScopeResponseDefaultTypeInternal;
-extern CancelStockScopeResponseDefaultTypeInternal _CancelStockScopeResponse_default_instance_;
-class Entrusts;
-struct EntrustsDefaultTypeInternal;
-extern EntrustsDefaultTypeInternal _Entrusts_default_instance_;
-class EntrustsResponse;
-struct EntrustsResponseDefaultTypeInternal;
-extern EntrustsResponseDefaultTypeInternal _EntrustsResponse_default_instance_;
-class Order;
-struct OrderDefaultTypeInternal;
-extern OrderDefaultTypeInternal _Order_default_instance_;
-class OrderResponse;
-struct OrderResponseDefaultTypeInternal;
-extern OrderResponseDefaultTypeInternal _OrderResponse_default_instance_;
-class PlaceOrder;
-struct PlaceOrderDefaultTypeInternal;
-extern PlaceOrderDefaultTypeInternal _PlaceOrder_default_instance_;
-class PlaceOrderResponse;
-struct PlaceOrderResponseDefaultTypeInternal;
-extern PlaceOrderResponseDefaultTypeInternal _PlaceOrderResponse_default_instance_;
-class Position;
-struct PositionDefaultTypeInternal;
-extern PositionDefaultTypeInternal _Position_default_instance_;
-class PositionsResponse;
-struct PositionsResponseDefaultTypeInternal;
-extern PositionsResponseDefaultTypeInternal _PositionsResponse_default_instance_;
-class StockPositions;
-struct StockPositionsDefaultTypeInternal;
-extern StockPositionsDefaultTypeInternal _StockPositions_default_instance_;
-class TodayEntrustsValueResponse;
-struct TodayEntrustsValueResponseDefaultTypeInternal;
-extern TodayEntrustsValueResponseDefaultTypeInternal _TodayEntrustsValueResponse_default_instance_;
-class Trade;
-struct TradeDefaultTypeInternal;
-extern TradeDefaultTypeInternal _Trade_default_instance_;
-class TradeFeedback;
-struct TradeFeedbackDefaultTypeInternal;
-extern TradeFeedbackDefaultTypeInternal _TradeFeedback_default_instance_;
-class TradeResponse;
-struct TradeResponseDefaultTypeInternal;
-extern TradeResponseDefaultTypeInternal _TradeResponse_default_instance_;
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-
-
-// ===================================================================
-
-
-// -------------------------------------------------------------------
-
-class TradeFeedback final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:TradeFeedback) */ {
- public:
-  inline TradeFeedback() : TradeFeedback(nullptr) {}
-  ~TradeFeedback() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(TradeFeedback* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(TradeFeedback));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR TradeFeedback(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline TradeFeedback(const TradeFeedback& from) : TradeFeedback(nullptr, from) {}
-  inline TradeFeedback(TradeFeedback&& from) noexcept
-      : TradeFeedback(nullptr, std::move(from)) {}
-  inline TradeFeedback& operator=(const TradeFeedback& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline TradeFeedback& operator=(TradeFeedback&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const TradeFeedback& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const TradeFeedback* internal_default_instance() {
-    return reinterpret_cast<const TradeFeedback*>(
-        &_TradeFeedback_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(TradeFeedback& a, TradeFeedback& b) { a.Swap(&b); }
-  inline void Swap(TradeFeedback* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(TradeFeedback* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  TradeFeedback* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<TradeFeedback>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const TradeFeedback& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const TradeFeedback& from) { TradeFeedback::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(TradeFeedback* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "TradeFeedback"; }
-
- protected:
-  explicit TradeFeedback(::google::protobuf::Arena* arena);
-  TradeFeedback(::google::protobuf::Arena* arena, const TradeFeedback& from);
-  TradeFeedback(::google::protobuf::Arena* arena, TradeFeedback&& from) noexcept
-      : TradeFeedback(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStockCodeFieldNumber = 1,
-    kOrderTimeFieldNumber = 7,
-    kOrderStatusFieldNumber = 2,
-    kOrderIdFieldNumber = 3,
-    kTradedPriceFieldNumber = 5,
-    kOrderTypeFieldNumber = 4,
-    kTradedVolFieldNumber = 6,
-  };
-  // string stock_code = 1;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // string order_time = 7;
-  void clear_order_time() ;
-  const std::string& order_time() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_order_time(Arg_&& arg, Args_... args);
-  std::string* mutable_order_time();
-  PROTOBUF_NODISCARD std::string* release_order_time();
-  void set_allocated_order_time(std::string* value);
-
-  private:
-  const std::string& _internal_order_time() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_order_time(
-      const std::string& value);
-  std::string* _internal_mutable_order_time();
-
-  public:
-  // int32 order_status = 2;
-  void clear_order_status() ;
-  ::int32_t order_status() const;
-  void set_order_status(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_status() const;
-  void _internal_set_order_status(::int32_t value);
-
-  public:
-  // int32 order_id = 3;
-  void clear_order_id() ;
-  ::int32_t order_id() const;
-  void set_order_id(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_id() const;
-  void _internal_set_order_id(::int32_t value);
-
-  public:
-  // double traded_price = 5;
-  void clear_traded_price() ;
-  double traded_price() const;
-  void set_traded_price(double value);
-
-  private:
-  double _internal_traded_price() const;
-  void _internal_set_traded_price(double value);
-
-  public:
-  // int32 order_type = 4;
-  void clear_order_type() ;
-  ::int32_t order_type() const;
-  void set_order_type(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_type() const;
-  void _internal_set_order_type(::int32_t value);
-
-  public:
-  // int32 traded_vol = 6;
-  void clear_traded_vol() ;
-  ::int32_t traded_vol() const;
-  void set_traded_vol(::int32_t value);
-
-  private:
-  ::int32_t _internal_traded_vol() const;
-  void _internal_set_traded_vol(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:TradeFeedback)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 7, 0,
-      42, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const TradeFeedback& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::google::protobuf::internal::ArenaStringPtr order_time_;
-    ::int32_t order_status_;
-    ::int32_t order_id_;
-    double traded_price_;
-    ::int32_t order_type_;
-    ::int32_t traded_vol_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Trade final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:Trade) */ {
- public:
-  inline Trade() : Trade(nullptr) {}
-  ~Trade() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(Trade* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(Trade));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR Trade(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline Trade(const Trade& from) : Trade(nullptr, from) {}
-  inline Trade(Trade&& from) noexcept
-      : Trade(nullptr, std::move(from)) {}
-  inline Trade& operator=(const Trade& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Trade& operator=(Trade&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Trade& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const Trade* internal_default_instance() {
-    return reinterpret_cast<const Trade*>(
-        &_Trade_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 7;
-  friend void swap(Trade& a, Trade& b) { a.Swap(&b); }
-  inline void Swap(Trade* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Trade* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  Trade* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<Trade>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const Trade& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const Trade& from) { Trade::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(Trade* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "Trade"; }
-
- protected:
-  explicit Trade(::google::protobuf::Arena* arena);
-  Trade(::google::protobuf::Arena* arena, const Trade& from);
-  Trade(::google::protobuf::Arena* arena, Trade&& from) noexcept
-      : Trade(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAccountIdFieldNumber = 1,
-    kStockCodeFieldNumber = 2,
-    kTradedIdFieldNumber = 4,
-    kTradedTimeFieldNumber = 5,
-    kOrderTypeFieldNumber = 3,
-    kTradedVolFieldNumber = 7,
-    kTradedPriceFieldNumber = 6,
-  };
-  // string account_id = 1;
-  void clear_account_id() ;
-  const std::string& account_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_account_id(Arg_&& arg, Args_... args);
-  std::string* mutable_account_id();
-  PROTOBUF_NODISCARD std::string* release_account_id();
-  void set_allocated_account_id(std::string* value);
-
-  private:
-  const std::string& _internal_account_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_account_id(
-      const std::string& value);
-  std::string* _internal_mutable_account_id();
-
-  public:
-  // string stock_code = 2;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // string traded_id = 4;
-  void clear_traded_id() ;
-  const std::string& traded_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_traded_id(Arg_&& arg, Args_... args);
-  std::string* mutable_traded_id();
-  PROTOBUF_NODISCARD std::string* release_traded_id();
-  void set_allocated_traded_id(std::string* value);
-
-  private:
-  const std::string& _internal_traded_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_traded_id(
-      const std::string& value);
-  std::string* _internal_mutable_traded_id();
-
-  public:
-  // string traded_time = 5;
-  void clear_traded_time() ;
-  const std::string& traded_time() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_traded_time(Arg_&& arg, Args_... args);
-  std::string* mutable_traded_time();
-  PROTOBUF_NODISCARD std::string* release_traded_time();
-  void set_allocated_traded_time(std::string* value);
-
-  private:
-  const std::string& _internal_traded_time() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_traded_time(
-      const std::string& value);
-  std::string* _internal_mutable_traded_time();
-
-  public:
-  // int32 order_type = 3;
-  void clear_order_type() ;
-  ::int32_t order_type() const;
-  void set_order_type(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_type() const;
-  void _internal_set_order_type(::int32_t value);
-
-  public:
-  // int32 traded_vol = 7;
-  void clear_traded_vol() ;
-  ::int32_t traded_vol() const;
-  void set_traded_vol(::int32_t value);
-
-  private:
-  ::int32_t _internal_traded_vol() const;
-  void _internal_set_traded_vol(::int32_t value);
-
-  public:
-  // double traded_price = 6;
-  void clear_traded_price() ;
-  double traded_price() const;
-  void set_traded_price(double value);
-
-  private:
-  double _internal_traded_price() const;
-  void _internal_set_traded_price(double value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:Trade)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 7, 0,
-      54, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const Trade& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr account_id_;
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::google::protobuf::internal::ArenaStringPtr traded_id_;
-    ::google::protobuf::internal::ArenaStringPtr traded_time_;
-    ::int32_t order_type_;
-    ::int32_t traded_vol_;
-    double traded_price_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class TodayEntrustsValueResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:TodayEntrustsValueResponse) */ {
- public:
-  inline TodayEntrustsValueResponse() : TodayEntrustsValueResponse(nullptr) {}
-  ~TodayEntrustsValueResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(TodayEntrustsValueResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(TodayEntrustsValueResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR TodayEntrustsValueResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline TodayEntrustsValueResponse(const TodayEntrustsValueResponse& from) : TodayEntrustsValueResponse(nullptr, from) {}
-  inline TodayEntrustsValueResponse(TodayEntrustsValueResponse&& from) noexcept
-      : TodayEntrustsValueResponse(nullptr, std::move(from)) {}
-  inline TodayEntrustsValueResponse& operator=(const TodayEntrustsValueResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline TodayEntrustsValueResponse& operator=(TodayEntrustsValueResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const TodayEntrustsValueResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const TodayEntrustsValueResponse* internal_default_instance() {
-    return reinterpret_cast<const TodayEntrustsValueResponse*>(
-        &_TodayEntrustsValueResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 17;
-  friend void swap(TodayEntrustsValueResponse& a, TodayEntrustsValueResponse& b) { a.Swap(&b); }
-  inline void Swap(TodayEntrustsValueResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(TodayEntrustsValueResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  TodayEntrustsValueResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<TodayEntrustsValueResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const TodayEntrustsValueResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const TodayEntrustsValueResponse& from) { TodayEntrustsValueResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(TodayEntrustsValueResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "TodayEntrustsValueResponse"; }
-
- protected:
-  explicit TodayEntrustsValueResponse(::google::protobuf::Arena* arena);
-  TodayEntrustsValueResponse(::google::protobuf::Arena* arena, const TodayEntrustsValueResponse& from);
-  TodayEntrustsValueResponse(::google::protobuf::Arena* arena, TodayEntrustsValueResponse&& from) noexcept
-      : TodayEntrustsValueResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStatusFieldNumber = 1,
-    kUnvalueFieldNumber = 2,
-    kEnvalueFieldNumber = 3,
-  };
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // double unvalue = 2;
-  void clear_unvalue() ;
-  double unvalue() const;
-  void set_unvalue(double value);
-
-  private:
-  double _internal_unvalue() const;
-  void _internal_set_unvalue(double value);
-
-  public:
-  // double envalue = 3;
-  void clear_envalue() ;
-  double envalue() const;
-  void set_envalue(double value);
-
-  private:
-  double _internal_envalue() const;
-  void _internal_set_envalue(double value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:TodayEntrustsValueResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      41, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const TodayEntrustsValueResponse& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    double unvalue_;
-    double envalue_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class StockPositions final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:StockPositions) */ {
- public:
-  inline StockPositions() : StockPositions(nullptr) {}
-  ~StockPositions() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(StockPositions* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(StockPositions));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR StockPositions(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline StockPositions(const StockPositions& from) : StockPositions(nullptr, from) {}
-  inline StockPositions(StockPositions&& from) noexcept
-      : StockPositions(nullptr, std::move(from)) {}
-  inline StockPositions& operator=(const StockPositions& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline StockPositions& operator=(StockPositions&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const StockPositions& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const StockPositions* internal_default_instance() {
-    return reinterpret_cast<const StockPositions*>(
-        &_StockPositions_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 18;
-  friend void swap(StockPositions& a, StockPositions& b) { a.Swap(&b); }
-  inline void Swap(StockPositions* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(StockPositions* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  StockPositions* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<StockPositions>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const StockPositions& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const StockPositions& from) { StockPositions::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(StockPositions* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "StockPositions"; }
-
- protected:
-  explicit StockPositions(::google::protobuf::Arena* arena);
-  StockPositions(::google::protobuf::Arena* arena, const StockPositions& from);
-  StockPositions(::google::protobuf::Arena* arena, StockPositions&& from) noexcept
-      : StockPositions(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStockCodeFieldNumber = 1,
-  };
-  // string stock_code = 1;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // @@protoc_insertion_point(class_scope:StockPositions)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      33, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const StockPositions& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Position final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:Position) */ {
- public:
-  inline Position() : Position(nullptr) {}
-  ~Position() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(Position* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(Position));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR Position(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline Position(const Position& from) : Position(nullptr, from) {}
-  inline Position(Position&& from) noexcept
-      : Position(nullptr, std::move(from)) {}
-  inline Position& operator=(const Position& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Position& operator=(Position&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Position& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const Position* internal_default_instance() {
-    return reinterpret_cast<const Position*>(
-        &_Position_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 3;
-  friend void swap(Position& a, Position& b) { a.Swap(&b); }
-  inline void Swap(Position* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Position* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  Position* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<Position>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const Position& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const Position& from) { Position::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(Position* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "Position"; }
-
- protected:
-  explicit Position(::google::protobuf::Arena* arena);
-  Position(::google::protobuf::Arena* arena, const Position& from);
-  Position(::google::protobuf::Arena* arena, Position&& from) noexcept
-      : Position(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAccountIdFieldNumber = 1,
-    kStockCodeFieldNumber = 2,
-    kVolFieldNumber = 3,
-    kAvailableVolFieldNumber = 4,
-    kAvgCostFieldNumber = 5,
-  };
-  // string account_id = 1;
-  void clear_account_id() ;
-  const std::string& account_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_account_id(Arg_&& arg, Args_... args);
-  std::string* mutable_account_id();
-  PROTOBUF_NODISCARD std::string* release_account_id();
-  void set_allocated_account_id(std::string* value);
-
-  private:
-  const std::string& _internal_account_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_account_id(
-      const std::string& value);
-  std::string* _internal_mutable_account_id();
-
-  public:
-  // string stock_code = 2;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // int32 vol = 3;
-  void clear_vol() ;
-  ::int32_t vol() const;
-  void set_vol(::int32_t value);
-
-  private:
-  ::int32_t _internal_vol() const;
-  void _internal_set_vol(::int32_t value);
-
-  public:
-  // int32 available_vol = 4;
-  void clear_available_vol() ;
-  ::int32_t available_vol() const;
-  void set_available_vol(::int32_t value);
-
-  private:
-  ::int32_t _internal_available_vol() const;
-  void _internal_set_available_vol(::int32_t value);
-
-  public:
-  // double avg_cost = 5;
-  void clear_avg_cost() ;
-  double avg_cost() const;
-  void set_avg_cost(double value);
-
-  private:
-  double _internal_avg_cost() const;
-  void _internal_set_avg_cost(double value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:Position)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 5, 0,
-      37, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const Position& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr account_id_;
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::int32_t vol_;
-    ::int32_t available_vol_;
-    double avg_cost_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class PlaceOrderResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:PlaceOrderResponse) */ {
- public:
-  inline PlaceOrderResponse() : PlaceOrderResponse(nullptr) {}
-  ~PlaceOrderResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(PlaceOrderResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(PlaceOrderResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR PlaceOrderResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline PlaceOrderResponse(const PlaceOrderResponse& from) : PlaceOrderResponse(nullptr, from) {}
-  inline PlaceOrderResponse(PlaceOrderResponse&& from) noexcept
-      : PlaceOrderResponse(nullptr, std::move(from)) {}
-  inline PlaceOrderResponse& operator=(const PlaceOrderResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline PlaceOrderResponse& operator=(PlaceOrderResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const PlaceOrderResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const PlaceOrderResponse* internal_default_instance() {
-    return reinterpret_cast<const PlaceOrderResponse*>(
-        &_PlaceOrderResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 10;
-  friend void swap(PlaceOrderResponse& a, PlaceOrderResponse& b) { a.Swap(&b); }
-  inline void Swap(PlaceOrderResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(PlaceOrderResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  PlaceOrderResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<PlaceOrderResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const PlaceOrderResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const PlaceOrderResponse& from) { PlaceOrderResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(PlaceOrderResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "PlaceOrderResponse"; }
-
- protected:
-  explicit PlaceOrderResponse(::google::protobuf::Arena* arena);
-  PlaceOrderResponse(::google::protobuf::Arena* arena, const PlaceOrderResponse& from);
-  PlaceOrderResponse(::google::protobuf::Arena* arena, PlaceOrderResponse&& from) noexcept
-      : PlaceOrderResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStatusFieldNumber = 1,
-    kMsgFieldNumber = 2,
-  };
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // string msg = 2;
-  void clear_msg() ;
-  const std::string& msg() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_msg(Arg_&& arg, Args_... args);
-  std::string* mutable_msg();
-  PROTOBUF_NODISCARD std::string* release_msg();
-  void set_allocated_msg(std::string* value);
-
-  private:
-  const std::string& _internal_msg() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(
-      const std::string& value);
-  std::string* _internal_mutable_msg();
-
-  public:
-  // @@protoc_insertion_point(class_scope:PlaceOrderResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      36, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const PlaceOrderResponse& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    ::google::protobuf::internal::ArenaStringPtr msg_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class PlaceOrder final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:PlaceOrder) */ {
- public:
-  inline PlaceOrder() : PlaceOrder(nullptr) {}
-  ~PlaceOrder() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(PlaceOrder* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(PlaceOrder));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR PlaceOrder(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline PlaceOrder(const PlaceOrder& from) : PlaceOrder(nullptr, from) {}
-  inline PlaceOrder(PlaceOrder&& from) noexcept
-      : PlaceOrder(nullptr, std::move(from)) {}
-  inline PlaceOrder& operator=(const PlaceOrder& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline PlaceOrder& operator=(PlaceOrder&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const PlaceOrder& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const PlaceOrder* internal_default_instance() {
-    return reinterpret_cast<const PlaceOrder*>(
-        &_PlaceOrder_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 9;
-  friend void swap(PlaceOrder& a, PlaceOrder& b) { a.Swap(&b); }
-  inline void Swap(PlaceOrder* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(PlaceOrder* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  PlaceOrder* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<PlaceOrder>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const PlaceOrder& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const PlaceOrder& from) { PlaceOrder::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(PlaceOrder* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "PlaceOrder"; }
-
- protected:
-  explicit PlaceOrder(::google::protobuf::Arena* arena);
-  PlaceOrder(::google::protobuf::Arena* arena, const PlaceOrder& from);
-  PlaceOrder(::google::protobuf::Arena* arena, PlaceOrder&& from) noexcept
-      : PlaceOrder(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAccountIdFieldNumber = 1,
-    kStockCodeFieldNumber = 2,
-    kOrderTypeFieldNumber = 5,
-    kPlaceTypeFieldNumber = 6,
-    kPriceFieldNumber = 4,
-    kHowManyFieldNumber = 3,
-  };
-  // string account_id = 1;
-  void clear_account_id() ;
-  const std::string& account_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_account_id(Arg_&& arg, Args_... args);
-  std::string* mutable_account_id();
-  PROTOBUF_NODISCARD std::string* release_account_id();
-  void set_allocated_account_id(std::string* value);
-
-  private:
-  const std::string& _internal_account_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_account_id(
-      const std::string& value);
-  std::string* _internal_mutable_account_id();
-
-  public:
-  // string stock_code = 2;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // string order_type = 5;
-  void clear_order_type() ;
-  const std::string& order_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_order_type(Arg_&& arg, Args_... args);
-  std::string* mutable_order_type();
-  PROTOBUF_NODISCARD std::string* release_order_type();
-  void set_allocated_order_type(std::string* value);
-
-  private:
-  const std::string& _internal_order_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_order_type(
-      const std::string& value);
-  std::string* _internal_mutable_order_type();
-
-  public:
-  // string place_type = 6;
-  void clear_place_type() ;
-  const std::string& place_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_place_type(Arg_&& arg, Args_... args);
-  std::string* mutable_place_type();
-  PROTOBUF_NODISCARD std::string* release_place_type();
-  void set_allocated_place_type(std::string* value);
-
-  private:
-  const std::string& _internal_place_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_place_type(
-      const std::string& value);
-  std::string* _internal_mutable_place_type();
-
-  public:
-  // double price = 4;
-  void clear_price() ;
-  double price() const;
-  void set_price(double value);
-
-  private:
-  double _internal_price() const;
-  void _internal_set_price(double value);
-
-  public:
-  // int32 how_many = 3;
-  void clear_how_many() ;
-  ::int32_t how_many() const;
-  void set_how_many(::int32_t value);
-
-  private:
-  ::int32_t _internal_how_many() const;
-  void _internal_set_how_many(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:PlaceOrder)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 6, 0,
-      59, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const PlaceOrder& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr account_id_;
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::google::protobuf::internal::ArenaStringPtr order_type_;
-    ::google::protobuf::internal::ArenaStringPtr place_type_;
-    double price_;
-    ::int32_t how_many_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Order final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:Order) */ {
- public:
-  inline Order() : Order(nullptr) {}
-  ~Order() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(Order* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(Order));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR Order(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline Order(const Order& from) : Order(nullptr, from) {}
-  inline Order(Order&& from) noexcept
-      : Order(nullptr, std::move(from)) {}
-  inline Order& operator=(const Order& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Order& operator=(Order&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Order& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const Order* internal_default_instance() {
-    return reinterpret_cast<const Order*>(
-        &_Order_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 5;
-  friend void swap(Order& a, Order& b) { a.Swap(&b); }
-  inline void Swap(Order* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Order* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  Order* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<Order>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const Order& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const Order& from) { Order::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(Order* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "Order"; }
-
- protected:
-  explicit Order(::google::protobuf::Arena* arena);
-  Order(::google::protobuf::Arena* arena, const Order& from);
-  Order(::google::protobuf::Arena* arena, Order&& from) noexcept
-      : Order(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAccountIdFieldNumber = 1,
-    kStockCodeFieldNumber = 2,
-    kOrderTimeFieldNumber = 4,
-    kOrderIdFieldNumber = 3,
-    kOrderTypeFieldNumber = 5,
-    kOrderVolFieldNumber = 6,
-    kPriceTypeFieldNumber = 7,
-    kPriceFieldNumber = 8,
-    kTradedVolFieldNumber = 9,
-    kOrderStatusFieldNumber = 10,
-  };
-  // string account_id = 1;
-  void clear_account_id() ;
-  const std::string& account_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_account_id(Arg_&& arg, Args_... args);
-  std::string* mutable_account_id();
-  PROTOBUF_NODISCARD std::string* release_account_id();
-  void set_allocated_account_id(std::string* value);
-
-  private:
-  const std::string& _internal_account_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_account_id(
-      const std::string& value);
-  std::string* _internal_mutable_account_id();
-
-  public:
-  // string stock_code = 2;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // string order_time = 4;
-  void clear_order_time() ;
-  const std::string& order_time() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_order_time(Arg_&& arg, Args_... args);
-  std::string* mutable_order_time();
-  PROTOBUF_NODISCARD std::string* release_order_time();
-  void set_allocated_order_time(std::string* value);
-
-  private:
-  const std::string& _internal_order_time() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_order_time(
-      const std::string& value);
-  std::string* _internal_mutable_order_time();
-
-  public:
-  // int32 order_id = 3;
-  void clear_order_id() ;
-  ::int32_t order_id() const;
-  void set_order_id(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_id() const;
-  void _internal_set_order_id(::int32_t value);
-
-  public:
-  // int32 order_type = 5;
-  void clear_order_type() ;
-  ::int32_t order_type() const;
-  void set_order_type(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_type() const;
-  void _internal_set_order_type(::int32_t value);
-
-  public:
-  // int32 order_vol = 6;
-  void clear_order_vol() ;
-  ::int32_t order_vol() const;
-  void set_order_vol(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_vol() const;
-  void _internal_set_order_vol(::int32_t value);
-
-  public:
-  // int32 price_type = 7;
-  void clear_price_type() ;
-  ::int32_t price_type() const;
-  void set_price_type(::int32_t value);
-
-  private:
-  ::int32_t _internal_price_type() const;
-  void _internal_set_price_type(::int32_t value);
-
-  public:
-  // double price = 8;
-  void clear_price() ;
-  double price() const;
-  void set_price(double value);
-
-  private:
-  double _internal_price() const;
-  void _internal_set_price(double value);
-
-  public:
-  // int32 traded_vol = 9;
-  void clear_traded_vol() ;
-  ::int32_t traded_vol() const;
-  void set_traded_vol(::int32_t value);
-
-  private:
-  ::int32_t _internal_traded_vol() const;
-  void _internal_set_traded_vol(::int32_t value);
-
-  public:
-  // int32 order_status = 10;
-  void clear_order_status() ;
-  ::int32_t order_status() const;
-  void set_order_status(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_status() const;
-  void _internal_set_order_status(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:Order)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      4, 10, 0,
-      52, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const Order& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr account_id_;
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::google::protobuf::internal::ArenaStringPtr order_time_;
-    ::int32_t order_id_;
-    ::int32_t order_type_;
-    ::int32_t order_vol_;
-    ::int32_t price_type_;
-    double price_;
-    ::int32_t traded_vol_;
-    ::int32_t order_status_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class EntrustsResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:EntrustsResponse) */ {
- public:
-  inline EntrustsResponse() : EntrustsResponse(nullptr) {}
-  ~EntrustsResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(EntrustsResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(EntrustsResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR EntrustsResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline EntrustsResponse(const EntrustsResponse& from) : EntrustsResponse(nullptr, from) {}
-  inline EntrustsResponse(EntrustsResponse&& from) noexcept
-      : EntrustsResponse(nullptr, std::move(from)) {}
-  inline EntrustsResponse& operator=(const EntrustsResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline EntrustsResponse& operator=(EntrustsResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const EntrustsResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const EntrustsResponse* internal_default_instance() {
-    return reinterpret_cast<const EntrustsResponse*>(
-        &_EntrustsResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 16;
-  friend void swap(EntrustsResponse& a, EntrustsResponse& b) { a.Swap(&b); }
-  inline void Swap(EntrustsResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(EntrustsResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  EntrustsResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<EntrustsResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const EntrustsResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const EntrustsResponse& from) { EntrustsResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(EntrustsResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "EntrustsResponse"; }
-
- protected:
-  explicit EntrustsResponse(::google::protobuf::Arena* arena);
-  EntrustsResponse(::google::protobuf::Arena* arena, const EntrustsResponse& from);
-  EntrustsResponse(::google::protobuf::Arena* arena, EntrustsResponse&& from) noexcept
-      : EntrustsResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStatusFieldNumber = 1,
-    kResultFieldNumber = 2,
-  };
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // double result = 2;
-  void clear_result() ;
-  double result() const;
-  void set_result(double value);
-
-  private:
-  double _internal_result() const;
-  void _internal_set_result(double value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:EntrustsResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      31, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const EntrustsResponse& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    double result_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Entrusts final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:Entrusts) */ {
- public:
-  inline Entrusts() : Entrusts(nullptr) {}
-  ~Entrusts() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(Entrusts* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(Entrusts));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR Entrusts(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline Entrusts(const Entrusts& from) : Entrusts(nullptr, from) {}
-  inline Entrusts(Entrusts&& from) noexcept
-      : Entrusts(nullptr, std::move(from)) {}
-  inline Entrusts& operator=(const Entrusts& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Entrusts& operator=(Entrusts&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Entrusts& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const Entrusts* internal_default_instance() {
-    return reinterpret_cast<const Entrusts*>(
-        &_Entrusts_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 15;
-  friend void swap(Entrusts& a, Entrusts& b) { a.Swap(&b); }
-  inline void Swap(Entrusts* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Entrusts* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  Entrusts* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<Entrusts>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const Entrusts& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const Entrusts& from) { Entrusts::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(Entrusts* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "Entrusts"; }
-
- protected:
-  explicit Entrusts(::google::protobuf::Arena* arena);
-  Entrusts(::google::protobuf::Arena* arena, const Entrusts& from);
-  Entrusts(::google::protobuf::Arena* arena, Entrusts&& from) noexcept
-      : Entrusts(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStockCodeFieldNumber = 1,
-    kTradeTypeFieldNumber = 2,
-    kDataTypeFieldNumber = 3,
-  };
-  // string stock_code = 1;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // string trade_type = 2;
-  void clear_trade_type() ;
-  const std::string& trade_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_trade_type(Arg_&& arg, Args_... args);
-  std::string* mutable_trade_type();
-  PROTOBUF_NODISCARD std::string* release_trade_type();
-  void set_allocated_trade_type(std::string* value);
-
-  private:
-  const std::string& _internal_trade_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_trade_type(
-      const std::string& value);
-  std::string* _internal_mutable_trade_type();
-
-  public:
-  // string data_type = 3;
-  void clear_data_type() ;
-  const std::string& data_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_data_type(Arg_&& arg, Args_... args);
-  std::string* mutable_data_type();
-  PROTOBUF_NODISCARD std::string* release_data_type();
-  void set_allocated_data_type(std::string* value);
-
-  private:
-  const std::string& _internal_data_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data_type(
-      const std::string& value);
-  std::string* _internal_mutable_data_type();
-
-  public:
-  // @@protoc_insertion_point(class_scope:Entrusts)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
-      46, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const Entrusts& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::google::protobuf::internal::ArenaStringPtr trade_type_;
-    ::google::protobuf::internal::ArenaStringPtr data_type_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CancelStockScopeResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:CancelStockScopeResponse) */ {
- public:
-  inline CancelStockScopeResponse() : CancelStockScopeResponse(nullptr) {}
-  ~CancelStockScopeResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CancelStockScopeResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CancelStockScopeResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CancelStockScopeResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CancelStockScopeResponse(const CancelStockScopeResponse& from) : CancelStockScopeResponse(nullptr, from) {}
-  inline CancelStockScopeResponse(CancelStockScopeResponse&& from) noexcept
-      : CancelStockScopeResponse(nullptr, std::move(from)) {}
-  inline CancelStockScopeResponse& operator=(const CancelStockScopeResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CancelStockScopeResponse& operator=(CancelStockScopeResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CancelStockScopeResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CancelStockScopeResponse* internal_default_instance() {
-    return reinterpret_cast<const CancelStockScopeResponse*>(
-        &_CancelStockScopeResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 14;
-  friend void swap(CancelStockScopeResponse& a, CancelStockScopeResponse& b) { a.Swap(&b); }
-  inline void Swap(CancelStockScopeResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CancelStockScopeResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CancelStockScopeResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CancelStockScopeResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CancelStockScopeResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CancelStockScopeResponse& from) { CancelStockScopeResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CancelStockScopeResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "CancelStockScopeResponse"; }
-
- protected:
-  explicit CancelStockScopeResponse(::google::protobuf::Arena* arena);
-  CancelStockScopeResponse(::google::protobuf::Arena* arena, const CancelStockScopeResponse& from);
-  CancelStockScopeResponse(::google::protobuf::Arena* arena, CancelStockScopeResponse&& from) noexcept
-      : CancelStockScopeResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStatusFieldNumber = 1,
-    kOrderTypeFieldNumber = 2,
-    kStockCodeFieldNumber = 3,
-    kMsgFieldNumber = 4,
-  };
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // string order_type = 2;
-  void clear_order_type() ;
-  const std::string& order_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_order_type(Arg_&& arg, Args_... args);
-  std::string* mutable_order_type();
-  PROTOBUF_NODISCARD std::string* release_order_type();
-  void set_allocated_order_type(std::string* value);
-
-  private:
-  const std::string& _internal_order_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_order_type(
-      const std::string& value);
-  std::string* _internal_mutable_order_type();
-
-  public:
-  // string stock_code = 3;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // string msg = 4;
-  void clear_msg() ;
-  const std::string& msg() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_msg(Arg_&& arg, Args_... args);
-  std::string* mutable_msg();
-  PROTOBUF_NODISCARD std::string* release_msg();
-  void set_allocated_msg(std::string* value);
-
-  private:
-  const std::string& _internal_msg() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(
-      const std::string& value);
-  std::string* _internal_mutable_msg();
-
-  public:
-  // @@protoc_insertion_point(class_scope:CancelStockScopeResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
-      62, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CancelStockScopeResponse& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    ::google::protobuf::internal::ArenaStringPtr order_type_;
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::google::protobuf::internal::ArenaStringPtr msg_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CancelStockScope final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:CancelStockScope) */ {
- public:
-  inline CancelStockScope() : CancelStockScope(nullptr) {}
-  ~CancelStockScope() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CancelStockScope* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CancelStockScope));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CancelStockScope(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CancelStockScope(const CancelStockScope& from) : CancelStockScope(nullptr, from) {}
-  inline CancelStockScope(CancelStockScope&& from) noexcept
-      : CancelStockScope(nullptr, std::move(from)) {}
-  inline CancelStockScope& operator=(const CancelStockScope& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CancelStockScope& operator=(CancelStockScope&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CancelStockScope& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CancelStockScope* internal_default_instance() {
-    return reinterpret_cast<const CancelStockScope*>(
-        &_CancelStockScope_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 13;
-  friend void swap(CancelStockScope& a, CancelStockScope& b) { a.Swap(&b); }
-  inline void Swap(CancelStockScope* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CancelStockScope* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CancelStockScope* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CancelStockScope>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CancelStockScope& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CancelStockScope& from) { CancelStockScope::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CancelStockScope* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "CancelStockScope"; }
-
- protected:
-  explicit CancelStockScope(::google::protobuf::Arena* arena);
-  CancelStockScope(::google::protobuf::Arena* arena, const CancelStockScope& from);
-  CancelStockScope(::google::protobuf::Arena* arena, CancelStockScope&& from) noexcept
-      : CancelStockScope(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kOrderTypeFieldNumber = 1,
-    kStockCodeFieldNumber = 2,
-  };
-  // string order_type = 1;
-  void clear_order_type() ;
-  const std::string& order_type() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_order_type(Arg_&& arg, Args_... args);
-  std::string* mutable_order_type();
-  PROTOBUF_NODISCARD std::string* release_order_type();
-  void set_allocated_order_type(std::string* value);
-
-  private:
-  const std::string& _internal_order_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_order_type(
-      const std::string& value);
-  std::string* _internal_mutable_order_type();
-
-  public:
-  // string stock_code = 2;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
-  private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
-  public:
-  // @@protoc_insertion_point(class_scope:CancelStockScope)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      45, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CancelStockScope& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr order_type_;
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CancelOrderIdResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:CancelOrderIdResponse) */ {
- public:
-  inline CancelOrderIdResponse() : CancelOrderIdResponse(nullptr) {}
-  ~CancelOrderIdResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CancelOrderIdResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CancelOrderIdResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CancelOrderIdResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CancelOrderIdResponse(const CancelOrderIdResponse& from) : CancelOrderIdResponse(nullptr, from) {}
-  inline CancelOrderIdResponse(CancelOrderIdResponse&& from) noexcept
-      : CancelOrderIdResponse(nullptr, std::move(from)) {}
-  inline CancelOrderIdResponse& operator=(const CancelOrderIdResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CancelOrderIdResponse& operator=(CancelOrderIdResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CancelOrderIdResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CancelOrderIdResponse* internal_default_instance() {
-    return reinterpret_cast<const CancelOrderIdResponse*>(
-        &_CancelOrderIdResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 12;
-  friend void swap(CancelOrderIdResponse& a, CancelOrderIdResponse& b) { a.Swap(&b); }
-  inline void Swap(CancelOrderIdResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CancelOrderIdResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CancelOrderIdResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CancelOrderIdResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CancelOrderIdResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CancelOrderIdResponse& from) { CancelOrderIdResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CancelOrderIdResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "CancelOrderIdResponse"; }
-
- protected:
-  explicit CancelOrderIdResponse(::google::protobuf::Arena* arena);
-  CancelOrderIdResponse(::google::protobuf::Arena* arena, const CancelOrderIdResponse& from);
-  CancelOrderIdResponse(::google::protobuf::Arena* arena, CancelOrderIdResponse&& from) noexcept
-      : CancelOrderIdResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStatusFieldNumber = 1,
-    kMsgFieldNumber = 2,
-  };
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // string msg = 2;
-  void clear_msg() ;
-  const std::string& msg() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_msg(Arg_&& arg, Args_... args);
-  std::string* mutable_msg();
-  PROTOBUF_NODISCARD std::string* release_msg();
-  void set_allocated_msg(std::string* value);
-
-  private:
-  const std::string& _internal_msg() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(
-      const std::string& value);
-  std::string* _internal_mutable_msg();
-
-  public:
-  // @@protoc_insertion_point(class_scope:CancelOrderIdResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
-      39, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CancelOrderIdResponse& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    ::google::protobuf::internal::ArenaStringPtr msg_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CancelOrderId final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:CancelOrderId) */ {
- public:
-  inline CancelOrderId() : CancelOrderId(nullptr) {}
-  ~CancelOrderId() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(CancelOrderId* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(CancelOrderId));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR CancelOrderId(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline CancelOrderId(const CancelOrderId& from) : CancelOrderId(nullptr, from) {}
-  inline CancelOrderId(CancelOrderId&& from) noexcept
-      : CancelOrderId(nullptr, std::move(from)) {}
-  inline CancelOrderId& operator=(const CancelOrderId& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CancelOrderId& operator=(CancelOrderId&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CancelOrderId& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CancelOrderId* internal_default_instance() {
-    return reinterpret_cast<const CancelOrderId*>(
-        &_CancelOrderId_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 11;
-  friend void swap(CancelOrderId& a, CancelOrderId& b) { a.Swap(&b); }
-  inline void Swap(CancelOrderId* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CancelOrderId* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CancelOrderId* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<CancelOrderId>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const CancelOrderId& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const CancelOrderId& from) { CancelOrderId::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(CancelOrderId* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "CancelOrderId"; }
-
- protected:
-  explicit CancelOrderId(::google::protobuf::Arena* arena);
-  CancelOrderId(::google::protobuf::Arena* arena, const CancelOrderId& from);
-  CancelOrderId(::google::protobuf::Arena* arena, CancelOrderId&& from) noexcept
-      : CancelOrderId(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kOrderIdFieldNumber = 1,
-  };
-  // int32 order_id = 1;
-  void clear_order_id() ;
-  ::int32_t order_id() const;
-  void set_order_id(::int32_t value);
-
-  private:
-  ::int32_t _internal_order_id() const;
-  void _internal_set_order_id(::int32_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:CancelOrderId)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      0, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const CancelOrderId& from_msg);
-    ::int32_t order_id_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class AccountInfo final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:AccountInfo) */ {
- public:
-  inline AccountInfo() : AccountInfo(nullptr) {}
-  ~AccountInfo() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AccountInfo* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AccountInfo));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AccountInfo(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline AccountInfo(const AccountInfo& from) : AccountInfo(nullptr, from) {}
-  inline AccountInfo(AccountInfo&& from) noexcept
-      : AccountInfo(nullptr, std::move(from)) {}
-  inline AccountInfo& operator=(const AccountInfo& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline AccountInfo& operator=(AccountInfo&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const AccountInfo& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const AccountInfo* internal_default_instance() {
-    return reinterpret_cast<const AccountInfo*>(
-        &_AccountInfo_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(AccountInfo& a, AccountInfo& b) { a.Swap(&b); }
-  inline void Swap(AccountInfo* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(AccountInfo* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  AccountInfo* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AccountInfo>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AccountInfo& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AccountInfo& from) { AccountInfo::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(AccountInfo* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "AccountInfo"; }
-
- protected:
-  explicit AccountInfo(::google::protobuf::Arena* arena);
-  AccountInfo(::google::protobuf::Arena* arena, const AccountInfo& from);
-  AccountInfo(::google::protobuf::Arena* arena, AccountInfo&& from) noexcept
-      : AccountInfo(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kAccountIdFieldNumber = 1,
-    kCashFieldNumber = 2,
-    kFrozenCashFieldNumber = 3,
-    kTotalAssetFieldNumber = 4,
-    kMarketValueFieldNumber = 5,
-  };
-  // string account_id = 1;
-  void clear_account_id() ;
-  const std::string& account_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_account_id(Arg_&& arg, Args_... args);
-  std::string* mutable_account_id();
-  PROTOBUF_NODISCARD std::string* release_account_id();
-  void set_allocated_account_id(std::string* value);
-
-  private:
-  const std::string& _internal_account_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_account_id(
-      const std::string& value);
-  std::string* _internal_mutable_account_id();
-
-  public:
-  // double cash = 2;
-  void clear_cash() ;
-  double cash() const;
-  void set_cash(double value);
-
-  private:
-  double _internal_cash() const;
-  void _internal_set_cash(double value);
-
-  public:
-  // double frozen_cash = 3;
-  void clear_frozen_cash() ;
-  double frozen_cash() const;
-  void set_frozen_cash(double value);
-
-  private:
-  double _internal_frozen_cash() const;
-  void _internal_set_frozen_cash(double value);
-
-  public:
-  // double total_asset = 4;
-  void clear_total_asset() ;
-  double total_asset() const;
-  void set_total_asset(double value);
-
-  private:
-  double _internal_total_asset() const;
-  void _internal_set_total_asset(double value);
-
-  public:
-  // double market_value = 5;
-  void clear_market_value() ;
-  double market_value() const;
-  void set_market_value(double value);
-
-  private:
-  double _internal_market_value() const;
-  void _internal_set_market_value(double value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:AccountInfo)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 5, 0,
-      30, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const AccountInfo& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr account_id_;
-    double cash_;
-    double frozen_cash_;
-    double total_asset_;
-    double market_value_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class TradeResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:TradeResponse) */ {
- public:
-  inline TradeResponse() : TradeResponse(nullptr) {}
-  ~TradeResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(TradeResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(TradeResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR TradeResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline TradeResponse(const TradeResponse& from) : TradeResponse(nullptr, from) {}
-  inline TradeResponse(TradeResponse&& from) noexcept
-      : TradeResponse(nullptr, std::move(from)) {}
-  inline TradeResponse& operator=(const TradeResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline TradeResponse& operator=(TradeResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const TradeResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const TradeResponse* internal_default_instance() {
-    return reinterpret_cast<const TradeResponse*>(
-        &_TradeResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 8;
-  friend void swap(TradeResponse& a, TradeResponse& b) { a.Swap(&b); }
-  inline void Swap(TradeResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(TradeResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  TradeResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<TradeResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const TradeResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const TradeResponse& from) { TradeResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(TradeResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "TradeResponse"; }
-
- protected:
-  explicit TradeResponse(::google::protobuf::Arena* arena);
-  TradeResponse(::google::protobuf::Arena* arena, const TradeResponse& from);
-  TradeResponse(::google::protobuf::Arena* arena, TradeResponse&& from) noexcept
-      : TradeResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kTradesFieldNumber = 2,
-    kStatusFieldNumber = 1,
-  };
-  // repeated .Trade trades = 2;
-  int trades_size() const;
-  private:
-  int _internal_trades_size() const;
-
-  public:
-  void clear_trades() ;
-  ::Trade* mutable_trades(int index);
-  ::google::protobuf::RepeatedPtrField<::Trade>* mutable_trades();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::Trade>& _internal_trades() const;
-  ::google::protobuf::RepeatedPtrField<::Trade>* _internal_mutable_trades();
-  public:
-  const ::Trade& trades(int index) const;
-  ::Trade* add_trades();
-  const ::google::protobuf::RepeatedPtrField<::Trade>& trades() const;
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // @@protoc_insertion_point(class_scope:TradeResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 1,
-      28, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const TradeResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::Trade > trades_;
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class PositionsResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:PositionsResponse) */ {
- public:
-  inline PositionsResponse() : PositionsResponse(nullptr) {}
-  ~PositionsResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(PositionsResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(PositionsResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR PositionsResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline PositionsResponse(const PositionsResponse& from) : PositionsResponse(nullptr, from) {}
-  inline PositionsResponse(PositionsResponse&& from) noexcept
-      : PositionsResponse(nullptr, std::move(from)) {}
-  inline PositionsResponse& operator=(const PositionsResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline PositionsResponse& operator=(PositionsResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const PositionsResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const PositionsResponse* internal_default_instance() {
-    return reinterpret_cast<const PositionsResponse*>(
-        &_PositionsResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(PositionsResponse& a, PositionsResponse& b) { a.Swap(&b); }
-  inline void Swap(PositionsResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(PositionsResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  PositionsResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<PositionsResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const PositionsResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const PositionsResponse& from) { PositionsResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(PositionsResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "PositionsResponse"; }
-
- protected:
-  explicit PositionsResponse(::google::protobuf::Arena* arena);
-  PositionsResponse(::google::protobuf::Arena* arena, const PositionsResponse& from);
-  PositionsResponse(::google::protobuf::Arena* arena, PositionsResponse&& from) noexcept
-      : PositionsResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kPositionsFieldNumber = 2,
-    kStatusFieldNumber = 1,
-  };
-  // repeated .Position positions = 2;
-  int positions_size() const;
-  private:
-  int _internal_positions_size() const;
-
-  public:
-  void clear_positions() ;
-  ::Position* mutable_positions(int index);
-  ::google::protobuf::RepeatedPtrField<::Position>* mutable_positions();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::Position>& _internal_positions() const;
-  ::google::protobuf::RepeatedPtrField<::Position>* _internal_mutable_positions();
-  public:
-  const ::Position& positions(int index) const;
-  ::Position* add_positions();
-  const ::google::protobuf::RepeatedPtrField<::Position>& positions() const;
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // @@protoc_insertion_point(class_scope:PositionsResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 1,
-      32, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const PositionsResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::Position > positions_;
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class OrderResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:OrderResponse) */ {
- public:
-  inline OrderResponse() : OrderResponse(nullptr) {}
-  ~OrderResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(OrderResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(OrderResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR OrderResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline OrderResponse(const OrderResponse& from) : OrderResponse(nullptr, from) {}
-  inline OrderResponse(OrderResponse&& from) noexcept
-      : OrderResponse(nullptr, std::move(from)) {}
-  inline OrderResponse& operator=(const OrderResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline OrderResponse& operator=(OrderResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const OrderResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const OrderResponse* internal_default_instance() {
-    return reinterpret_cast<const OrderResponse*>(
-        &_OrderResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 6;
-  friend void swap(OrderResponse& a, OrderResponse& b) { a.Swap(&b); }
-  inline void Swap(OrderResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(OrderResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  OrderResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<OrderResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const OrderResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const OrderResponse& from) { OrderResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(OrderResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "OrderResponse"; }
-
- protected:
-  explicit OrderResponse(::google::protobuf::Arena* arena);
-  OrderResponse(::google::protobuf::Arena* arena, const OrderResponse& from);
-  OrderResponse(::google::protobuf::Arena* arena, OrderResponse&& from) noexcept
-      : OrderResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kOrdersFieldNumber = 2,
-    kStatusFieldNumber = 1,
-  };
-  // repeated .Order orders = 2;
-  int orders_size() const;
-  private:
-  int _internal_orders_size() const;
-
-  public:
-  void clear_orders() ;
-  ::Order* mutable_orders(int index);
-  ::google::protobuf::RepeatedPtrField<::Order>* mutable_orders();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::Order>& _internal_orders() const;
-  ::google::protobuf::RepeatedPtrField<::Order>* _internal_mutable_orders();
-  public:
-  const ::Order& orders(int index) const;
-  ::Order* add_orders();
-  const ::google::protobuf::RepeatedPtrField<::Order>& orders() const;
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // @@protoc_insertion_point(class_scope:OrderResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 1,
-      28, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const OrderResponse& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::Order > orders_;
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-// -------------------------------------------------------------------
-
-class AccountInfoResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:AccountInfoResponse) */ {
- public:
-  inline AccountInfoResponse() : AccountInfoResponse(nullptr) {}
-  ~AccountInfoResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AccountInfoResponse* msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AccountInfoResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AccountInfoResponse(
-      ::google::protobuf::internal::ConstantInitialized);
-
-  inline AccountInfoResponse(const AccountInfoResponse& from) : AccountInfoResponse(nullptr, from) {}
-  inline AccountInfoResponse(AccountInfoResponse&& from) noexcept
-      : AccountInfoResponse(nullptr, std::move(from)) {}
-  inline AccountInfoResponse& operator=(const AccountInfoResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline AccountInfoResponse& operator=(AccountInfoResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const AccountInfoResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const AccountInfoResponse* internal_default_instance() {
-    return reinterpret_cast<const AccountInfoResponse*>(
-        &_AccountInfoResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(AccountInfoResponse& a, AccountInfoResponse& b) { a.Swap(&b); }
-  inline void Swap(AccountInfoResponse* other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(AccountInfoResponse* other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  AccountInfoResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AccountInfoResponse>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AccountInfoResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AccountInfoResponse& from) { AccountInfoResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(
-      ::google::protobuf::MessageLite& to_msg,
-      const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* _InternalSerialize(
-      const MessageLite& msg, ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target,
-      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(AccountInfoResponse* other);
- private:
-  template <typename T>
-  friend ::absl::string_view(
-      ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "AccountInfoResponse"; }
-
- protected:
-  explicit AccountInfoResponse(::google::protobuf::Arena* arena);
-  AccountInfoResponse(::google::protobuf::Arena* arena, const AccountInfoResponse& from);
-  AccountInfoResponse(::google::protobuf::Arena* arena, AccountInfoResponse&& from) noexcept
-      : AccountInfoResponse(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
-  static void* PlacementNew_(const void*, void* mem,
-                             ::google::protobuf::Arena* arena);
-  static constexpr auto InternalNewImpl_();
-  static const ::google::protobuf::internal::ClassDataFull _class_data_;
-
- public:
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kStatusFieldNumber = 1,
-    kDataFieldNumber = 2,
-  };
-  // string status = 1;
-  void clear_status() ;
-  const std::string& status() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_status(Arg_&& arg, Args_... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* value);
-
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(
-      const std::string& value);
-  std::string* _internal_mutable_status();
-
-  public:
-  // .AccountInfo data = 2;
-  bool has_data() const;
-  void clear_data() ;
-  const ::AccountInfo& data() const;
-  PROTOBUF_NODISCARD ::AccountInfo* release_data();
-  ::AccountInfo* mutable_data();
-  void set_allocated_data(::AccountInfo* value);
-  void unsafe_arena_set_allocated_data(::AccountInfo* value);
-  ::AccountInfo* unsafe_arena_release_data();
-
-  private:
-  const ::AccountInfo& _internal_data() const;
-  ::AccountInfo* _internal_mutable_data();
-
-  public:
-  // @@protoc_insertion_point(class_scope:AccountInfoResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 1,
-      34, 2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(
-        ::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena);
-    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                          ::google::protobuf::Arena* arena, const Impl_& from,
-                          const AccountInfoResponse& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr status_;
-    ::AccountInfo* data_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_little_5fgoal_2eproto;
-};
-
-// ===================================================================
-
-
-
-
-// ===================================================================
-
-
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// TradeFeedback
-
-// string stock_code = 1;
-inline void TradeFeedback::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& TradeFeedback::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:TradeFeedback.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void TradeFeedback::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:TradeFeedback.stock_code)
-}
-inline std::string* TradeFeedback::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:TradeFeedback.stock_code)
-  return _s;
-}
-inline const std::string& TradeFeedback::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void TradeFeedback::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* TradeFeedback::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* TradeFeedback::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:TradeFeedback.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void TradeFeedback::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:TradeFeedback.stock_code)
-}
-
-// int32 order_status = 2;
-inline void TradeFeedback::clear_order_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_status_ = 0;
-}
-inline ::int32_t TradeFeedback::order_status() const {
-  // @@protoc_insertion_point(field_get:TradeFeedback.order_status)
-  return _internal_order_status();
-}
-inline void TradeFeedback::set_order_status(::int32_t value) {
-  _internal_set_order_status(value);
-  // @@protoc_insertion_point(field_set:TradeFeedback.order_status)
-}
-inline ::int32_t TradeFeedback::_internal_order_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_status_;
-}
-inline void TradeFeedback::_internal_set_order_status(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_status_ = value;
-}
-
-// int32 order_id = 3;
-inline void TradeFeedback::clear_order_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = 0;
-}
-inline ::int32_t TradeFeedback::order_id() const {
-  // @@protoc_insertion_point(field_get:TradeFeedback.order_id)
-  return _internal_order_id();
-}
-inline void TradeFeedback::set_order_id(::int32_t value) {
-  _internal_set_order_id(value);
-  // @@protoc_insertion_point(field_set:TradeFeedback.order_id)
-}
-inline ::int32_t TradeFeedback::_internal_order_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_id_;
-}
-inline void TradeFeedback::_internal_set_order_id(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = value;
-}
-
-// int32 order_type = 4;
-inline void TradeFeedback::clear_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_ = 0;
-}
-inline ::int32_t TradeFeedback::order_type() const {
-  // @@protoc_insertion_point(field_get:TradeFeedback.order_type)
-  return _internal_order_type();
-}
-inline void TradeFeedback::set_order_type(::int32_t value) {
-  _internal_set_order_type(value);
-  // @@protoc_insertion_point(field_set:TradeFeedback.order_type)
-}
-inline ::int32_t TradeFeedback::_internal_order_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_type_;
-}
-inline void TradeFeedback::_internal_set_order_type(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_ = value;
-}
-
-// double traded_price = 5;
-inline void TradeFeedback::clear_traded_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_price_ = 0;
-}
-inline double TradeFeedback::traded_price() const {
-  // @@protoc_insertion_point(field_get:TradeFeedback.traded_price)
-  return _internal_traded_price();
-}
-inline void TradeFeedback::set_traded_price(double value) {
-  _internal_set_traded_price(value);
-  // @@protoc_insertion_point(field_set:TradeFeedback.traded_price)
-}
-inline double TradeFeedback::_internal_traded_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.traded_price_;
-}
-inline void TradeFeedback::_internal_set_traded_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_price_ = value;
-}
-
-// int32 traded_vol = 6;
-inline void TradeFeedback::clear_traded_vol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_vol_ = 0;
-}
-inline ::int32_t TradeFeedback::traded_vol() const {
-  // @@protoc_insertion_point(field_get:TradeFeedback.traded_vol)
-  return _internal_traded_vol();
-}
-inline void TradeFeedback::set_traded_vol(::int32_t value) {
-  _internal_set_traded_vol(value);
-  // @@protoc_insertion_point(field_set:TradeFeedback.traded_vol)
-}
-inline ::int32_t TradeFeedback::_internal_traded_vol() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.traded_vol_;
-}
-inline void TradeFeedback::_internal_set_traded_vol(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_vol_ = value;
-}
-
-// string order_time = 7;
-inline void TradeFeedback::clear_order_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_time_.ClearToEmpty();
-}
-inline const std::string& TradeFeedback::order_time() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:TradeFeedback.order_time)
-  return _internal_order_time();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void TradeFeedback::set_order_time(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_time_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:TradeFeedback.order_time)
-}
-inline std::string* TradeFeedback::mutable_order_time() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_order_time();
-  // @@protoc_insertion_point(field_mutable:TradeFeedback.order_time)
-  return _s;
-}
-inline const std::string& TradeFeedback::_internal_order_time() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_time_.Get();
-}
-inline void TradeFeedback::_internal_set_order_time(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_time_.Set(value, GetArena());
-}
-inline std::string* TradeFeedback::_internal_mutable_order_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.order_time_.Mutable( GetArena());
-}
-inline std::string* TradeFeedback::release_order_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:TradeFeedback.order_time)
-  return _impl_.order_time_.Release();
-}
-inline void TradeFeedback::set_allocated_order_time(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_time_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.order_time_.IsDefault()) {
-    _impl_.order_time_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:TradeFeedback.order_time)
-}
-
-// -------------------------------------------------------------------
-
-// AccountInfo
-
-// string account_id = 1;
-inline void AccountInfo::clear_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.ClearToEmpty();
-}
-inline const std::string& AccountInfo::account_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:AccountInfo.account_id)
-  return _internal_account_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AccountInfo::set_account_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:AccountInfo.account_id)
-}
-inline std::string* AccountInfo::mutable_account_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_account_id();
-  // @@protoc_insertion_point(field_mutable:AccountInfo.account_id)
-  return _s;
-}
-inline const std::string& AccountInfo::_internal_account_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.account_id_.Get();
-}
-inline void AccountInfo::_internal_set_account_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(value, GetArena());
-}
-inline std::string* AccountInfo::_internal_mutable_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.account_id_.Mutable( GetArena());
-}
-inline std::string* AccountInfo::release_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:AccountInfo.account_id)
-  return _impl_.account_id_.Release();
-}
-inline void AccountInfo::set_allocated_account_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.account_id_.IsDefault()) {
-    _impl_.account_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:AccountInfo.account_id)
-}
-
-// double cash = 2;
-inline void AccountInfo::clear_cash() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.cash_ = 0;
-}
-inline double AccountInfo::cash() const {
-  // @@protoc_insertion_point(field_get:AccountInfo.cash)
-  return _internal_cash();
-}
-inline void AccountInfo::set_cash(double value) {
-  _internal_set_cash(value);
-  // @@protoc_insertion_point(field_set:AccountInfo.cash)
-}
-inline double AccountInfo::_internal_cash() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.cash_;
-}
-inline void AccountInfo::_internal_set_cash(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.cash_ = value;
-}
-
-// double frozen_cash = 3;
-inline void AccountInfo::clear_frozen_cash() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.frozen_cash_ = 0;
-}
-inline double AccountInfo::frozen_cash() const {
-  // @@protoc_insertion_point(field_get:AccountInfo.frozen_cash)
-  return _internal_frozen_cash();
-}
-inline void AccountInfo::set_frozen_cash(double value) {
-  _internal_set_frozen_cash(value);
-  // @@protoc_insertion_point(field_set:AccountInfo.frozen_cash)
-}
-inline double AccountInfo::_internal_frozen_cash() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.frozen_cash_;
-}
-inline void AccountInfo::_internal_set_frozen_cash(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.frozen_cash_ = value;
-}
-
-// double total_asset = 4;
-inline void AccountInfo::clear_total_asset() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_asset_ = 0;
-}
-inline double AccountInfo::total_asset() const {
-  // @@protoc_insertion_point(field_get:AccountInfo.total_asset)
-  return _internal_total_asset();
-}
-inline void AccountInfo::set_total_asset(double value) {
-  _internal_set_total_asset(value);
-  // @@protoc_insertion_point(field_set:AccountInfo.total_asset)
-}
-inline double AccountInfo::_internal_total_asset() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.total_asset_;
-}
-inline void AccountInfo::_internal_set_total_asset(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.total_asset_ = value;
-}
-
-// double market_value = 5;
-inline void AccountInfo::clear_market_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.market_value_ = 0;
-}
-inline double AccountInfo::market_value() const {
-  // @@protoc_insertion_point(field_get:AccountInfo.market_value)
-  return _internal_market_value();
-}
-inline void AccountInfo::set_market_value(double value) {
-  _internal_set_market_value(value);
-  // @@protoc_insertion_point(field_set:AccountInfo.market_value)
-}
-inline double AccountInfo::_internal_market_value() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.market_value_;
-}
-inline void AccountInfo::_internal_set_market_value(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.market_value_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// AccountInfoResponse
-
-// string status = 1;
-inline void AccountInfoResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& AccountInfoResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:AccountInfoResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void AccountInfoResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:AccountInfoResponse.status)
-}
-inline std::string* AccountInfoResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:AccountInfoResponse.status)
-  return _s;
-}
-inline const std::string& AccountInfoResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void AccountInfoResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* AccountInfoResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* AccountInfoResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:AccountInfoResponse.status)
-  return _impl_.status_.Release();
-}
-inline void AccountInfoResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:AccountInfoResponse.status)
-}
-
-// .AccountInfo data = 2;
-inline bool AccountInfoResponse::has_data() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.data_ != nullptr);
-  return value;
-}
-inline void AccountInfoResponse::clear_data() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.data_ != nullptr) _impl_.data_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::AccountInfo& AccountInfoResponse::_internal_data() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  const ::AccountInfo* p = _impl_.data_;
-  return p != nullptr ? *p : reinterpret_cast<const ::AccountInfo&>(::_AccountInfo_default_instance_);
-}
-inline const ::AccountInfo& AccountInfoResponse::data() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:AccountInfoResponse.data)
-  return _internal_data();
-}
-inline void AccountInfoResponse::unsafe_arena_set_allocated_data(::AccountInfo* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.data_);
-  }
-  _impl_.data_ = reinterpret_cast<::AccountInfo*>(value);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:AccountInfoResponse.data)
-}
-inline ::AccountInfo* AccountInfoResponse::release_data() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::AccountInfo* released = _impl_.data_;
-  _impl_.data_ = nullptr;
-  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
-    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
-    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    if (GetArena() == nullptr) {
-      delete old;
-    }
-  } else {
-    if (GetArena() != nullptr) {
-      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    }
-  }
-  return released;
-}
-inline ::AccountInfo* AccountInfoResponse::unsafe_arena_release_data() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:AccountInfoResponse.data)
-
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::AccountInfo* temp = _impl_.data_;
-  _impl_.data_ = nullptr;
-  return temp;
-}
-inline ::AccountInfo* AccountInfoResponse::_internal_mutable_data() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.data_ == nullptr) {
-    auto* p = ::google::protobuf::Message::DefaultConstruct<::AccountInfo>(GetArena());
-    _impl_.data_ = reinterpret_cast<::AccountInfo*>(p);
-  }
-  return _impl_.data_;
-}
-inline ::AccountInfo* AccountInfoResponse::mutable_data() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  ::AccountInfo* _msg = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:AccountInfoResponse.data)
-  return _msg;
-}
-inline void AccountInfoResponse::set_allocated_data(::AccountInfo* value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (message_arena == nullptr) {
-    delete (_impl_.data_);
-  }
-
-  if (value != nullptr) {
-    ::google::protobuf::Arena* submessage_arena = (value)->GetArena();
-    if (message_arena != submessage_arena) {
-      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-
-  _impl_.data_ = reinterpret_cast<::AccountInfo*>(value);
-  // @@protoc_insertion_point(field_set_allocated:AccountInfoResponse.data)
-}
-
-// -------------------------------------------------------------------
-
-// Position
-
-// string account_id = 1;
-inline void Position::clear_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.ClearToEmpty();
-}
-inline const std::string& Position::account_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Position.account_id)
-  return _internal_account_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Position::set_account_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Position.account_id)
-}
-inline std::string* Position::mutable_account_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_account_id();
-  // @@protoc_insertion_point(field_mutable:Position.account_id)
-  return _s;
-}
-inline const std::string& Position::_internal_account_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.account_id_.Get();
-}
-inline void Position::_internal_set_account_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(value, GetArena());
-}
-inline std::string* Position::_internal_mutable_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.account_id_.Mutable( GetArena());
-}
-inline std::string* Position::release_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Position.account_id)
-  return _impl_.account_id_.Release();
-}
-inline void Position::set_allocated_account_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.account_id_.IsDefault()) {
-    _impl_.account_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Position.account_id)
-}
-
-// string stock_code = 2;
-inline void Position::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& Position::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Position.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Position::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Position.stock_code)
-}
-inline std::string* Position::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:Position.stock_code)
-  return _s;
-}
-inline const std::string& Position::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void Position::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* Position::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* Position::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Position.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void Position::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Position.stock_code)
-}
-
-// int32 vol = 3;
-inline void Position::clear_vol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.vol_ = 0;
-}
-inline ::int32_t Position::vol() const {
-  // @@protoc_insertion_point(field_get:Position.vol)
-  return _internal_vol();
-}
-inline void Position::set_vol(::int32_t value) {
-  _internal_set_vol(value);
-  // @@protoc_insertion_point(field_set:Position.vol)
-}
-inline ::int32_t Position::_internal_vol() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.vol_;
-}
-inline void Position::_internal_set_vol(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.vol_ = value;
-}
-
-// int32 available_vol = 4;
-inline void Position::clear_available_vol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.available_vol_ = 0;
-}
-inline ::int32_t Position::available_vol() const {
-  // @@protoc_insertion_point(field_get:Position.available_vol)
-  return _internal_available_vol();
-}
-inline void Position::set_available_vol(::int32_t value) {
-  _internal_set_available_vol(value);
-  // @@protoc_insertion_point(field_set:Position.available_vol)
-}
-inline ::int32_t Position::_internal_available_vol() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.available_vol_;
-}
-inline void Position::_internal_set_available_vol(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.available_vol_ = value;
-}
-
-// double avg_cost = 5;
-inline void Position::clear_avg_cost() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.avg_cost_ = 0;
-}
-inline double Position::avg_cost() const {
-  // @@protoc_insertion_point(field_get:Position.avg_cost)
-  return _internal_avg_cost();
-}
-inline void Position::set_avg_cost(double value) {
-  _internal_set_avg_cost(value);
-  // @@protoc_insertion_point(field_set:Position.avg_cost)
-}
-inline double Position::_internal_avg_cost() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.avg_cost_;
-}
-inline void Position::_internal_set_avg_cost(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.avg_cost_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// PositionsResponse
-
-// string status = 1;
-inline void PositionsResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& PositionsResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:PositionsResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void PositionsResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:PositionsResponse.status)
-}
-inline std::string* PositionsResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:PositionsResponse.status)
-  return _s;
-}
-inline const std::string& PositionsResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void PositionsResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* PositionsResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* PositionsResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:PositionsResponse.status)
-  return _impl_.status_.Release();
-}
-inline void PositionsResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:PositionsResponse.status)
-}
-
-// repeated .Position positions = 2;
-inline int PositionsResponse::_internal_positions_size() const {
-  return _internal_positions().size();
-}
-inline int PositionsResponse::positions_size() const {
-  return _internal_positions_size();
-}
-inline void PositionsResponse::clear_positions() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.positions_.Clear();
-}
-inline ::Position* PositionsResponse::mutable_positions(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:PositionsResponse.positions)
-  return _internal_mutable_positions()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::Position>* PositionsResponse::mutable_positions()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:PositionsResponse.positions)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_positions();
-}
-inline const ::Position& PositionsResponse::positions(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:PositionsResponse.positions)
-  return _internal_positions().Get(index);
-}
-inline ::Position* PositionsResponse::add_positions() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::Position* _add = _internal_mutable_positions()->Add();
-  // @@protoc_insertion_point(field_add:PositionsResponse.positions)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::Position>& PositionsResponse::positions() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:PositionsResponse.positions)
-  return _internal_positions();
-}
-inline const ::google::protobuf::RepeatedPtrField<::Position>&
-PositionsResponse::_internal_positions() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.positions_;
-}
-inline ::google::protobuf::RepeatedPtrField<::Position>*
-PositionsResponse::_internal_mutable_positions() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.positions_;
-}
-
-// -------------------------------------------------------------------
-
-// Order
-
-// string account_id = 1;
-inline void Order::clear_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.ClearToEmpty();
-}
-inline const std::string& Order::account_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Order.account_id)
-  return _internal_account_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Order::set_account_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Order.account_id)
-}
-inline std::string* Order::mutable_account_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_account_id();
-  // @@protoc_insertion_point(field_mutable:Order.account_id)
-  return _s;
-}
-inline const std::string& Order::_internal_account_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.account_id_.Get();
-}
-inline void Order::_internal_set_account_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(value, GetArena());
-}
-inline std::string* Order::_internal_mutable_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.account_id_.Mutable( GetArena());
-}
-inline std::string* Order::release_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Order.account_id)
-  return _impl_.account_id_.Release();
-}
-inline void Order::set_allocated_account_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.account_id_.IsDefault()) {
-    _impl_.account_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Order.account_id)
-}
-
-// string stock_code = 2;
-inline void Order::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& Order::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Order.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Order::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Order.stock_code)
-}
-inline std::string* Order::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:Order.stock_code)
-  return _s;
-}
-inline const std::string& Order::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void Order::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* Order::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* Order::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Order.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void Order::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Order.stock_code)
-}
-
-// int32 order_id = 3;
-inline void Order::clear_order_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = 0;
-}
-inline ::int32_t Order::order_id() const {
-  // @@protoc_insertion_point(field_get:Order.order_id)
-  return _internal_order_id();
-}
-inline void Order::set_order_id(::int32_t value) {
-  _internal_set_order_id(value);
-  // @@protoc_insertion_point(field_set:Order.order_id)
-}
-inline ::int32_t Order::_internal_order_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_id_;
-}
-inline void Order::_internal_set_order_id(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = value;
-}
-
-// string order_time = 4;
-inline void Order::clear_order_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_time_.ClearToEmpty();
-}
-inline const std::string& Order::order_time() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Order.order_time)
-  return _internal_order_time();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Order::set_order_time(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_time_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Order.order_time)
-}
-inline std::string* Order::mutable_order_time() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_order_time();
-  // @@protoc_insertion_point(field_mutable:Order.order_time)
-  return _s;
-}
-inline const std::string& Order::_internal_order_time() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_time_.Get();
-}
-inline void Order::_internal_set_order_time(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_time_.Set(value, GetArena());
-}
-inline std::string* Order::_internal_mutable_order_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.order_time_.Mutable( GetArena());
-}
-inline std::string* Order::release_order_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Order.order_time)
-  return _impl_.order_time_.Release();
-}
-inline void Order::set_allocated_order_time(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_time_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.order_time_.IsDefault()) {
-    _impl_.order_time_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Order.order_time)
-}
-
-// int32 order_type = 5;
-inline void Order::clear_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_ = 0;
-}
-inline ::int32_t Order::order_type() const {
-  // @@protoc_insertion_point(field_get:Order.order_type)
-  return _internal_order_type();
-}
-inline void Order::set_order_type(::int32_t value) {
-  _internal_set_order_type(value);
-  // @@protoc_insertion_point(field_set:Order.order_type)
-}
-inline ::int32_t Order::_internal_order_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_type_;
-}
-inline void Order::_internal_set_order_type(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_ = value;
-}
-
-// int32 order_vol = 6;
-inline void Order::clear_order_vol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_vol_ = 0;
-}
-inline ::int32_t Order::order_vol() const {
-  // @@protoc_insertion_point(field_get:Order.order_vol)
-  return _internal_order_vol();
-}
-inline void Order::set_order_vol(::int32_t value) {
-  _internal_set_order_vol(value);
-  // @@protoc_insertion_point(field_set:Order.order_vol)
-}
-inline ::int32_t Order::_internal_order_vol() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_vol_;
-}
-inline void Order::_internal_set_order_vol(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_vol_ = value;
-}
-
-// int32 price_type = 7;
-inline void Order::clear_price_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_type_ = 0;
-}
-inline ::int32_t Order::price_type() const {
-  // @@protoc_insertion_point(field_get:Order.price_type)
-  return _internal_price_type();
-}
-inline void Order::set_price_type(::int32_t value) {
-  _internal_set_price_type(value);
-  // @@protoc_insertion_point(field_set:Order.price_type)
-}
-inline ::int32_t Order::_internal_price_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.price_type_;
-}
-inline void Order::_internal_set_price_type(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_type_ = value;
-}
-
-// double price = 8;
-inline void Order::clear_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = 0;
-}
-inline double Order::price() const {
-  // @@protoc_insertion_point(field_get:Order.price)
-  return _internal_price();
-}
-inline void Order::set_price(double value) {
-  _internal_set_price(value);
-  // @@protoc_insertion_point(field_set:Order.price)
-}
-inline double Order::_internal_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.price_;
-}
-inline void Order::_internal_set_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = value;
-}
-
-// int32 traded_vol = 9;
-inline void Order::clear_traded_vol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_vol_ = 0;
-}
-inline ::int32_t Order::traded_vol() const {
-  // @@protoc_insertion_point(field_get:Order.traded_vol)
-  return _internal_traded_vol();
-}
-inline void Order::set_traded_vol(::int32_t value) {
-  _internal_set_traded_vol(value);
-  // @@protoc_insertion_point(field_set:Order.traded_vol)
-}
-inline ::int32_t Order::_internal_traded_vol() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.traded_vol_;
-}
-inline void Order::_internal_set_traded_vol(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_vol_ = value;
-}
-
-// int32 order_status = 10;
-inline void Order::clear_order_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_status_ = 0;
-}
-inline ::int32_t Order::order_status() const {
-  // @@protoc_insertion_point(field_get:Order.order_status)
-  return _internal_order_status();
-}
-inline void Order::set_order_status(::int32_t value) {
-  _internal_set_order_status(value);
-  // @@protoc_insertion_point(field_set:Order.order_status)
-}
-inline ::int32_t Order::_internal_order_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_status_;
-}
-inline void Order::_internal_set_order_status(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_status_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// OrderResponse
-
-// string status = 1;
-inline void OrderResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& OrderResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:OrderResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void OrderResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:OrderResponse.status)
-}
-inline std::string* OrderResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:OrderResponse.status)
-  return _s;
-}
-inline const std::string& OrderResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void OrderResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* OrderResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* OrderResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:OrderResponse.status)
-  return _impl_.status_.Release();
-}
-inline void OrderResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:OrderResponse.status)
-}
-
-// repeated .Order orders = 2;
-inline int OrderResponse::_internal_orders_size() const {
-  return _internal_orders().size();
-}
-inline int OrderResponse::orders_size() const {
-  return _internal_orders_size();
-}
-inline void OrderResponse::clear_orders() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.orders_.Clear();
-}
-inline ::Order* OrderResponse::mutable_orders(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:OrderResponse.orders)
-  return _internal_mutable_orders()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::Order>* OrderResponse::mutable_orders()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:OrderResponse.orders)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_orders();
-}
-inline const ::Order& OrderResponse::orders(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:OrderResponse.orders)
-  return _internal_orders().Get(index);
-}
-inline ::Order* OrderResponse::add_orders() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::Order* _add = _internal_mutable_orders()->Add();
-  // @@protoc_insertion_point(field_add:OrderResponse.orders)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::Order>& OrderResponse::orders() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:OrderResponse.orders)
-  return _internal_orders();
-}
-inline const ::google::protobuf::RepeatedPtrField<::Order>&
-OrderResponse::_internal_orders() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.orders_;
-}
-inline ::google::protobuf::RepeatedPtrField<::Order>*
-OrderResponse::_internal_mutable_orders() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.orders_;
-}
-
-// -------------------------------------------------------------------
-
-// Trade
-
-// string account_id = 1;
-inline void Trade::clear_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.ClearToEmpty();
-}
-inline const std::string& Trade::account_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Trade.account_id)
-  return _internal_account_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Trade::set_account_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Trade.account_id)
-}
-inline std::string* Trade::mutable_account_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_account_id();
-  // @@protoc_insertion_point(field_mutable:Trade.account_id)
-  return _s;
-}
-inline const std::string& Trade::_internal_account_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.account_id_.Get();
-}
-inline void Trade::_internal_set_account_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(value, GetArena());
-}
-inline std::string* Trade::_internal_mutable_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.account_id_.Mutable( GetArena());
-}
-inline std::string* Trade::release_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Trade.account_id)
-  return _impl_.account_id_.Release();
-}
-inline void Trade::set_allocated_account_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.account_id_.IsDefault()) {
-    _impl_.account_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Trade.account_id)
-}
-
-// string stock_code = 2;
-inline void Trade::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& Trade::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Trade.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Trade::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Trade.stock_code)
-}
-inline std::string* Trade::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:Trade.stock_code)
-  return _s;
-}
-inline const std::string& Trade::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void Trade::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* Trade::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* Trade::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Trade.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void Trade::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Trade.stock_code)
-}
-
-// int32 order_type = 3;
-inline void Trade::clear_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_ = 0;
-}
-inline ::int32_t Trade::order_type() const {
-  // @@protoc_insertion_point(field_get:Trade.order_type)
-  return _internal_order_type();
-}
-inline void Trade::set_order_type(::int32_t value) {
-  _internal_set_order_type(value);
-  // @@protoc_insertion_point(field_set:Trade.order_type)
-}
-inline ::int32_t Trade::_internal_order_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_type_;
-}
-inline void Trade::_internal_set_order_type(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_ = value;
-}
-
-// string traded_id = 4;
-inline void Trade::clear_traded_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_id_.ClearToEmpty();
-}
-inline const std::string& Trade::traded_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Trade.traded_id)
-  return _internal_traded_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Trade::set_traded_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Trade.traded_id)
-}
-inline std::string* Trade::mutable_traded_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_traded_id();
-  // @@protoc_insertion_point(field_mutable:Trade.traded_id)
-  return _s;
-}
-inline const std::string& Trade::_internal_traded_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.traded_id_.Get();
-}
-inline void Trade::_internal_set_traded_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_id_.Set(value, GetArena());
-}
-inline std::string* Trade::_internal_mutable_traded_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.traded_id_.Mutable( GetArena());
-}
-inline std::string* Trade::release_traded_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Trade.traded_id)
-  return _impl_.traded_id_.Release();
-}
-inline void Trade::set_allocated_traded_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.traded_id_.IsDefault()) {
-    _impl_.traded_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Trade.traded_id)
-}
-
-// string traded_time = 5;
-inline void Trade::clear_traded_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_time_.ClearToEmpty();
-}
-inline const std::string& Trade::traded_time() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Trade.traded_time)
-  return _internal_traded_time();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Trade::set_traded_time(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_time_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Trade.traded_time)
-}
-inline std::string* Trade::mutable_traded_time() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_traded_time();
-  // @@protoc_insertion_point(field_mutable:Trade.traded_time)
-  return _s;
-}
-inline const std::string& Trade::_internal_traded_time() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.traded_time_.Get();
-}
-inline void Trade::_internal_set_traded_time(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_time_.Set(value, GetArena());
-}
-inline std::string* Trade::_internal_mutable_traded_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.traded_time_.Mutable( GetArena());
-}
-inline std::string* Trade::release_traded_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Trade.traded_time)
-  return _impl_.traded_time_.Release();
-}
-inline void Trade::set_allocated_traded_time(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_time_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.traded_time_.IsDefault()) {
-    _impl_.traded_time_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Trade.traded_time)
-}
-
-// double traded_price = 6;
-inline void Trade::clear_traded_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_price_ = 0;
-}
-inline double Trade::traded_price() const {
-  // @@protoc_insertion_point(field_get:Trade.traded_price)
-  return _internal_traded_price();
-}
-inline void Trade::set_traded_price(double value) {
-  _internal_set_traded_price(value);
-  // @@protoc_insertion_point(field_set:Trade.traded_price)
-}
-inline double Trade::_internal_traded_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.traded_price_;
-}
-inline void Trade::_internal_set_traded_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_price_ = value;
-}
-
-// int32 traded_vol = 7;
-inline void Trade::clear_traded_vol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_vol_ = 0;
-}
-inline ::int32_t Trade::traded_vol() const {
-  // @@protoc_insertion_point(field_get:Trade.traded_vol)
-  return _internal_traded_vol();
-}
-inline void Trade::set_traded_vol(::int32_t value) {
-  _internal_set_traded_vol(value);
-  // @@protoc_insertion_point(field_set:Trade.traded_vol)
-}
-inline ::int32_t Trade::_internal_traded_vol() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.traded_vol_;
-}
-inline void Trade::_internal_set_traded_vol(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.traded_vol_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// TradeResponse
-
-// string status = 1;
-inline void TradeResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& TradeResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:TradeResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void TradeResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:TradeResponse.status)
-}
-inline std::string* TradeResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:TradeResponse.status)
-  return _s;
-}
-inline const std::string& TradeResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void TradeResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* TradeResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* TradeResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:TradeResponse.status)
-  return _impl_.status_.Release();
-}
-inline void TradeResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:TradeResponse.status)
-}
-
-// repeated .Trade trades = 2;
-inline int TradeResponse::_internal_trades_size() const {
-  return _internal_trades().size();
-}
-inline int TradeResponse::trades_size() const {
-  return _internal_trades_size();
-}
-inline void TradeResponse::clear_trades() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.trades_.Clear();
-}
-inline ::Trade* TradeResponse::mutable_trades(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:TradeResponse.trades)
-  return _internal_mutable_trades()->Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField<::Trade>* TradeResponse::mutable_trades()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:TradeResponse.trades)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_trades();
-}
-inline const ::Trade& TradeResponse::trades(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:TradeResponse.trades)
-  return _internal_trades().Get(index);
-}
-inline ::Trade* TradeResponse::add_trades() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::Trade* _add = _internal_mutable_trades()->Add();
-  // @@protoc_insertion_point(field_add:TradeResponse.trades)
-  return _add;
-}
-inline const ::google::protobuf::RepeatedPtrField<::Trade>& TradeResponse::trades() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:TradeResponse.trades)
-  return _internal_trades();
-}
-inline const ::google::protobuf::RepeatedPtrField<::Trade>&
-TradeResponse::_internal_trades() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.trades_;
-}
-inline ::google::protobuf::RepeatedPtrField<::Trade>*
-TradeResponse::_internal_mutable_trades() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.trades_;
-}
-
-// -------------------------------------------------------------------
-
-// PlaceOrder
-
-// string account_id = 1;
-inline void PlaceOrder::clear_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.ClearToEmpty();
-}
-inline const std::string& PlaceOrder::account_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:PlaceOrder.account_id)
-  return _internal_account_id();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void PlaceOrder::set_account_id(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:PlaceOrder.account_id)
-}
-inline std::string* PlaceOrder::mutable_account_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_account_id();
-  // @@protoc_insertion_point(field_mutable:PlaceOrder.account_id)
-  return _s;
-}
-inline const std::string& PlaceOrder::_internal_account_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.account_id_.Get();
-}
-inline void PlaceOrder::_internal_set_account_id(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.Set(value, GetArena());
-}
-inline std::string* PlaceOrder::_internal_mutable_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.account_id_.Mutable( GetArena());
-}
-inline std::string* PlaceOrder::release_account_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:PlaceOrder.account_id)
-  return _impl_.account_id_.Release();
-}
-inline void PlaceOrder::set_allocated_account_id(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.account_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.account_id_.IsDefault()) {
-    _impl_.account_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:PlaceOrder.account_id)
-}
-
-// string stock_code = 2;
-inline void PlaceOrder::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& PlaceOrder::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:PlaceOrder.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void PlaceOrder::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:PlaceOrder.stock_code)
-}
-inline std::string* PlaceOrder::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:PlaceOrder.stock_code)
-  return _s;
-}
-inline const std::string& PlaceOrder::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void PlaceOrder::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* PlaceOrder::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* PlaceOrder::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:PlaceOrder.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void PlaceOrder::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:PlaceOrder.stock_code)
-}
-
-// int32 how_many = 3;
-inline void PlaceOrder::clear_how_many() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.how_many_ = 0;
-}
-inline ::int32_t PlaceOrder::how_many() const {
-  // @@protoc_insertion_point(field_get:PlaceOrder.how_many)
-  return _internal_how_many();
-}
-inline void PlaceOrder::set_how_many(::int32_t value) {
-  _internal_set_how_many(value);
-  // @@protoc_insertion_point(field_set:PlaceOrder.how_many)
-}
-inline ::int32_t PlaceOrder::_internal_how_many() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.how_many_;
-}
-inline void PlaceOrder::_internal_set_how_many(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.how_many_ = value;
-}
-
-// double price = 4;
-inline void PlaceOrder::clear_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = 0;
-}
-inline double PlaceOrder::price() const {
-  // @@protoc_insertion_point(field_get:PlaceOrder.price)
-  return _internal_price();
-}
-inline void PlaceOrder::set_price(double value) {
-  _internal_set_price(value);
-  // @@protoc_insertion_point(field_set:PlaceOrder.price)
-}
-inline double PlaceOrder::_internal_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.price_;
-}
-inline void PlaceOrder::_internal_set_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.price_ = value;
-}
-
-// string order_type = 5;
-inline void PlaceOrder::clear_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.ClearToEmpty();
-}
-inline const std::string& PlaceOrder::order_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:PlaceOrder.order_type)
-  return _internal_order_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void PlaceOrder::set_order_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:PlaceOrder.order_type)
-}
-inline std::string* PlaceOrder::mutable_order_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_order_type();
-  // @@protoc_insertion_point(field_mutable:PlaceOrder.order_type)
-  return _s;
-}
-inline const std::string& PlaceOrder::_internal_order_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_type_.Get();
-}
-inline void PlaceOrder::_internal_set_order_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.Set(value, GetArena());
-}
-inline std::string* PlaceOrder::_internal_mutable_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.order_type_.Mutable( GetArena());
-}
-inline std::string* PlaceOrder::release_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:PlaceOrder.order_type)
-  return _impl_.order_type_.Release();
-}
-inline void PlaceOrder::set_allocated_order_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.order_type_.IsDefault()) {
-    _impl_.order_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:PlaceOrder.order_type)
-}
-
-// string place_type = 6;
-inline void PlaceOrder::clear_place_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.place_type_.ClearToEmpty();
-}
-inline const std::string& PlaceOrder::place_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:PlaceOrder.place_type)
-  return _internal_place_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void PlaceOrder::set_place_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.place_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:PlaceOrder.place_type)
-}
-inline std::string* PlaceOrder::mutable_place_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_place_type();
-  // @@protoc_insertion_point(field_mutable:PlaceOrder.place_type)
-  return _s;
-}
-inline const std::string& PlaceOrder::_internal_place_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.place_type_.Get();
-}
-inline void PlaceOrder::_internal_set_place_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.place_type_.Set(value, GetArena());
-}
-inline std::string* PlaceOrder::_internal_mutable_place_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.place_type_.Mutable( GetArena());
-}
-inline std::string* PlaceOrder::release_place_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:PlaceOrder.place_type)
-  return _impl_.place_type_.Release();
-}
-inline void PlaceOrder::set_allocated_place_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.place_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.place_type_.IsDefault()) {
-    _impl_.place_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:PlaceOrder.place_type)
-}
-
-// -------------------------------------------------------------------
-
-// PlaceOrderResponse
-
-// string status = 1;
-inline void PlaceOrderResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& PlaceOrderResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:PlaceOrderResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void PlaceOrderResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:PlaceOrderResponse.status)
-}
-inline std::string* PlaceOrderResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:PlaceOrderResponse.status)
-  return _s;
-}
-inline const std::string& PlaceOrderResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void PlaceOrderResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* PlaceOrderResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* PlaceOrderResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:PlaceOrderResponse.status)
-  return _impl_.status_.Release();
-}
-inline void PlaceOrderResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:PlaceOrderResponse.status)
-}
-
-// string msg = 2;
-inline void PlaceOrderResponse::clear_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.ClearToEmpty();
-}
-inline const std::string& PlaceOrderResponse::msg() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:PlaceOrderResponse.msg)
-  return _internal_msg();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void PlaceOrderResponse::set_msg(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:PlaceOrderResponse.msg)
-}
-inline std::string* PlaceOrderResponse::mutable_msg() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_msg();
-  // @@protoc_insertion_point(field_mutable:PlaceOrderResponse.msg)
-  return _s;
-}
-inline const std::string& PlaceOrderResponse::_internal_msg() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.msg_.Get();
-}
-inline void PlaceOrderResponse::_internal_set_msg(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.Set(value, GetArena());
-}
-inline std::string* PlaceOrderResponse::_internal_mutable_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.msg_.Mutable( GetArena());
-}
-inline std::string* PlaceOrderResponse::release_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:PlaceOrderResponse.msg)
-  return _impl_.msg_.Release();
-}
-inline void PlaceOrderResponse::set_allocated_msg(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.msg_.IsDefault()) {
-    _impl_.msg_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:PlaceOrderResponse.msg)
-}
-
-// -------------------------------------------------------------------
-
-// CancelOrderId
-
-// int32 order_id = 1;
-inline void CancelOrderId::clear_order_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = 0;
-}
-inline ::int32_t CancelOrderId::order_id() const {
-  // @@protoc_insertion_point(field_get:CancelOrderId.order_id)
-  return _internal_order_id();
-}
-inline void CancelOrderId::set_order_id(::int32_t value) {
-  _internal_set_order_id(value);
-  // @@protoc_insertion_point(field_set:CancelOrderId.order_id)
-}
-inline ::int32_t CancelOrderId::_internal_order_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_id_;
-}
-inline void CancelOrderId::_internal_set_order_id(::int32_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_id_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// CancelOrderIdResponse
-
-// string status = 1;
-inline void CancelOrderIdResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& CancelOrderIdResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:CancelOrderIdResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CancelOrderIdResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:CancelOrderIdResponse.status)
-}
-inline std::string* CancelOrderIdResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:CancelOrderIdResponse.status)
-  return _s;
-}
-inline const std::string& CancelOrderIdResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void CancelOrderIdResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* CancelOrderIdResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* CancelOrderIdResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:CancelOrderIdResponse.status)
-  return _impl_.status_.Release();
-}
-inline void CancelOrderIdResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:CancelOrderIdResponse.status)
-}
-
-// string msg = 2;
-inline void CancelOrderIdResponse::clear_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.ClearToEmpty();
-}
-inline const std::string& CancelOrderIdResponse::msg() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:CancelOrderIdResponse.msg)
-  return _internal_msg();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CancelOrderIdResponse::set_msg(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:CancelOrderIdResponse.msg)
-}
-inline std::string* CancelOrderIdResponse::mutable_msg() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_msg();
-  // @@protoc_insertion_point(field_mutable:CancelOrderIdResponse.msg)
-  return _s;
-}
-inline const std::string& CancelOrderIdResponse::_internal_msg() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.msg_.Get();
-}
-inline void CancelOrderIdResponse::_internal_set_msg(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.Set(value, GetArena());
-}
-inline std::string* CancelOrderIdResponse::_internal_mutable_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.msg_.Mutable( GetArena());
-}
-inline std::string* CancelOrderIdResponse::release_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:CancelOrderIdResponse.msg)
-  return _impl_.msg_.Release();
-}
-inline void CancelOrderIdResponse::set_allocated_msg(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.msg_.IsDefault()) {
-    _impl_.msg_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:CancelOrderIdResponse.msg)
-}
-
-// -------------------------------------------------------------------
-
-// CancelStockScope
-
-// string order_type = 1;
-inline void CancelStockScope::clear_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.ClearToEmpty();
-}
-inline const std::string& CancelStockScope::order_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:CancelStockScope.order_type)
-  return _internal_order_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CancelStockScope::set_order_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:CancelStockScope.order_type)
-}
-inline std::string* CancelStockScope::mutable_order_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_order_type();
-  // @@protoc_insertion_point(field_mutable:CancelStockScope.order_type)
-  return _s;
-}
-inline const std::string& CancelStockScope::_internal_order_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_type_.Get();
-}
-inline void CancelStockScope::_internal_set_order_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.Set(value, GetArena());
-}
-inline std::string* CancelStockScope::_internal_mutable_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.order_type_.Mutable( GetArena());
-}
-inline std::string* CancelStockScope::release_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:CancelStockScope.order_type)
-  return _impl_.order_type_.Release();
-}
-inline void CancelStockScope::set_allocated_order_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.order_type_.IsDefault()) {
-    _impl_.order_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:CancelStockScope.order_type)
-}
-
-// string stock_code = 2;
-inline void CancelStockScope::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& CancelStockScope::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:CancelStockScope.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CancelStockScope::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:CancelStockScope.stock_code)
-}
-inline std::string* CancelStockScope::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:CancelStockScope.stock_code)
-  return _s;
-}
-inline const std::string& CancelStockScope::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void CancelStockScope::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* CancelStockScope::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* CancelStockScope::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:CancelStockScope.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void CancelStockScope::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:CancelStockScope.stock_code)
-}
-
-// -------------------------------------------------------------------
-
-// CancelStockScopeResponse
-
-// string status = 1;
-inline void CancelStockScopeResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& CancelStockScopeResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:CancelStockScopeResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CancelStockScopeResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:CancelStockScopeResponse.status)
-}
-inline std::string* CancelStockScopeResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:CancelStockScopeResponse.status)
-  return _s;
-}
-inline const std::string& CancelStockScopeResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void CancelStockScopeResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* CancelStockScopeResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* CancelStockScopeResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:CancelStockScopeResponse.status)
-  return _impl_.status_.Release();
-}
-inline void CancelStockScopeResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:CancelStockScopeResponse.status)
-}
-
-// string order_type = 2;
-inline void CancelStockScopeResponse::clear_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.ClearToEmpty();
-}
-inline const std::string& CancelStockScopeResponse::order_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:CancelStockScopeResponse.order_type)
-  return _internal_order_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CancelStockScopeResponse::set_order_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:CancelStockScopeResponse.order_type)
-}
-inline std::string* CancelStockScopeResponse::mutable_order_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_order_type();
-  // @@protoc_insertion_point(field_mutable:CancelStockScopeResponse.order_type)
-  return _s;
-}
-inline const std::string& CancelStockScopeResponse::_internal_order_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.order_type_.Get();
-}
-inline void CancelStockScopeResponse::_internal_set_order_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.Set(value, GetArena());
-}
-inline std::string* CancelStockScopeResponse::_internal_mutable_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.order_type_.Mutable( GetArena());
-}
-inline std::string* CancelStockScopeResponse::release_order_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:CancelStockScopeResponse.order_type)
-  return _impl_.order_type_.Release();
-}
-inline void CancelStockScopeResponse::set_allocated_order_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.order_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.order_type_.IsDefault()) {
-    _impl_.order_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:CancelStockScopeResponse.order_type)
-}
-
-// string stock_code = 3;
-inline void CancelStockScopeResponse::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& CancelStockScopeResponse::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:CancelStockScopeResponse.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CancelStockScopeResponse::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:CancelStockScopeResponse.stock_code)
-}
-inline std::string* CancelStockScopeResponse::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:CancelStockScopeResponse.stock_code)
-  return _s;
-}
-inline const std::string& CancelStockScopeResponse::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void CancelStockScopeResponse::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* CancelStockScopeResponse::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* CancelStockScopeResponse::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:CancelStockScopeResponse.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void CancelStockScopeResponse::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:CancelStockScopeResponse.stock_code)
-}
-
-// string msg = 4;
-inline void CancelStockScopeResponse::clear_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.ClearToEmpty();
-}
-inline const std::string& CancelStockScopeResponse::msg() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:CancelStockScopeResponse.msg)
-  return _internal_msg();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void CancelStockScopeResponse::set_msg(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:CancelStockScopeResponse.msg)
-}
-inline std::string* CancelStockScopeResponse::mutable_msg() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_msg();
-  // @@protoc_insertion_point(field_mutable:CancelStockScopeResponse.msg)
-  return _s;
-}
-inline const std::string& CancelStockScopeResponse::_internal_msg() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.msg_.Get();
-}
-inline void CancelStockScopeResponse::_internal_set_msg(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.Set(value, GetArena());
-}
-inline std::string* CancelStockScopeResponse::_internal_mutable_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.msg_.Mutable( GetArena());
-}
-inline std::string* CancelStockScopeResponse::release_msg() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:CancelStockScopeResponse.msg)
-  return _impl_.msg_.Release();
-}
-inline void CancelStockScopeResponse::set_allocated_msg(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.msg_.IsDefault()) {
-    _impl_.msg_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:CancelStockScopeResponse.msg)
-}
-
-// -------------------------------------------------------------------
-
-// Entrusts
-
-// string stock_code = 1;
-inline void Entrusts::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& Entrusts::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Entrusts.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Entrusts::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Entrusts.stock_code)
-}
-inline std::string* Entrusts::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:Entrusts.stock_code)
-  return _s;
-}
-inline const std::string& Entrusts::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void Entrusts::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* Entrusts::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* Entrusts::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Entrusts.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void Entrusts::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Entrusts.stock_code)
-}
-
-// string trade_type = 2;
-inline void Entrusts::clear_trade_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.trade_type_.ClearToEmpty();
-}
-inline const std::string& Entrusts::trade_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Entrusts.trade_type)
-  return _internal_trade_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Entrusts::set_trade_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.trade_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Entrusts.trade_type)
-}
-inline std::string* Entrusts::mutable_trade_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_trade_type();
-  // @@protoc_insertion_point(field_mutable:Entrusts.trade_type)
-  return _s;
-}
-inline const std::string& Entrusts::_internal_trade_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.trade_type_.Get();
-}
-inline void Entrusts::_internal_set_trade_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.trade_type_.Set(value, GetArena());
-}
-inline std::string* Entrusts::_internal_mutable_trade_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.trade_type_.Mutable( GetArena());
-}
-inline std::string* Entrusts::release_trade_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Entrusts.trade_type)
-  return _impl_.trade_type_.Release();
-}
-inline void Entrusts::set_allocated_trade_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.trade_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.trade_type_.IsDefault()) {
-    _impl_.trade_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Entrusts.trade_type)
-}
-
-// string data_type = 3;
-inline void Entrusts::clear_data_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.data_type_.ClearToEmpty();
-}
-inline const std::string& Entrusts::data_type() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Entrusts.data_type)
-  return _internal_data_type();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void Entrusts::set_data_type(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.data_type_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Entrusts.data_type)
-}
-inline std::string* Entrusts::mutable_data_type() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_data_type();
-  // @@protoc_insertion_point(field_mutable:Entrusts.data_type)
-  return _s;
-}
-inline const std::string& Entrusts::_internal_data_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.data_type_.Get();
-}
-inline void Entrusts::_internal_set_data_type(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.data_type_.Set(value, GetArena());
-}
-inline std::string* Entrusts::_internal_mutable_data_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.data_type_.Mutable( GetArena());
-}
-inline std::string* Entrusts::release_data_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Entrusts.data_type)
-  return _impl_.data_type_.Release();
-}
-inline void Entrusts::set_allocated_data_type(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.data_type_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.data_type_.IsDefault()) {
-    _impl_.data_type_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:Entrusts.data_type)
-}
-
-// -------------------------------------------------------------------
-
-// EntrustsResponse
-
-// string status = 1;
-inline void EntrustsResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& EntrustsResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:EntrustsResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void EntrustsResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:EntrustsResponse.status)
-}
-inline std::string* EntrustsResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:EntrustsResponse.status)
-  return _s;
-}
-inline const std::string& EntrustsResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void EntrustsResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* EntrustsResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* EntrustsResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:EntrustsResponse.status)
-  return _impl_.status_.Release();
-}
-inline void EntrustsResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:EntrustsResponse.status)
-}
-
-// double result = 2;
-inline void EntrustsResponse::clear_result() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.result_ = 0;
-}
-inline double EntrustsResponse::result() const {
-  // @@protoc_insertion_point(field_get:EntrustsResponse.result)
-  return _internal_result();
-}
-inline void EntrustsResponse::set_result(double value) {
-  _internal_set_result(value);
-  // @@protoc_insertion_point(field_set:EntrustsResponse.result)
-}
-inline double EntrustsResponse::_internal_result() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.result_;
-}
-inline void EntrustsResponse::_internal_set_result(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.result_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// TodayEntrustsValueResponse
-
-// string status = 1;
-inline void TodayEntrustsValueResponse::clear_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.ClearToEmpty();
-}
-inline const std::string& TodayEntrustsValueResponse::status() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:TodayEntrustsValueResponse.status)
-  return _internal_status();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void TodayEntrustsValueResponse::set_status(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:TodayEntrustsValueResponse.status)
-}
-inline std::string* TodayEntrustsValueResponse::mutable_status() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:TodayEntrustsValueResponse.status)
-  return _s;
-}
-inline const std::string& TodayEntrustsValueResponse::_internal_status() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.status_.Get();
-}
-inline void TodayEntrustsValueResponse::_internal_set_status(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.Set(value, GetArena());
-}
-inline std::string* TodayEntrustsValueResponse::_internal_mutable_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.status_.Mutable( GetArena());
-}
-inline std::string* TodayEntrustsValueResponse::release_status() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:TodayEntrustsValueResponse.status)
-  return _impl_.status_.Release();
-}
-inline void TodayEntrustsValueResponse::set_allocated_status(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.status_.IsDefault()) {
-    _impl_.status_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:TodayEntrustsValueResponse.status)
-}
-
-// double unvalue = 2;
-inline void TodayEntrustsValueResponse::clear_unvalue() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.unvalue_ = 0;
-}
-inline double TodayEntrustsValueResponse::unvalue() const {
-  // @@protoc_insertion_point(field_get:TodayEntrustsValueResponse.unvalue)
-  return _internal_unvalue();
-}
-inline void TodayEntrustsValueResponse::set_unvalue(double value) {
-  _internal_set_unvalue(value);
-  // @@protoc_insertion_point(field_set:TodayEntrustsValueResponse.unvalue)
-}
-inline double TodayEntrustsValueResponse::_internal_unvalue() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.unvalue_;
-}
-inline void TodayEntrustsValueResponse::_internal_set_unvalue(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.unvalue_ = value;
-}
-
-// double envalue = 3;
-inline void TodayEntrustsValueResponse::clear_envalue() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.envalue_ = 0;
-}
-inline double TodayEntrustsValueResponse::envalue() const {
-  // @@protoc_insertion_point(field_get:TodayEntrustsValueResponse.envalue)
-  return _internal_envalue();
-}
-inline void TodayEntrustsValueResponse::set_envalue(double value) {
-  _internal_set_envalue(value);
-  // @@protoc_insertion_point(field_set:TodayEntrustsValueResponse.envalue)
-}
-inline double TodayEntrustsValueResponse::_internal_envalue() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.envalue_;
-}
-inline void TodayEntrustsValueResponse::_internal_set_envalue(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.envalue_ = value;
-}
-
-// -------------------------------------------------------------------
-
-// StockPositions
-
-// string stock_code = 1;
-inline void StockPositions::clear_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.ClearToEmpty();
-}
-inline const std::string& StockPositions::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:StockPositions.stock_code)
-  return _internal_stock_code();
-}
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void StockPositions::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:StockPositions.stock_code)
-}
-inline std::string* StockPositions::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:StockPositions.stock_code)
-  return _s;
-}
-inline const std::string& StockPositions::_internal_stock_code() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stock_code_.Get();
-}
-inline void StockPositions::_internal_set_stock_code(const std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.Set(value, GetArena());
-}
-inline std::string* StockPositions::_internal_mutable_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.stock_code_.Mutable( GetArena());
-}
-inline std::string* StockPositions::release_stock_code() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:StockPositions.stock_code)
-  return _impl_.stock_code_.Release();
-}
-inline void StockPositions::set_allocated_stock_code(std::string* value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.stock_code_.IsDefault()) {
-    _impl_.stock_code_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:StockPositions.stock_code)
-}
-
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif  // __GNUC__
-
-// @@protoc_insertion_point(namespace_scope)
-
-
-// @@protoc_insertion_point(global_scope)
-
-#include "google/protobuf/port_undef.inc"
-
-#endif  // little_5fgoal_2eproto_2epb_2eh
@@ -0,0 +1,61 @@
+﻿#include "lmdb_kv_store.h"
+#include "write_combiner.h"
+
+void LmdbKVStore::Configure(LMDBClient* db, WriteCombiner* writes, BlockEngine* blocks) {
+    db_ = db;
+    writes_ = writes;
+    blocks_ = blocks;
+}
+
+bool LmdbKVStore::GetDouble(const std::string& key, double* value) {
+    *value = 0;   // WriteCombiner / LMDBClient 读不到时不改 *value
+    return writes_->GetDouble(key, value);
+}
+
+bool LmdbKVStore::PutDouble(const std::string& key, double value) {
+    return writes_->PutDouble(key, value);
+}
+
+bool LmdbKVStore::IncrementDouble(const std::string& key, double delta) {
+    return writes_->IncrementDouble(key, delta);
+}
+
+bool LmdbKVStore::Delete(const std::string& key) {
+    return writes_->Delete(key);
+}
+
+bool LmdbKVStore::DeleteKeys(const std::string& prefix) {
+    return db_->DeleteKeys(prefix);
+}
+
+bool LmdbKVStore::AggregateDoubles(const std::string& prefix, Aggregate* result) {
+    return writes_->AggregateDoubles(prefix, result);
+}
+
+bool LmdbKVStore::BlockAdd(uint32_t block_id, std::string_view stock_code) {
+    return blocks_->Add(block_id, stock_code);
+}
+
+bool LmdbKVStore::BlockContains(uint32_t block_id, std::string_view stock_code) {
+    return blocks_->Contains(block_id, stock_code);
+}
+
+uint64_t LmdbKVStore::BlockSize(uint32_t block_id) {
+    return blocks_->Size(block_id);
+}
+
+uint64_t LmdbKVStore::BlockCombinedSize(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) {
+    return blocks_->CombinedSize(op, block_ids);
+}
+
+BlockBitmap LmdbKVStore::BlockCombine(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) {
+    return blocks_->Combine(op, block_ids);
+}
+
+bool LmdbKVStore::ResetBlocks() {
+    return blocks_->Reset();
+}
+
+bool LmdbKVStore::Flush(std::chrono::milliseconds timeout) {
+    return writes_->Flush(timeout);
+}
@@ -0,0 +1,45 @@
+﻿#pragma once
+
+#include "kv_store.h"
+
+class WriteCombiner;
+
+// 本机 LMDB 后端：标量读写经 WriteCombiner（合并写开关、读缓存都在它里面），板块经 BlockEngine
+class LmdbKVStore : public KVStore {
+public:
+    LmdbKVStore(const LmdbKVStore&) = delete;
+    LmdbKVStore& operator=(const LmdbKVStore&) = delete;
+
+    static LmdbKVStore& GetInstance() {
+        static LmdbKVStore instance;
+        return instance;
+    }
+
+    // 三者都需已 Configure
+    void Configure(LMDBClient* db, WriteCombiner* writes, BlockEngine* blocks);
+
+    bool GetDouble(const std::string& key, double* value) override;
+    bool PutDouble(const std::string& key, double value) override;
+    bool IncrementDouble(const std::string& key, double delta) override;
+    bool Delete(const std::string& key) override;
+    bool DeleteKeys(const std::string& prefix) override;
+    bool AggregateDoubles(const std::string& prefix, Aggregate* result) override;
+
+    bool BlockAdd(uint32_t block_id, std::string_view stock_code) override;
+    bool BlockContains(uint32_t block_id, std::string_view stock_code) override;
+    uint64_t BlockSize(uint32_t block_id) override;
+    uint64_t BlockCombinedSize(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) override;
+    BlockBitmap BlockCombine(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) override;
+    bool ResetBlocks() override;
+
+    bool Flush(std::chrono::milliseconds timeout) override;
+
+    const char* Name() const override { return "lmdb"; }
+
+private:
+    LmdbKVStore() = default;
+
+    LMDBClient* db_ = nullptr;
+    WriteCombiner* writes_ = nullptr;
+    BlockEngine* blocks_ = nullptr;
+};
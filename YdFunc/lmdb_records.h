@@ -0,0 +1,70 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// LMDB 中持仓和账户的定长二进制记录，替代每个字段一个 key 的旧格式
+//   旧：positions:<code>:vol / :available_vol / :avg_cost，account:total_asset / ...（每个 8 字节 double）
+//   新：record:position:<code> -> PositionRecord，record:account -> AccountRecord
+// 1. 小端、自然对齐，与 tools/lmdb_records.py 的 struct 格式一致，写入方一次 put 整条记录即原子更新
+// 2. 升级规则：字段只追加不修改，追加时 version 加一；
+//    读取方按实际长度拷贝，缺的字段补 0，比自己新的记录也能读出已知部分
+// 3. version / updated_ms 之后是业务字段；updated_ms 为写入时刻（Unix 毫秒）
+
+namespace lmdb_records {
+
+constexpr uint16_t kPositionVersion = 1;
+constexpr uint16_t kAccountVersion = 1;
+
+constexpr std::string_view kPositionPrefix = "record:position:";
+constexpr std::string_view kAccountKey = "record:account";
+
+struct PositionRecord {
+    uint16_t version = kPositionVersion;
+    uint16_t reserved0 = 0;
+    uint32_t reserved1 = 0;
+    int64_t updated_ms = 0;
+    double vol = 0;
+    double available_vol = 0;
+    double avg_cost = 0;
+};
+static_assert(sizeof(PositionRecord) == 40, "PositionRecord 布局与 lmdb_records.py 不一致");
+
+struct AccountRecord {
+    uint16_t version = kAccountVersion;
+    uint16_t reserved0 = 0;
+    uint32_t reserved1 = 0;
+    int64_t updated_ms = 0;
+    double total_asset = 0;
+    double frozen_cash = 0;
+    double cash = 0;
+    double market_value = 0;
+};
+static_assert(sizeof(AccountRecord) == 48, "AccountRecord 布局与 lmdb_records.py 不一致");
+
+// 至少要包含 version 和 updated_ms
+constexpr size_t kMinRecordSize = 16;
+
+inline std::string PositionKey(std::string_view stock_code) {
+    std::string key(kPositionPrefix);
+    key.append(stock_code);
+    return key;
+}
+
+// 从 LMDB 中的原始字节解析记录；长度不足 kMinRecordSize 或 version 为 0 时返回 false
+template <typename Record>
+bool Decode(const void* data, size_t size, Record* out) {
+    if (size < kMinRecordSize) return false;
+    static_assert(std::is_trivially_copyable_v<Record>, "记录必须可以按字节拷贝");
+    Record record{}; // 比 size 多出的字段保持默认值 0
+    std::memcpy(&record, data, size < sizeof(Record) ? size : sizeof(Record));
+    if (record.version == 0) return false;
+    if (out) *out = record;
+    return true;
+}
+
+} // namespace lmdb_records
@@ -0,0 +1,69 @@
+﻿#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// ProtobufHttpClient 之下的可插拔传输层，由 config.ini [http] transport 选择
+//   tcp  : CurlMultiEngine，经本机回环 HTTP
+//   unix : CurlMultiEngine + CURLOPT_UNIX_SOCKET_PATH，仍是 HTTP，但不经过 TCP 协议栈
+//   shm  : ShmTransport，共享内存 SPSC 环形缓冲区，只传带长度前缀的 protobuf 帧，没有 HTTP 头
+// 所有实现都满足：Submit 可在任意线程调用；ordering_key 相同的请求按提交顺序处理；
+// 完成回调在传输层自己的 I/O 线程上执行，必须很轻
+class MessageTransport {
+public:
+    struct Request {
+        std::string method;
+        std::string url;                // tcp / unix 使用
+        std::string endpoint;           // shm 使用，例如 /place_order/vol
+        std::string body;
+        std::string ca_cert_path;
+        std::string unix_socket_path;   // 非空时 curl 走 AF_UNIX
+        std::string ordering_key;
+        long timeout_ms = 5000;
+    };
+
+    // 失败的请求走到了哪一步，由各传输按自己的错误码判断
+    enum class SendPhase : uint8_t {
+        NotSent,     // 确定没有离开本进程：排队被拒、序列化失败、建连之前失败或超时、帧超过共享内存环
+        MaybeSent,   // 其余情况（包括成功后的 HTTP 错误、解析失败），后端可能已经处理了请求
+    };
+
+    struct Result {
+        bool ok = false;        // 传输是否完成（不代表 HTTP 2xx）
+        SendPhase phase = SendPhase::MaybeSent;   // ok 为 false 时有意义
+        long http_code = 0;     // shm 传输由服务端填入同样语义的状态码
+        std::string body;
+        std::string error;
+        // 各阶段耗时（微秒），-1 表示该传输不提供
+        int64_t queue_us = -1;        // Submit 到开始发送
+        int64_t connect_us = -1;      // 建连
+        int64_t first_byte_us = -1;   // 开始发送到收到第一个字节
+    };
+
+    using Completion = std::function<void(Result&)>;
+
+    struct Stats {
+        size_t pending = 0;     // 已提交未完成（含排队和传输中）
+        size_t in_flight = 0;   // 已交给底层（curl / 环形缓冲区）的
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        uint64_t rejected = 0;
+    };
+
+    // 超过上限或已停止时返回 false，done 不会被调用
+    virtual bool Submit(Request request, Completion done) = 0;
+
+    // 停止接收新请求，等待已提交的请求完成（最多 timeout），然后停止 I/O 线程；由 ShutdownRuntime 调用
+    virtual bool Drain(std::chrono::milliseconds timeout) = 0;
+
+    virtual Stats GetStats() const = 0;
+
+    virtual const char* Name() const = 0;
+
+protected:
+    // 实现都是进程级单例，不通过基类指针析构
+    ~MessageTransport() = default;
+};
@@ -0,0 +1,53 @@
+﻿#pragma once
+
+#include <atomic>
+#include <utility>
+
+// 无锁多生产者单消费者队列 (Vyukov MPSC)
+// 生产者只做一次 exchange + 一次 store，不加锁；Pop 只能由唯一的消费者线程调用。
+// 生产者 exchange 之后、链接 next 之前的瞬间，Pop 可能短暂返回 false，
+// 调用方如果已知队列非空（例如信号量计数），重试即可。
+template<typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue() {
+        T drop;
+        while (Pop(drop)) {}
+        if (tail_ != &stub_) delete tail_;
+    }
+
+    void Push(T value) {
+        Node* node = new Node;
+        node->value = std::move(value);
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    bool Pop(T& out) {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next) return false;
+
+        // next 成为新的哑节点，值移出后释放旧哑节点
+        out = std::move(next->value);
+        next->value = T();
+        tail_ = next;
+        if (tail != &stub_) delete tail;
+        return true;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{ nullptr };
+        T value{};
+    };
+
+    alignas(64) std::atomic<Node*> head_; // 生产者端
+    alignas(64) Node* tail_;              // 消费者端
+    Node stub_;
+};
@@ -0,0 +1,272 @@
+﻿#include "order_batcher.h"
+#include <algorithm>
+
+OrderBatcher::~OrderBatcher() {
+    // 与 OrderExecutor 相同：析构处于 loader lock 下，只通知定时线程退出并 detach
+    Stop(std::chrono::milliseconds(0));
+}
+
+void OrderBatcher::Configure(const ProtobufHttpClient::Config& http, long window_ms, size_t max_batch, size_t groups) {
+    if (timer_thread_.joinable()) return;
+    http_ = http;
+    window_ms_ = window_ms;
+    if (max_batch > 0) max_batch_ = max_batch;
+    if (groups > 0) groups_ = groups;
+}
+
+size_t OrderBatcher::GroupOf(const std::string& stock_code) const {
+    return std::hash<std::string>{}(stock_code) % groups_;
+}
+
+std::string OrderBatcher::OrderingKey(const std::string& stock_code) const {
+    if (!Enabled()) return stock_code;
+    return std::string(kEndpoint) + "#" + std::to_string(GroupOf(stock_code));
+}
+
+void OrderBatcher::FlushGroup(const std::string& stock_code) {
+    if (!Enabled()) return;
+
+    std::lock_guard<std::mutex> send_lock(send_mutex_);
+    std::vector<Pending> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t group = GroupOf(stock_code);
+        auto split = std::stable_partition(pending_.begin(), pending_.end(),
+            [this, group](const Pending& item) { return GroupOf(item.order.stock_code()) != group; });
+        batch.assign(std::make_move_iterator(split), std::make_move_iterator(pending_.end()));
+        pending_.erase(split, pending_.end());
+    }
+    SendNow(std::move(batch));
+}
+
+void OrderBatcher::FlushAll(std::function<void()> then) {
+    if (!Enabled()) {
+        then();
+        return;
+    }
+
+    uint64_t last_sent = 0;
+    {
+        std::lock_guard<std::mutex> send_lock(send_mutex_);
+        std::vector<Pending> batch;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batch.swap(pending_);
+        }
+        SendNow(std::move(batch));
+        last_sent = next_batch_id_;
+    }
+
+    {
+        // 批次号递增，最小的未完成批次比 last_sent 大就说明不用再等
+        std::lock_guard<std::mutex> lock(barrier_mutex_);
+        if (!outstanding_.empty() && *outstanding_.begin() <= last_sent) {
+            barriers_.emplace_back(last_sent, std::move(then));
+            return;
+        }
+    }
+    then();
+}
+
+void OrderBatcher::SendNow(std::vector<Pending> batch) {
+    for (size_t begin = 0; begin < batch.size(); begin += max_batch_) {
+        size_t end = (std::min)(batch.size(), begin + max_batch_);
+        Send(std::vector<Pending>(std::make_move_iterator(batch.begin() + begin),
+            std::make_move_iterator(batch.begin() + end)));
+    }
+}
+
+void OrderBatcher::CompleteBatch(uint64_t batch_id) {
+    std::vector<std::function<void()>> ready;
+    {
+        std::lock_guard<std::mutex> lock(barrier_mutex_);
+        outstanding_.erase(batch_id);
+        uint64_t oldest = outstanding_.empty() ? UINT64_MAX : *outstanding_.begin();
+        auto split = std::stable_partition(barriers_.begin(), barriers_.end(),
+            [oldest](const auto& barrier) { return barrier.first >= oldest; });
+        for (auto it = split; it != barriers_.end(); ++it) ready.push_back(std::move(it->second));
+        barriers_.erase(split, barriers_.end());
+    }
+    for (auto& then : ready) {
+        try {
+            then();
+        }
+        catch (...) {
+            // 一个回调出错不能影响其他等待者
+        }
+    }
+}
+
+void OrderBatcher::EnsureStarted() {
+    std::call_once(start_flag_, [this]() {
+        timer_running_ = true;
+        timer_thread_ = std::thread(&OrderBatcher::TimerLoop, this);
+        });
+}
+
+bool OrderBatcher::Add(PlaceOrder order, Callback callback) {
+    if (!callback || !Enabled() || !accepting_.load(std::memory_order_acquire)) return false;
+    EnsureStarted();
+
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_.load(std::memory_order_acquire)) return false;
+        if (pending_.empty()) {
+            deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(window_ms_);
+            wake = true;
+        }
+        pending_.push_back(Pending{ std::move(order), std::move(callback) });
+        if (pending_.size() >= max_batch_) wake = true;
+    }
+    orders_.fetch_add(1, std::memory_order_relaxed);
+    if (wake) cv_.notify_one();
+    return true;
+}
+
+std::vector<OrderBatcher::Pending> OrderBatcher::TakeLocked() {
+    std::vector<Pending> batch;
+    if (pending_.size() <= max_batch_) {
+        batch.swap(pending_);
+    }
+    else {
+        batch.assign(std::make_move_iterator(pending_.begin()),
+            std::make_move_iterator(pending_.begin() + max_batch_));
+        pending_.erase(pending_.begin(), pending_.begin() + max_batch_);
+        // 剩下的已经等过一个窗口，下一轮立即发送
+        deadline_ = std::chrono::steady_clock::now();
+    }
+    return batch;
+}
+
+void OrderBatcher::TimerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return stopping_.load(std::memory_order_acquire) || !pending_.empty(); });
+        if (pending_.empty()) break;
+
+        // 窗口到期、攒满或停止时发送
+        cv_.wait_until(lock, deadline_, [this] {
+            return stopping_.load(std::memory_order_acquire) || pending_.size() >= max_batch_;
+            });
+
+        // 按 send_mutex_ -> mutex_ 的顺序加锁，与 FlushGroup 一致
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> send_lock(send_mutex_);
+            std::vector<Pending> batch;
+            {
+                std::lock_guard<std::mutex> take_lock(mutex_);
+                batch = TakeLocked();
+            }
+            Send(std::move(batch));
+        }
+        lock.lock();
+    }
+    timer_running_.store(false, std::memory_order_release);
+}
+
+void OrderBatcher::Send(std::vector<Pending> batch) {
+    if (batch.empty()) return;
+
+    // 组内保持提交顺序
+    std::vector<std::vector<Pending>> groups(groups_);
+    for (auto& item : batch) {
+        groups[GroupOf(item.order.stock_code())].push_back(std::move(item));
+    }
+    for (size_t group = 0; group < groups.size(); ++group) {
+        if (groups[group].empty()) continue;
+        SendGroup(std::move(groups[group]), std::string(kEndpoint) + "#" + std::to_string(group));
+    }
+}
+
+void OrderBatcher::SendGroup(std::vector<Pending> batch, const std::string& ordering_key) {
+    uint64_t batch_id = ++next_batch_id_;
+    PlaceOrderBatch request;
+    request.set_batch_id(std::to_string(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count())
+        + "-" + std::to_string(batch_id));
+
+    auto callbacks = std::make_shared<std::vector<Callback>>();
+    callbacks->reserve(batch.size());
+    for (auto& item : batch) {
+        *request.add_orders() = std::move(item.order);
+        callbacks->push_back(std::move(item.callback));
+    }
+
+    batches_.fetch_add(1, std::memory_order_relaxed);
+    size_t seen = max_batch_seen_.load(std::memory_order_relaxed);
+    while (batch.size() > seen && !max_batch_seen_.compare_exchange_weak(seen, batch.size(), std::memory_order_relaxed)) {}
+
+    {
+        std::lock_guard<std::mutex> lock(barrier_mutex_);
+        outstanding_.insert(batch_id);
+    }
+
+    auto split = [this, callbacks, batch_id](std::unique_ptr<PlaceOrderBatchResponse> response, const std::string& error,
+        ProtobufHttpClient::SendPhase phase) {
+        using SendPhase = ProtobufHttpClient::SendPhase;
+        std::string batch_error = error;
+        if (batch_error.empty() && response->results_size() == 0) {
+            batch_error = "Batch rejected: " + response->status();
+        }
+        if (!batch_error.empty()) {
+            failed_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        for (size_t i = 0; i < callbacks->size(); ++i) {
+            try {
+                if (!batch_error.empty()) {
+                    // 后端拒绝整批（有响应）时请求已经到达，按 MaybeSent 处理
+                    (*callbacks)[i](nullptr, batch_error, error.empty() ? SendPhase::MaybeSent : phase);
+                }
+                else if (i < (size_t)response->results_size()) {
+                    auto result = std::make_unique<PlaceOrderResponse>();
+                    result->Swap(response->mutable_results((int)i));
+                    (*callbacks)[i](std::move(result), "", SendPhase::MaybeSent);
+                }
+                else {
+                    (*callbacks)[i](nullptr, "Batch response missing result", SendPhase::MaybeSent);
+                }
+            }
+            catch (...) {
+                // 一笔回调出错不能影响同批其他委托
+            }
+        }
+        CompleteBatch(batch_id);
+    };
+
+    // 同一分组前一批完成才发下一批，排在这之后的同组撤单也要等它完成
+    ProtobufHttpClient client(http_);
+    client.async_post<PlaceOrderBatch, PlaceOrderBatchResponse>(kEndpoint, request, split, ordering_key);
+}
+
+void OrderBatcher::Drain(std::chrono::milliseconds timeout) {
+    accepting_.store(false, std::memory_order_release);
+    Stop(timeout);
+}
+
+void OrderBatcher::Stop(std::chrono::milliseconds grace) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_.exchange(true, std::memory_order_acq_rel)) return;
+    }
+    cv_.notify_one();
+
+    // 定时线程会先把剩余委托发出再退出；析构时处于 loader lock 下，不能 join
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (timer_running_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (timer_thread_.joinable()) timer_thread_.detach();
+}
+
+OrderBatcher::Stats OrderBatcher::GetStats() const {
+    Stats stats;
+    stats.orders = orders_.load(std::memory_order_relaxed);
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    stats.failed = failed_.load(std::memory_order_relaxed);
+    stats.max_batch_seen = max_batch_seen_.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,124 @@
+﻿#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "little_goal.pb.h"
+#include "protobuf_http_client.hpp"
+
+// 委托合批：同一根 K 线上股池批量进场时，把一个时间窗口内的 PlaceOrder 合成一个
+// PlaceOrderBatch 发到 /place_order/batch，再把 PlaceOrderBatchResponse.results 按顺序拆回各自的回调
+// 1. 第一笔委托进入时开窗，窗口到期或攒满 max_batch 立即发送
+// 2. 股票按代码散列到 groups 个分组，一个窗口里每个分组发一批，ordering_key 为 OrderingKey(分组)；
+//    同组的批次串行，不同组互不阻塞；同一只股票的撤单和逐笔委托也用 OrderingKey，不会越过它之前的委托
+// 3. 回调与 async_post 相同，在 OrderExecutor 线程上执行
+class OrderBatcher {
+public:
+    // 整批失败时每笔委托都收到批次的错误和 SendPhase
+    using Callback = std::function<void(std::unique_ptr<PlaceOrderResponse>, const std::string& /* error */,
+        ProtobufHttpClient::SendPhase)>;
+
+    static constexpr const char* kEndpoint = "/place_order/batch";
+
+    struct Stats {
+        uint64_t orders = 0;    // 进入合批的委托数
+        uint64_t batches = 0;   // 发出的批次数
+        uint64_t failed = 0;    // 整批失败的批次数
+        size_t max_batch_seen = 0;
+    };
+
+    OrderBatcher(const OrderBatcher&) = delete;
+    OrderBatcher& operator=(const OrderBatcher&) = delete;
+
+    static OrderBatcher& GetInstance() {
+        static OrderBatcher instance;
+        return instance;
+    }
+
+    // 必须在第一次 Add 之前调用；window_ms <= 0 表示不启用合批
+    void Configure(const ProtobufHttpClient::Config& http, long window_ms, size_t max_batch, size_t groups);
+
+    bool Enabled() const { return window_ms_ > 0; }
+
+    // 与这只股票的委托保持先后顺序所需的 ordering_key：未启用合批时就是股票代码，启用后为所在分组
+    std::string OrderingKey(const std::string& stock_code) const;
+
+    // 把这只股票所在分组还在窗口里的委托立即发出；返回后用 OrderingKey 提交的请求排在它们之后
+    void FlushGroup(const std::string& stock_code);
+
+    // 把全部分组还在窗口里的委托立即发出，等此前发出的批次（包括这次发出的）全部完成之后执行 then
+    // 用于撤全部：不同分组的 ordering_key 不同，撤单只排在一个分组后面，会越过其他分组的委托
+    // 没有未完成的批次时在调用线程上直接执行，否则在最后完成的那一批的回调线程（OrderExecutor）上执行；
+    // then 里不能再调用 FlushGroup / FlushAll
+    void FlushAll(std::function<void()> then);
+
+    // order.place_type 需要由调用方填好（amount / vol / percent）
+    // 已停止时返回 false，callback 不会被调用
+    bool Add(PlaceOrder order, Callback callback);
+
+    // 停止接收，把窗口里剩余的委托立即发出，然后停止定时线程；由 ShutdownRuntime 调用
+    void Drain(std::chrono::milliseconds timeout);
+
+    Stats GetStats() const;
+
+private:
+    OrderBatcher() = default;
+    ~OrderBatcher();
+
+    struct Pending {
+        PlaceOrder order;
+        Callback callback;
+    };
+
+    void EnsureStarted();
+    void TimerLoop();
+    // 取出最多 max_batch_ 笔委托，调用时必须持有 mutex_
+    std::vector<Pending> TakeLocked();
+    // 调用时必须持有 send_mutex_：按分组拆开，每组一个请求
+    void Send(std::vector<Pending> batch);
+    // 调用时必须持有 send_mutex_：提前发出的委托也按 max_batch 分批
+    void SendNow(std::vector<Pending> batch);
+    void SendGroup(std::vector<Pending> batch, const std::string& ordering_key);
+    // 批次完成（成功或失败）后调用，执行已经不用再等的 FlushAll 回调
+    void CompleteBatch(uint64_t batch_id);
+    size_t GroupOf(const std::string& stock_code) const;
+    void Stop(std::chrono::milliseconds grace);
+
+    ProtobufHttpClient::Config http_;
+    long window_ms_ = 0;
+    size_t max_batch_ = 32;
+    size_t groups_ = 8;
+
+    std::once_flag start_flag_;
+    std::thread timer_thread_;
+
+    // 从取出到提交给传输层之间持有，保证 FlushGroup 返回时窗口里同组的委托都已提交
+    std::mutex send_mutex_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Pending> pending_;
+    std::chrono::steady_clock::time_point deadline_;   // 当前窗口的发送时刻
+    uint64_t next_batch_id_ = 0;                       // 持有 send_mutex_ 时使用
+
+    // 已发出未完成的批次号，以及 FlushAll 登记的回调：编号不超过 first 的批次全部完成后执行
+    std::mutex barrier_mutex_;
+    std::set<uint64_t> outstanding_;
+    std::vector<std::pair<uint64_t, std::function<void()>>> barriers_;
+
+    std::atomic<bool> accepting_{ true };
+    std::atomic<bool> stopping_{ false };
+    std::atomic<bool> timer_running_{ false };
+
+    std::atomic<uint64_t> orders_{ 0 };
+    std::atomic<uint64_t> batches_{ 0 };
+    std::atomic<uint64_t> failed_{ 0 };
+    std::atomic<size_t> max_batch_seen_{ 0 };
+};
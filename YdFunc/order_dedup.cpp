@@ -0,0 +1,243 @@
+﻿#include "order_dedup.h"
+#include "LMDBClient.h"
+#include "write_combiner.h"
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::string kStorePrefix = "dedup:";
+
+uint64_t Fnv1a(uint64_t hash, const void* data, size_t size) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string StoreKey(uint64_t fingerprint) {
+    return std::format("{}{:016x}", kStorePrefix, fingerprint);
+}
+
+// 整表操作（清表、重排）持有全部分段锁，按下标顺序加锁
+template <size_t N>
+std::array<std::unique_lock<std::mutex>, N> LockAll(std::array<std::mutex, N>& stripes) {
+    std::array<std::unique_lock<std::mutex>, N> locks;
+    for (size_t i = 0; i < N; ++i) locks[i] = std::unique_lock<std::mutex>(stripes[i]);
+    return locks;
+}
+
+} // namespace
+
+void OrderDedup::Configure(bool enabled, size_t slots, LMDBClient* store, WriteCombiner* writes) {
+    if (slots_) return;
+    enabled_ = enabled;
+    size_t size = 1024;
+    while (size < slots && size < (size_t(1) << 24)) size <<= 1;
+    mask_ = size - 1;
+    store_ = store;
+    writes_ = store ? writes : nullptr;
+}
+
+void OrderDedup::EnsureTable() {
+    std::call_once(table_flag_, [this]() {
+        if (mask_ == 0) mask_ = 65536 - 1;
+        slots_.reset(new std::atomic<uint64_t>[mask_ + 1]);
+        for (size_t i = 0; i <= mask_; ++i) slots_[i].store(kEmpty, std::memory_order_relaxed);
+        });
+}
+
+uint64_t OrderDedup::Fingerprint(const Key& key) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = Fnv1a(hash, key.stock_code.data(), key.stock_code.size());
+    hash = Fnv1a(hash, &key.data_type, sizeof(key.data_type));
+    hash = Fnv1a(hash, &key.bar_time, sizeof(key.bar_time));
+    hash = Fnv1a(hash, &key.order_type, sizeof(key.order_type));
+    hash = Fnv1a(hash, &key.price, sizeof(key.price));
+    hash = Fnv1a(hash, &key.how_many, sizeof(key.how_many));
+
+    // 末尾再混合一次，低位用作槽位下标
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return hash <= kTombstone ? hash + 2 : hash;
+}
+
+bool OrderDedup::Contains(uint64_t fingerprint) const {
+    size_t index = static_cast<size_t>(fingerprint) & mask_;
+    for (size_t probe = 0; probe < kMaxProbe; ++probe, index = (index + 1) & mask_) {
+        uint64_t current = slots_[index].load(std::memory_order_acquire);
+        if (current == fingerprint) return true;
+        if (current == kEmpty) return false;
+    }
+    return false;
+}
+
+bool OrderDedup::Insert(uint64_t fingerprint, bool* full) {
+    *full = false;
+    for (;;) {
+        // 探测到空槽为止：指纹已在链上则重复，否则写入遇到的第一个墓碑（没有墓碑才用空槽）
+        size_t target = SIZE_MAX;
+        uint64_t expected = kEmpty;
+        size_t index = static_cast<size_t>(fingerprint) & mask_;
+        for (size_t probe = 0; probe < kMaxProbe; ++probe, index = (index + 1) & mask_) {
+            uint64_t current = slots_[index].load(std::memory_order_acquire);
+            if (current == fingerprint) return false;
+            if (current == kTombstone && target == SIZE_MAX) {
+                target = index;
+                expected = kTombstone;
+            }
+            if (current == kEmpty) {
+                if (target == SIZE_MAX) target = index;
+                break;
+            }
+        }
+        if (target == SIZE_MAX) {
+            *full = true;
+            return false;
+        }
+
+        // 同一指纹的登记由分段锁串行化；CAS 失败说明槽位被起始槽位不同的其他指纹占了，重新探测
+        if (slots_[target].compare_exchange_strong(expected, fingerprint, std::memory_order_acq_rel)) {
+            if (expected == kTombstone) tombstones_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+bool OrderDedup::TryClaim(uint64_t fingerprint, int trade_date) {
+    if (!enabled_) return true;
+    EnsureTable();
+
+    // 只有交易日前进才清表；回算历史 K 线时日期更早，直接用当前表
+    if (trade_date > trade_date_.load(std::memory_order_acquire)) {
+        AdvanceDay(trade_date);
+    }
+
+    // 重复是常态（同一根 K 线反复计算），先不加锁查一遍
+    if (Contains(fingerprint)) {
+        duplicates_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool inserted = false;
+    bool full = false;
+    {
+        std::lock_guard<std::mutex> lock(StripeFor(fingerprint));
+        inserted = Insert(fingerprint, &full);
+    }
+    if (!inserted) {
+        if (full) {
+            // 宁可漏判重复也不能吞掉真实委托
+            overflow_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        duplicates_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    claimed_.fetch_add(1, std::memory_order_relaxed);
+
+    if (writes_) {
+        writes_->Put(StoreKey(fingerprint), LMDBClient::IntToBytes(trade_date_.load(std::memory_order_relaxed)));
+    }
+    return true;
+}
+
+void OrderDedup::Release(uint64_t fingerprint) {
+    if (!enabled_ || !slots_) return;
+
+    bool released = false;
+    {
+        std::lock_guard<std::mutex> lock(StripeFor(fingerprint));
+        size_t index = static_cast<size_t>(fingerprint) & mask_;
+        for (size_t probe = 0; probe < kMaxProbe; ++probe, index = (index + 1) & mask_) {
+            uint64_t current = slots_[index].load(std::memory_order_acquire);
+            if (current == kEmpty) break;
+            if (current != fingerprint) continue;
+
+            // 不能直接置空，否则会切断后面槽位的探测链
+            released = slots_[index].compare_exchange_strong(current, kTombstone, std::memory_order_acq_rel);
+            break;
+        }
+    }
+    if (!released) return;
+
+    released_.fetch_add(1, std::memory_order_relaxed);
+    tombstones_.fetch_add(1, std::memory_order_relaxed);
+    if (writes_) writes_->Delete(StoreKey(fingerprint));
+    MaybeRehash();
+}
+
+void OrderDedup::MaybeRehash() {
+    if (tombstones_.load(std::memory_order_relaxed) <= (mask_ + 1) / 4) return;
+    std::unique_lock<std::mutex> rehash_lock(rehash_mutex_, std::try_to_lock);
+    if (!rehash_lock.owns_lock()) return;
+
+    auto locks = LockAll(stripes_);
+    if (tombstones_.load(std::memory_order_relaxed) <= (mask_ + 1) / 4) return;
+
+    // 取出仍然有效的指纹，清表后重新插入；没有并发写，Insert 不会失败
+    std::vector<uint64_t> live;
+    for (size_t i = 0; i <= mask_; ++i) {
+        uint64_t current = slots_[i].load(std::memory_order_relaxed);
+        if (current > kTombstone) live.push_back(current);
+        slots_[i].store(kEmpty, std::memory_order_relaxed);
+    }
+    tombstones_.store(0, std::memory_order_relaxed);
+    for (uint64_t fingerprint : live) {
+        bool full = false;
+        Insert(fingerprint, &full);
+    }
+    rehashes_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void OrderDedup::AdvanceDay(int trade_date) {
+    std::lock_guard<std::mutex> lock(day_mutex_);
+    int previous = trade_date_.load(std::memory_order_acquire);
+    if (trade_date <= previous) return;
+
+    auto locks = LockAll(stripes_);
+    for (size_t i = 0; i <= mask_; ++i) slots_[i].store(kEmpty, std::memory_order_relaxed);
+    tombstones_.store(0, std::memory_order_relaxed);
+
+    if (store_) {
+        // 当日的指纹载入表中，往日的从库里删掉；在一个快照上遍历，只为要删的 key 分配字符串
+        // 还在 writes_ 队列里的登记不在快照中：它们属于往日，下次换日时再删
+        std::vector<std::string> stale;
+        {
+            LMDBClient::ReadScope scope(*store_);
+            for (const auto& [suffix, value] : scope.Prefix(kStorePrefix)) {
+                int date = 0;
+                uint64_t fingerprint = 0;
+                const char* end = suffix.data() + suffix.size();
+                auto parsed = std::from_chars(suffix.data(), end, fingerprint, 16);
+                bool valid = value.size() == sizeof(int) && parsed.ec == std::errc() && parsed.ptr == end;
+                if (valid) std::memcpy(&date, value.data(), sizeof(int));
+                if (!valid || date != trade_date) {
+                    stale.push_back(kStorePrefix + std::string(suffix));
+                    continue;
+                }
+                bool full = false;
+                Insert(fingerprint, &full);
+            }
+        }
+        for (const std::string& key : stale) writes_->Delete(key);
+    }
+
+    trade_date_.store(trade_date, std::memory_order_release);
+}
+
+OrderDedup::Stats OrderDedup::GetStats() const {
+    Stats stats;
+    stats.claimed = claimed_.load(std::memory_order_relaxed);
+    stats.duplicates = duplicates_.load(std::memory_order_relaxed);
+    stats.released = released_.load(std::memory_order_relaxed);
+    stats.overflow = overflow_.load(std::memory_order_relaxed);
+    stats.rehashes = rehashes_.load(std::memory_order_relaxed);
+    return stats;
+}
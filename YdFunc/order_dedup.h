@@ -0,0 +1,103 @@
+﻿#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+class LMDBClient;
+class WriteCombiner;
+
+// AUTO_TRADE 的 K 线级委托去重
+// 盘中逐笔刷新时同一根 K 线上的公式会被反复计算，同样的委托只应发送一次
+// 1. 指纹 = (股票, 周期, K 线时间, 委托类型, 价格, 数量) 的 64 位哈希
+// 2. 开放寻址表，槽位只做 CAS；查重不加锁，登记和撤销按指纹的起始槽位分段加锁（同一指纹不会登记两份）
+// 3. 交易日切换时清表；可选把当日指纹经 WriteCombiner 写入 LMDB，DLL 重新加载后仍然生效
+// 4. 委托在传输层失败（未送达后端）时撤销登记，下一次计算可以重发；
+//    撤销留下的墓碑在登记时复用，超过表的 1/4 时整表重排
+class OrderDedup {
+public:
+    struct Key {
+        std::string_view stock_code;
+        uint32_t data_type = 0;     // (m_baseType << 16) | m_nUnit
+        uint32_t bar_time = 0;      // 当前 K 线（或分笔）时间
+        int order_type = 0;
+        double price = 0;
+        int how_many = 0;
+    };
+
+    struct Stats {
+        uint64_t claimed = 0;       // 首次出现并放行的
+        uint64_t duplicates = 0;    // 被拦下的重复委托
+        uint64_t released = 0;      // 发送失败后撤销的
+        uint64_t overflow = 0;      // 表满未能登记（放行但不去重）
+        uint64_t rehashes = 0;      // 墓碑过多而整表重排的次数
+    };
+
+    OrderDedup(const OrderDedup&) = delete;
+    OrderDedup& operator=(const OrderDedup&) = delete;
+
+    static OrderDedup& GetInstance() {
+        static OrderDedup instance;
+        return instance;
+    }
+
+    // 必须在第一次 TryClaim 之前调用
+    // slots 向上取 2 的幂；store 非空时把指纹持久化到 LMDB（调用方负责 Initialize）：
+    // 交易日切换时从 store 载入，登记和撤销经 writes 合并提交（writes 必须配置在同一个库上）
+    void Configure(bool enabled, size_t slots, LMDBClient* store, WriteCombiner* writes);
+
+    bool Enabled() const { return enabled_; }
+
+    static uint64_t Fingerprint(const Key& key);
+
+    // trade_date 为 K 线所属交易日 YYYYMMDD
+    // 返回 true 表示第一次出现，调用方继续发送；false 表示重复，应直接丢弃
+    bool TryClaim(uint64_t fingerprint, int trade_date);
+
+    // 撤销登记，之后同样的指纹可以再次 TryClaim
+    void Release(uint64_t fingerprint);
+
+    Stats GetStats() const;
+
+private:
+    OrderDedup() = default;
+
+    static constexpr uint64_t kEmpty = 0;
+    static constexpr uint64_t kTombstone = 1;   // 撤销后的槽位，查找时继续向后探测
+    static constexpr size_t kMaxProbe = 64;
+    static constexpr size_t kStripes = 64;
+
+    void EnsureTable();
+    // 交易日前进时清表并从 LMDB 载入当日指纹
+    void AdvanceDay(int trade_date);
+    // 只查不改，不加锁
+    bool Contains(uint64_t fingerprint) const;
+    // 返回 true 表示新登记，false 表示已存在；表满时 *full = true；调用方持有该指纹的分段锁
+    bool Insert(uint64_t fingerprint, bool* full);
+    // 墓碑超过阈值时重排；持有全部分段锁，期间不加锁的查重可能漏判，漏判的会在登记时再查一次
+    void MaybeRehash();
+    std::mutex& StripeFor(uint64_t fingerprint) { return stripes_[(static_cast<size_t>(fingerprint) & mask_) % kStripes]; }
+
+    bool enabled_ = false;
+    size_t mask_ = 0;
+    LMDBClient* store_ = nullptr;
+    WriteCombiner* writes_ = nullptr;
+
+    std::once_flag table_flag_;
+    std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+    std::atomic<int> trade_date_{ 0 };
+    std::mutex day_mutex_;
+    std::array<std::mutex, kStripes> stripes_;
+    std::atomic<size_t> tombstones_{ 0 };
+    std::mutex rehash_mutex_;
+
+    std::atomic<uint64_t> claimed_{ 0 };
+    std::atomic<uint64_t> duplicates_{ 0 };
+    std::atomic<uint64_t> released_{ 0 };
+    std::atomic<uint64_t> overflow_{ 0 };
+    std::atomic<uint64_t> rehashes_{ 0 };
+};
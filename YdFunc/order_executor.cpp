@@ -0,0 +1,124 @@
+﻿#include "order_executor.h"
+
+OrderExecutor::~OrderExecutor() {
+    // 析构发生在 DLL 卸载 / 进程退出阶段（持有 loader lock），不能 join，只通知并 detach
+    // 进程退出时 worker 已被系统终止，不再等待
+    StopWorkers(std::chrono::milliseconds(0));
+}
+
+void OrderExecutor::Configure(size_t workers, size_t capacity) {
+    if (!workers_.empty()) return;
+    if (workers > 0) worker_count_ = workers;
+    if (capacity > 0) capacity_ = capacity;
+}
+
+void OrderExecutor::EnsureStarted() {
+    std::call_once(start_flag_, [this]() {
+        workers_.reserve(worker_count_);
+        for (size_t i = 0; i < worker_count_; ++i) {
+            workers_.push_back(std::make_unique<Worker>());
+        }
+        running_workers_ = worker_count_;
+        for (auto& worker : workers_) {
+            worker->thread = std::thread(&OrderExecutor::WorkerLoop, this, worker.get());
+        }
+        });
+}
+
+bool OrderExecutor::Submit(const std::string& key, Task task) {
+    if (!task || !accepting_.load(std::memory_order_acquire)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    EnsureStarted();
+
+    // 先占位再入队，保证排队总数不超过上限
+    size_t depth = depth_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (depth > capacity_) {
+        depth_.fetch_sub(1, std::memory_order_acq_rel);
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    size_t peak = peak_depth_.load(std::memory_order_relaxed);
+    while (depth > peak && !peak_depth_.compare_exchange_weak(peak, depth, std::memory_order_relaxed)) {}
+
+    size_t index = key.empty()
+        ? round_robin_.fetch_add(1, std::memory_order_relaxed) % workers_.size()
+        : std::hash<std::string>{}(key) % workers_.size();
+
+    Worker* worker = workers_[index].get();
+    worker->queue.Push(std::move(task));
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+    worker->signal.release();
+    return true;
+}
+
+void OrderExecutor::WorkerLoop(Worker* worker) {
+    while (true) {
+        worker->signal.acquire();
+
+        Task task;
+        bool got = worker->queue.Pop(task);
+        while (!got && !stopping_.load(std::memory_order_acquire)) {
+            // 生产者已计数但还没链接完节点，稍等即可
+            std::this_thread::yield();
+            got = worker->queue.Pop(task);
+        }
+        if (!got) break;
+
+        try {
+            task();
+        }
+        catch (...) {
+            // 回调异常不能杀掉 worker
+        }
+        completed_.fetch_add(1, std::memory_order_relaxed);
+        depth_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    running_workers_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool OrderExecutor::Drain(std::chrono::milliseconds timeout) {
+    accepting_.store(false, std::memory_order_release);
+    if (workers_.empty()) return true;
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (depth_.load(std::memory_order_acquire) > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    bool drained = depth_.load(std::memory_order_acquire) == 0;
+
+    StopWorkers(std::chrono::milliseconds(200));
+    return drained;
+}
+
+void OrderExecutor::StopWorkers(std::chrono::milliseconds grace) {
+    if (stopping_.exchange(true, std::memory_order_acq_rel)) return;
+
+    for (auto& worker : workers_) {
+        worker->signal.release();
+    }
+
+    // 给 worker 一点时间退出循环；析构时处于 loader lock 下，不能 join
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (running_workers_.load(std::memory_order_acquire) > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) worker->thread.detach();
+    }
+}
+
+OrderExecutor::Stats OrderExecutor::GetStats() const {
+    Stats stats;
+    stats.workers = workers_.size();
+    stats.capacity = capacity_;
+    stats.depth = depth_.load(std::memory_order_relaxed);
+    stats.peak_depth = peak_depth_.load(std::memory_order_relaxed);
+    stats.submitted = submitted_.load(std::memory_order_relaxed);
+    stats.completed = completed_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    return stats;
+}
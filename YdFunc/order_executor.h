@@ -0,0 +1,85 @@
+﻿#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <vector>
+#include "mpsc_queue.h"
+
+// 固定线程数的异步执行器，替代 async_post 每单一个 detach 线程的做法
+// 1. 每个 worker 一条无锁 MPSC 队列，按 key 哈希分配，同一只股票的请求保持先后顺序
+// 2. 全局排队上限，超过直接拒绝，股池同一根 K 线全部触发时不会产生线程爆炸
+// 3. 关闭时（ShutdownRuntime）先停止接收，再在超时内把队列里的请求执行完
+class OrderExecutor {
+public:
+    using Task = std::function<void()>;
+
+    struct Stats {
+        size_t workers = 0;
+        size_t capacity = 0;
+        size_t depth = 0;       // 当前排队 + 执行中
+        size_t peak_depth = 0;  // 历史最高
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        uint64_t rejected = 0;
+    };
+
+    OrderExecutor(const OrderExecutor&) = delete;
+    OrderExecutor& operator=(const OrderExecutor&) = delete;
+
+    static OrderExecutor& GetInstance() {
+        static OrderExecutor instance;
+        return instance;
+    }
+
+    // 必须在第一次 Submit 之前调用，启动后再调用无效
+    void Configure(size_t workers, size_t capacity);
+
+    // key 相同的任务在同一个 worker 上按提交顺序执行，key 为空时轮询分配
+    // 队列已满或已停止时返回 false，任务不会执行
+    bool Submit(const std::string& key, Task task);
+
+    // 停止接收新任务，等待已提交的任务执行完毕（最多 timeout）
+    // 返回 true 表示队列已排空；由 ShutdownRuntime 调用
+    bool Drain(std::chrono::milliseconds timeout);
+
+    Stats GetStats() const;
+
+private:
+    OrderExecutor() = default;
+    ~OrderExecutor();
+
+    struct Worker {
+        MpscQueue<Task> queue;
+        std::counting_semaphore<> signal{ 0 };
+        std::thread thread;
+    };
+
+    void EnsureStarted();
+    void WorkerLoop(Worker* worker);
+    void StopWorkers(std::chrono::milliseconds grace);
+
+    size_t worker_count_ = 4;
+    size_t capacity_ = 4096;
+
+    std::once_flag start_flag_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::atomic<bool> accepting_{ true };
+    std::atomic<bool> stopping_{ false };
+    std::atomic<size_t> running_workers_{ 0 };
+    std::atomic<size_t> round_robin_{ 0 };
+
+    std::atomic<size_t> depth_{ 0 };
+    std::atomic<size_t> peak_depth_{ 0 };
+    std::atomic<uint64_t> submitted_{ 0 };
+    std::atomic<uint64_t> completed_{ 0 };
+    std::atomic<uint64_t> rejected_{ 0 };
+};
@@ -1,24 +1,38 @@
 #include "protobuf_http_client.hpp"
-#include <curl/curl.h>
 #include <sstream>
 #include <iostream>
+#include <future>
 #include "little_goal.pb.h"
+#include "curl_multi_engine.h"
+#include "shm_transport.h"
 
 class ProtobufHttpClient::Impl {
 public:
-    Impl(const Config& config) : config_(config) {
-        curl_ = curl_easy_init();
-        if (!curl_) {
-            throw Exception("CURL initialization failed");
-        }
+    Impl(const Config& config)
+        : config_(config), transport_(SelectTransport(config.transport)) {
     }
 
-    ~Impl() {
-        if (curl_) {
-            curl_easy_cleanup(curl_);
+    MessageTransport::Request buildRequest(const std::string& method,
+        const std::string& endpoint,
+        std::string body,
+        const std::string& ordering_key) const
+    {
+        MessageTransport::Request req;
+        req.method = method;
+        req.url = config_.base_url + endpoint;
+        req.endpoint = endpoint;
+        req.body = std::move(body);
+        req.ca_cert_path = config_.ca_cert_path;
+        if (config_.transport == "unix") {
+            req.unix_socket_path = config_.unix_socket_path;
         }
+        req.ordering_key = ordering_key;
+        req.timeout_ms = config_.timeout_ms;
+        return req;
     }
 
+    MessageTransport& transport() const { return transport_; }
+
     template<typename RequestType, typename ResponseType>
     bool performRequest(const std::string& method,
         const std::string& endpoint,
@@ -26,27 +40,11 @@ public:
         ResponseType& response);
 
 private:
-    static size_t writeCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-        auto* buffer = static_cast<std::string*>(userp);
-        buffer->append(static_cast<char*>(contents), size * nmemb);
-        return size * nmemb;
-    }
-
-    void setupCurlCommon() {
-        curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, &Impl::writeCallback);
-        curl_easy_setopt(curl_, CURLOPT_TIMEOUT_MS, config_.timeout_ms);
-        curl_easy_setopt(curl_, CURLOPT_FOLLOWLOCATION, 1L);
-
-        if (!config_.ca_cert_path.empty()) {
-            curl_easy_setopt(curl_, CURLOPT_CAINFO, config_.ca_cert_path.c_str());
-        }
-        // CURLͨ...
-    }
-
     Config config_;
-    CURL* curl_;
+    MessageTransport& transport_;
 };
 
+// 同步请求也走传输层的 I/O 线程，调用方只在 future 上等待到期限，不占用连接
 template<typename RequestType, typename ResponseType>
 bool ProtobufHttpClient::Impl::performRequest(
     const std::string& method,
@@ -54,52 +52,86 @@ bool ProtobufHttpClient::Impl::performRequest(
     const RequestType& request,
     ResponseType& response)
 {
-    curl_easy_reset(curl_);
-    setupCurlCommon();
-
-    std::string url = config_.base_url + endpoint;
-    curl_easy_setopt(curl_, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl_, CURLOPT_CUSTOMREQUEST, method.c_str());
+    LatencyMetrics& metrics = LatencyMetrics::GetInstance();
+    int key_id = metrics.KeyId(endpoint);
 
+    auto serialize_start = std::chrono::steady_clock::now();
     std::string request_data;
     if (!request.SerializeToString(&request_data)) {
-        throw Exception("Protobuf serialization failed");
+        throw Exception(kSerializationError);
     }
-
-    if (method != "GET") {
-        curl_easy_setopt(curl_, CURLOPT_POSTFIELDS, request_data.data());
-        curl_easy_setopt(curl_, CURLOPT_POSTFIELDSIZE, request_data.size());
+    metrics.Record(key_id, LatencyStage::Serialize, std::chrono::steady_clock::now() - serialize_start);
+
+    auto promise = std::make_shared<std::promise<MessageTransport::Result>>();
+    auto future = promise->get_future();
+
+    bool submitted = transport_.Submit(
+        buildRequest(method, endpoint, std::move(request_data), ""),
+        [promise](MessageTransport::Result& result) {
+            promise->set_value(std::move(result));
+        });
+    if (!submitted) {
+        throw Exception(kQueueRejectedError);
     }
 
-    struct curl_slist* headers = nullptr;
-    headers = curl_slist_append(headers, "Content-Type: application/protobuf");
-    headers = curl_slist_append(headers, "Accept: application/protobuf");
-    curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, headers);
-
-    std::string response_data;
-    curl_easy_setopt(curl_, CURLOPT_WRITEDATA, &response_data);
-
-    CURLcode res = curl_easy_perform(curl_);
-    curl_slist_free_all(headers);
-
-    if (res != CURLE_OK) {
-        throw Exception(curl_easy_strerror(res));
+    // curl 自身按 timeout_ms 超时，这里多留一点余量作为兜底期限
+    auto deadline = std::chrono::milliseconds(config_.timeout_ms + 500);
+    if (future.wait_for(deadline) != std::future_status::ready) {
+        throw Exception("Request deadline exceeded");
     }
 
-    long http_code = 0;
-    curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &http_code);
-    if (http_code < 200 || http_code >= 300) {
-        throw Exception("HTTP error: " + std::to_string(http_code));
+    MessageTransport::Result result = future.get();
+    recordTransportTimings(key_id, result);
+    std::string error = checkResult(result);
+    if (!error.empty()) {
+        throw Exception(error);
     }
 
-    if (!response.ParseFromString(response_data)) {
+    auto parse_start = std::chrono::steady_clock::now();
+    if (!response.ParseFromString(result.body)) {
         throw Exception("Failed to parse response");
     }
+    metrics.Record(key_id, LatencyStage::Parse, std::chrono::steady_clock::now() - parse_start);
 
     return true;
 }
 
-// ProtobufHttpClientԱʵ
+MessageTransport& ProtobufHttpClient::SelectTransport(const std::string& name) {
+    if (name == "shm") return ShmTransport::GetInstance();
+    // unix 与 tcp 共用 curl 引擎，区别只在每个请求的 unix_socket_path
+    return CurlMultiEngine::GetInstance();
+}
+
+std::string ProtobufHttpClient::checkResult(const MessageTransport::Result& result) {
+    if (!result.ok) {
+        return result.error;
+    }
+    if (result.http_code < 200 || result.http_code >= 300) {
+        return "HTTP error: " + std::to_string(result.http_code);
+    }
+    return "";
+}
+
+void ProtobufHttpClient::recordTransportTimings(int key_id, const MessageTransport::Result& result) {
+    if (!result.ok) return;
+    LatencyMetrics& metrics = LatencyMetrics::GetInstance();
+    metrics.RecordMicros(key_id, LatencyStage::Queue, result.queue_us);
+    metrics.RecordMicros(key_id, LatencyStage::Connect, result.connect_us);
+    metrics.RecordMicros(key_id, LatencyStage::FirstByte, result.first_byte_us);
+}
+
+bool ProtobufHttpClient::submitAsync(const std::string& method,
+    const std::string& endpoint,
+    std::string body,
+    const std::string& ordering_key,
+    MessageTransport::Completion done)
+{
+    return impl_->transport().Submit(
+        impl_->buildRequest(method, endpoint, std::move(body), ordering_key),
+        std::move(done));
+}
+
+// ProtobufHttpClient成员函数实现
 //ProtobufHttpClient::ProtobufHttpClient(const Config& config)
 //    : impl_(std::make_unique<Impl>(config)) {
 //}
@@ -146,7 +178,7 @@ bool ProtobufHttpClient::performRequest(
     }
 }
 
-// ʽʵ
+// 显式实例化定义
 template bool ProtobufHttpClient::performRequest<google::protobuf::Empty, AccountInfoResponse>(
     const std::string&, const std::string&, const google::protobuf::Empty&, AccountInfoResponse&);
 
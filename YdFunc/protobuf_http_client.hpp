@@ -6,15 +6,16 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/empty.pb.h>
 #include "little_goal.pb.h"
-#include <thread> 
-#include <functional>
+#include "latency_metrics.h"
+#include "message_transport.h"
+#include "order_executor.h"
 
-// ǰʹõϢ
+// 前置声明使用的消息类型
 class AccountInfoResponse;
 class PositionsResponse;
 class PlaceOrder;
 class PlaceOrderResponse;
-// ҪϢǰ...
+// 添加其他需要的消息类型前置声明...
 
 class ProtobufHttpClient {
 public:
@@ -23,6 +24,13 @@ public:
         using std::runtime_error::runtime_error;
     };
 
+    // 未完成请求超过上限或引擎已停止时的错误信息
+    static constexpr const char* kQueueRejectedError = "Request queue full or engine stopped";
+    static constexpr const char* kSerializationError = "Protobuf serialization failed";
+
+    // 异步回调出错时请求走到了哪一步：NotSent 表示请求确定没有离开本进程，可以放心重发
+    using SendPhase = MessageTransport::SendPhase;
+
     struct Config {
         std::string base_url;
         std::string ca_cert_path;
@@ -30,10 +38,15 @@ public:
         std::string client_key_path;
         long timeout_ms = 5000;
         bool verify_ssl = true;
+        std::string transport = "tcp";      // tcp / unix / shm，见 message_transport.h
+        std::string unix_socket_path;       // transport = unix 时使用
     };
 
+    // 按名字取传输层实例，未知名字按 tcp 处理
+    static MessageTransport& SelectTransport(const std::string& name);
+
     template <typename ResponseType>
-    using AsyncCallback = std::function<void(std::unique_ptr<ResponseType>, const std::string& /* error */)>;
+    using AsyncCallback = std::function<void(std::unique_ptr<ResponseType>, const std::string& /* error */, SendPhase)>;
     explicit ProtobufHttpClient(const Config& config);
 
 
@@ -42,57 +55,83 @@ public:
     ProtobufHttpClient(const ProtobufHttpClient&) = delete;
     ProtobufHttpClient& operator=(const ProtobufHttpClient&) = delete;
 
-    // GET
+    // GET请求
     template<typename ResponseType>
     std::unique_ptr<ResponseType> get(const std::string& endpoint);
 
-    // POST
+    // POST请求
     template<typename RequestType, typename ResponseType>
     std::unique_ptr<ResponseType> post(const std::string& endpoint,
         const RequestType& request);
 
+    // 异步POST：请求交给传输层的 I/O 线程多路复用发送，
+    // 响应解析和用户回调转到 OrderExecutor 执行，慢回调不会拖住其他请求
+    // ordering_key 相同的请求按提交顺序发送、按顺序回调（例如同一只股票），为空时不限制
     template <typename RequestType, typename ResponseType>
     void async_post(const std::string& endpoint,
         const RequestType& request,
-        AsyncCallback<ResponseType> callback)
+        AsyncCallback<ResponseType> callback,
+        const std::string& ordering_key = "")
     {
-        // ݺãȷ̰߳ȫ
-        RequestType request_copy = request;
-        Config config_copy = config_;
-
-        // ̴߳
-        std::thread([endpoint,
-            request = std::move(request_copy),
-            callback = std::move(callback),
-            config_copy]() mutable
-            {
+        // 各阶段耗时按 endpoint 统计，Total 从调用方所在导出函数的入口算起
+        LatencyMetrics& metrics = LatencyMetrics::GetInstance();
+        int key_id = metrics.KeyId(endpoint);
+        auto export_start = LatencyMetrics::CurrentExportStart();
+
+        auto serialize_start = std::chrono::steady_clock::now();
+        std::string body;
+        if (!request.SerializeToString(&body)) {
+            callback(nullptr, kSerializationError, SendPhase::NotSent);
+            return;
+        }
+        metrics.Record(key_id, LatencyStage::Serialize, std::chrono::steady_clock::now() - serialize_start);
+
+        auto on_done = [callback, ordering_key, key_id, export_start](MessageTransport::Result& result) {
+            recordTransportTimings(key_id, result);
+            auto deliver = [callback, key_id, export_start, result = std::move(result)]() {
                 try {
-                    // ʱͻˣʹøƵã̰߳ȫ
-                    ProtobufHttpClient temp_client(config_copy);
+                    std::string error = checkResult(result);
+                    if (!error.empty()) {
+                        callback(nullptr, error, result.ok ? SendPhase::MaybeSent : result.phase);
+                        return;
+                    }
+                    LatencyMetrics& metrics = LatencyMetrics::GetInstance();
+                    auto parse_start = std::chrono::steady_clock::now();
+                    auto response = std::make_unique<ResponseType>();
+                    if (!response->ParseFromString(result.body)) {
+                        callback(nullptr, "Failed to parse response", SendPhase::MaybeSent);
+                        return;
+                    }
+                    auto callback_start = std::chrono::steady_clock::now();
+                    metrics.Record(key_id, LatencyStage::Parse, callback_start - parse_start);
 
-                    // ͬPOST
-                    auto response = temp_client.post<RequestType, ResponseType>(endpoint, request);
+                    callback(std::move(response), "", SendPhase::MaybeSent);
 
-                    if (response) {
-                        callback(std::move(response), "");
+                    auto callback_end = std::chrono::steady_clock::now();
+                    metrics.Record(key_id, LatencyStage::Callback, callback_end - callback_start);
+                    if (export_start != std::chrono::steady_clock::time_point{}) {
+                        metrics.Record(key_id, LatencyStage::Total, callback_end - export_start);
                     }
-                    else {
-                        callback(nullptr, "POST request failed: server returned error");
-                    }
-                }
-                catch (const Exception& e) {
-                    callback(nullptr, std::string("Exception: ") + e.what());
                 }
                 catch (const std::exception& e) {
-                    callback(nullptr, std::string("Std exception: ") + e.what());
+                    callback(nullptr, std::string("Std exception: ") + e.what(), SendPhase::MaybeSent);
                 }
                 catch (...) {
-                    callback(nullptr, "Unknown error in POST request");
+                    callback(nullptr, "Unknown error in POST request", SendPhase::MaybeSent);
                 }
-            }).detach();  // ̣߳ڶ
+            };
+            // 执行器满了就退回到 I/O 线程上直接回调
+            if (!OrderExecutor::GetInstance().Submit(ordering_key, deliver)) {
+                deliver();
+            }
+        };
+
+        if (!submitAsync("POST", endpoint, std::move(body), ordering_key, std::move(on_done))) {
+            callback(nullptr, kQueueRejectedError, SendPhase::NotSent);
+        }
     }
 
-    // ײ󷽷
+    // 底层请求方法
     template<typename RequestType, typename ResponseType>
     bool performRequest(const std::string& method,
         const std::string& endpoint,
@@ -100,16 +139,28 @@ public:
         ResponseType& response);
 
     template<typename T>
-    using AsyncCallback = std::function<void(std::unique_ptr<T>, const std::string&)>;
+    using AsyncCallback = std::function<void(std::unique_ptr<T>, const std::string&, SendPhase)>;
+
 
+    // 传输失败或非 2xx 时返回错误信息，成功返回空串
+    static std::string checkResult(const MessageTransport::Result& result);
+
+    // 把传输层带回的 queue / connect / first byte 耗时记入 endpoint 对应的直方图
+    static void recordTransportTimings(int key_id, const MessageTransport::Result& result);
 
 private:
+    bool submitAsync(const std::string& method,
+        const std::string& endpoint,
+        std::string body,
+        const std::string& ordering_key,
+        MessageTransport::Completion done);
+
     class Impl;
     std::unique_ptr<Impl> impl_;
     Config config_;
 };
 
-// ʽʵ
+// 显式实例化声明
 extern template bool ProtobufHttpClient::performRequest<google::protobuf::Empty, AccountInfoResponse>(
     const std::string&, const std::string&, const google::protobuf::Empty&, AccountInfoResponse&);
 
@@ -131,7 +182,7 @@ extern template bool ProtobufHttpClient::performRequest<Entrusts, TodayEntrustsV
 extern template bool ProtobufHttpClient::performRequest<StockPositions, PositionsResponse>(
     const std::string&, const std::string&, const StockPositions&, PositionsResponse&);
 
-// GETģʵ
+// GET模板实例化声明
 extern template std::unique_ptr<AccountInfoResponse> ProtobufHttpClient::get<AccountInfoResponse>(
     const std::string&);
 
@@ -145,7 +196,7 @@ extern template std::unique_ptr<TradeResponse> ProtobufHttpClient::get<TradeResp
     const std::string&);
 
 
-// POSTģʵ
+// POST模板实例化声明
 extern template std::unique_ptr<PlaceOrderResponse> ProtobufHttpClient::post<PlaceOrder, PlaceOrderResponse>(
     const std::string&, const PlaceOrder&);
 extern template std::unique_ptr<CancelOrderIdResponse> ProtobufHttpClient::post<CancelOrderId, CancelOrderIdResponse>(
@@ -0,0 +1,184 @@
+﻿#include "read_cache.h"
+#include "LMDBClient.h"
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// 线性探测的最大步数，超过则覆盖起始槽位
+constexpr size_t kMaxProbe = 8;
+// 线程私有的计数每隔这么多次操作汇总到全局一次，避免命中路径上争用同一缓存行
+constexpr uint32_t kPublishEvery = 1024;
+// 位串最多缓存 MAX_BIT_INDEX + 1 位
+constexpr size_t kBitWords = (LMDBClient::MAX_BIT_INDEX + 1 + 63) / 64;
+
+size_t RoundUpPow2(size_t v) {
+    size_t p = 64;
+    while (p < v && p < (size_t(1) << 24)) p <<= 1;
+    return p;
+}
+
+} // namespace
+
+struct ReadCache::Slot {
+    std::string key;
+    size_t hash = 0;
+    uint64_t txn_id = 0;
+    Kind kind = Kind::Empty;
+    double number = 0.0;            // Double
+    int integer = 0;                // Int
+    uint64_t bits[kBitWords] = {};  // Bits：第 n 位即位串的第 n 位
+    uint32_t bit_bytes = 0;         // 位串原长度
+};
+
+struct ReadCache::Table {
+    std::vector<Slot> slots;
+    size_t mask = 0;
+    uint32_t ops = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+void ReadCache::Configure(LMDBClient* db, bool enabled, size_t slots) {
+    db_ = db;
+    if (slots > 0) slots_ = RoundUpPow2(slots);
+    enabled_ = enabled && db != nullptr;
+}
+
+ReadCache::Table& ReadCache::LocalTable(size_t slots) {
+    thread_local std::unique_ptr<Table> table;
+    if (!table) {
+        table = std::make_unique<Table>();
+        table->slots.resize(slots);
+        table->mask = slots - 1;
+    }
+    return *table;
+}
+
+void ReadCache::Publish(Table& table) {
+    hits_.fetch_add(table.hits, std::memory_order_relaxed);
+    misses_.fetch_add(table.misses, std::memory_order_relaxed);
+    evictions_.fetch_add(table.evictions, std::memory_order_relaxed);
+    table.hits = table.misses = table.evictions = 0;
+    table.ops = 0;
+}
+
+// === 查找 / 填入 ===
+
+const ReadCache::Slot* ReadCache::Lookup(std::string_view key, Kind kind) {
+    if (key.empty()) return nullptr;  // 空 key 用来标记空槽
+    uint64_t txn_id = db_->LastTxnId();
+    if (txn_id == 0) return nullptr;  // 库未打开
+
+    Table& table = LocalTable(slots_);
+    if (++table.ops >= kPublishEvery) Publish(table);
+
+    size_t hash = std::hash<std::string_view>{}(key);
+    size_t home = hash & table.mask;
+    Slot* slot = nullptr;
+    Slot* free_slot = nullptr;
+    for (size_t probe = 0; probe < kMaxProbe; ++probe) {
+        Slot& candidate = table.slots[(home + probe) & table.mask];
+        if (candidate.key.empty()) {
+            if (!free_slot) free_slot = &candidate;
+            break;
+        }
+        if (candidate.hash == hash && candidate.key == key) {
+            slot = &candidate;
+            break;
+        }
+    }
+
+    if (slot && slot->txn_id == txn_id && (slot->kind == kind || slot->kind == Kind::Missing)) {
+        ++table.hits;
+        return slot;
+    }
+
+    ++table.misses;
+    if (!slot) {
+        slot = free_slot;
+        if (!slot) {
+            slot = &table.slots[home];
+            ++table.evictions;
+        }
+        slot->key.assign(key.data(), key.size());
+        slot->hash = hash;
+    }
+
+    LMDBClient::ReadScope scope(*db_);
+    if (!scope.ok()) {
+        slot->kind = Kind::Empty;
+        return nullptr;
+    }
+    slot->txn_id = scope.TxnId();
+
+    std::string_view raw;
+    if (!scope.Get(key, &raw)) {
+        slot->kind = Kind::Missing;
+        return slot;
+    }
+    slot->kind = kind;
+    switch (kind) {
+    case Kind::Double:
+        if (raw.size() == sizeof(double)) std::memcpy(&slot->number, raw.data(), sizeof(double));
+        else slot->kind = Kind::Empty;
+        break;
+    case Kind::Int:
+        if (raw.size() == sizeof(int)) std::memcpy(&slot->integer, raw.data(), sizeof(int));
+        else slot->kind = Kind::Empty;
+        break;
+    case Kind::Bits: {
+        std::memset(slot->bits, 0, sizeof(slot->bits));
+        size_t bytes = raw.size() < sizeof(slot->bits) ? raw.size() : sizeof(slot->bits);
+        std::memcpy(slot->bits, raw.data(), bytes);
+        slot->bit_bytes = static_cast<uint32_t>(raw.size());
+        break;
+    }
+    default:
+        break;
+    }
+    // 长度不符（与 LMDBClient 的读取一样视为失败），下次照常查库
+    return slot->kind == Kind::Empty ? nullptr : slot;
+}
+
+// === 读 ===
+
+bool ReadCache::GetDouble(std::string_view key, double* value) {
+    const Slot* slot = enabled_ ? Lookup(key, Kind::Double) : nullptr;
+    if (!slot) return db_ && db_->GetDouble(std::string(key), value);
+    if (slot->kind == Kind::Missing) return false;
+    if (value) *value = slot->number;
+    return true;
+}
+
+bool ReadCache::GetInt(std::string_view key, int* value) {
+    const Slot* slot = enabled_ ? Lookup(key, Kind::Int) : nullptr;
+    if (!slot) return db_ && db_->GetInt(std::string(key), value);
+    if (slot->kind == Kind::Missing) return false;
+    if (value) *value = slot->integer;
+    return true;
+}
+
+bool ReadCache::GetStringBit(std::string_view key, int bit_index, bool* bit_value) {
+    if (bit_index < 0 || bit_index > LMDBClient::MAX_BIT_INDEX) return false;
+    const Slot* slot = enabled_ ? Lookup(key, Kind::Bits) : nullptr;
+    if (!slot) return db_ && db_->GetStringBit(std::string(key), bit_index, bit_value);
+    if (slot->kind == Kind::Missing) return false;
+    if (bit_value) {
+        *bit_value = static_cast<uint32_t>(bit_index / 8) < slot->bit_bytes
+            && ((slot->bits[bit_index / 64] >> (bit_index % 64)) & 1);
+    }
+    return true;
+}
+
+ReadCache::Stats ReadCache::GetStats() const {
+    Stats stats;
+    stats.enabled = enabled_;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.evictions = evictions_.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,66 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class LMDBClient;
+
+// LMDB 前面的进程内一级缓存：导出函数反复读取的 double / int / 位串解码后放在线程私有的表里
+// 1. 开放寻址（线性探测）表，槽位即 key 的内部编号；key 文本只在首次出现时复制，之后失效重填不再分配
+// 2. 每个槽位记下填入时的 LMDB 事务号，mdb_env_info 报告的 me_last_txnid 变了（任何进程提交了写事务）
+//    表内全部槽位即失效，不需要逐个清理
+// 3. 不存在的 key 同样缓存，未命中的 GET_KEY 不会每次都查库
+// 只缓存读；写入仍直接落库（或经 WriteCombiner），提交后事务号变化，缓存自然失效
+class ReadCache {
+public:
+    struct Stats {
+        bool enabled = false;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;   // 探测窗口内没有空位，覆盖了其他 key
+    };
+
+    ReadCache(const ReadCache&) = delete;
+    ReadCache& operator=(const ReadCache&) = delete;
+
+    static ReadCache& GetInstance() {
+        static ReadCache instance;
+        return instance;
+    }
+
+    // 必须在第一次读之前调用
+    // slots: 每个线程的槽位数，向上取 2 的幂
+    void Configure(LMDBClient* db, bool enabled, size_t slots);
+    bool Enabled() const { return enabled_; }
+
+    // 返回值与 LMDBClient 同名函数一致
+    bool GetDouble(std::string_view key, double* value);
+    bool GetInt(std::string_view key, int* value);
+    bool GetStringBit(std::string_view key, int bit_index, bool* bit_value);
+
+    Stats GetStats() const;
+
+private:
+    ReadCache() = default;
+
+    struct Slot;
+    struct Table;
+    enum class Kind : uint8_t { Empty, Missing, Double, Int, Bits };
+
+    static Table& LocalTable(size_t slots);
+
+    // 查找（必要时填入）key 对应的槽位，要求解码成 kind；失败返回 nullptr，调用方直接读库
+    const Slot* Lookup(std::string_view key, Kind kind);
+    void Publish(Table& table);
+
+    LMDBClient* db_ = nullptr;
+    bool enabled_ = false;
+    size_t slots_ = 4096;
+
+    std::atomic<uint64_t> hits_{ 0 };
+    std::atomic<uint64_t> misses_{ 0 };
+    std::atomic<uint64_t> evictions_{ 0 };
+};
@@ -0,0 +1,261 @@
+﻿#include "redis_kv_store.h"
+#include "RedisClient.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <optional>
+
+namespace {
+
+// 本地缓存只缓存这两类 key，跟踪也只订阅这两个前缀
+const std::string kScalarPrefix = "key:";
+const std::string kBlockPrefix = "blkset:";
+
+// MGET 每批的 key 数
+constexpr size_t kAggregateBatch = 500;
+
+std::string FormatDouble(double value) {
+    // Redis 的 PutDouble 用 to_string 只保留 6 位小数，这里保留全部精度
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.17g", value);
+    return text;
+}
+
+bool ParseDouble(const std::string& text, double* value) {
+    char* end = nullptr;
+    double parsed = std::strtod(text.c_str(), &end);
+    if (end == text.c_str()) return false;
+    *value = parsed;
+    return true;
+}
+
+} // namespace
+
+void RedisKVStore::Configure(RedisClient* client, bool cache, size_t max_entries) {
+    client_ = client;
+    cache_enabled_ = cache;
+    if (max_entries > 0) max_shard_entries_ = (max_entries + kShards - 1) / kShards;
+}
+
+std::string RedisKVStore::BlockKey(uint32_t block_id) {
+    return kBlockPrefix + std::to_string(block_id);
+}
+
+// === 本地缓存 ===
+
+bool RedisKVStore::CacheUsable() {
+    if (!cache_enabled_) return false;
+    if (!tracking_started_.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(tracking_mutex_);
+        if (!tracking_started_ && client_->IsInitialized()) {
+            bool started = client_->StartTracking({ kScalarPrefix, kBlockPrefix },
+                [this](const std::vector<std::string>& keys, bool flush_all) { OnInvalidate(keys, flush_all); });
+            tracking_started_.store(started, std::memory_order_release);
+        }
+    }
+    return client_->IsTracking();
+}
+
+RedisKVStore::Shard& RedisKVStore::ShardOf(const std::string& key) {
+    return shards_[std::hash<std::string>{}(key) % kShards];
+}
+
+bool RedisKVStore::Find(const std::string& key, Entry* entry) {
+    Shard& shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) return false;
+    *entry = it->second;
+    return true;
+}
+
+uint64_t RedisKVStore::Epoch(const std::string& key) {
+    Shard& shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.epoch;
+}
+
+void RedisKVStore::Insert(const std::string& key, Entry entry, uint64_t epoch) {
+    // 读 Redis 期间跟踪断开：这段时间的通知可能丢了，不缓存
+    if (!client_->IsTracking()) return;
+
+    Shard& shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    // 读 Redis 期间这个分片被作废过，读到的值可能已经旧了
+    if (shard.epoch != epoch) return;
+    if (shard.entries.size() >= max_shard_entries_) shard.entries.clear();
+    shard.entries[key] = std::move(entry);
+}
+
+void RedisKVStore::Invalidate(const std::string& key) {
+    Shard& shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    ++shard.epoch;
+    shard.entries.erase(key);
+}
+
+void RedisKVStore::InvalidateAll() {
+    for (Shard& shard : shards_) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        ++shard.epoch;
+        shard.entries.clear();
+    }
+}
+
+void RedisKVStore::OnInvalidate(const std::vector<std::string>& keys, bool flush_all) {
+    if (flush_all) {
+        InvalidateAll();
+        return;
+    }
+    invalidations_.fetch_add(keys.size(), std::memory_order_relaxed);
+    for (const std::string& key : keys) Invalidate(key);
+}
+
+// === 标量 ===
+
+bool RedisKVStore::GetDouble(const std::string& key, double* value) {
+    *value = 0;
+    bool cached = CacheUsable();
+    Entry entry;
+    if (cached && Find(key, &entry)) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        if (entry.exists) *value = entry.value;
+        return entry.exists;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t epoch = cached ? Epoch(key) : 0;
+    std::string text;
+    bool found = false;
+    if (!client_->Lookup(key, &text, &found)) return false;   // 出错不缓存
+
+    entry = Entry();
+    entry.exists = found && ParseDouble(text, &entry.value);
+    if (cached) Insert(key, entry, epoch);
+    if (entry.exists) *value = entry.value;
+    return entry.exists;
+}
+
+bool RedisKVStore::PutDouble(const std::string& key, double value) {
+    // 写前作废：此后开始的读不会把旧值放进缓存；写后再作废：写之前已经读到旧值、还没放进缓存的读被拒绝
+    Invalidate(key);
+    bool ok = client_->Put(key, FormatDouble(value));
+    Invalidate(key);
+    return ok;
+}
+
+bool RedisKVStore::IncrementDouble(const std::string& key, double delta) {
+    Invalidate(key);
+    bool ok = client_->AtomicIncrementDouble(key, delta);
+    Invalidate(key);
+    return ok;
+}
+
+bool RedisKVStore::Delete(const std::string& key) {
+    Invalidate(key);
+    bool ok = client_->Delete(key);
+    Invalidate(key);
+    return ok;
+}
+
+bool RedisKVStore::DeleteKeys(const std::string& prefix) {
+    InvalidateAll();
+    bool ok = client_->DeleteKeys(prefix);
+    InvalidateAll();
+    return ok;
+}
+
+bool RedisKVStore::AggregateDoubles(const std::string& prefix, Aggregate* result) {
+    // 汇总不走缓存：SCAN 出全部 key，按批 MGET
+    *result = Aggregate();
+    if (!client_->IsInitialized()) return false;
+
+    std::vector<std::string> keys = client_->GetKeys(prefix, SIZE_MAX);
+    std::vector<std::optional<std::string>> values;
+    for (size_t begin = 0; begin < keys.size(); begin += kAggregateBatch) {
+        size_t end = (std::min)(keys.size(), begin + kAggregateBatch);
+        std::vector<std::string> batch(keys.begin() + begin, keys.begin() + end);
+        if (!client_->MultiGet(batch, &values)) return false;
+        for (const auto& text : values) {
+            double value = 0;
+            if (text && ParseDouble(*text, &value)) result->Add(value);
+        }
+    }
+    return true;
+}
+
+// === 板块 ===
+
+std::shared_ptr<const BlockBitmap> RedisKVStore::LoadBlock(uint32_t block_id) {
+    std::string key = BlockKey(block_id);
+    bool cached = CacheUsable();
+    Entry entry;
+    if (cached && Find(key, &entry) && entry.members) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return entry.members;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t epoch = cached ? Epoch(key) : 0;
+    std::vector<std::string> members;
+    if (!client_->SetMembers(key, &members)) return std::make_shared<const BlockBitmap>();
+
+    auto bitmap = std::make_shared<BlockBitmap>();
+    for (const std::string& member : members) {
+        bitmap->Add(static_cast<uint32_t>(std::strtoul(member.c_str(), nullptr, 10)));
+    }
+    entry = Entry();
+    entry.exists = !bitmap->Empty();
+    entry.members = bitmap;
+    if (cached) Insert(key, entry, epoch);
+    return bitmap;
+}
+
+bool RedisKVStore::BlockAdd(uint32_t block_id, std::string_view stock_code) {
+    std::string key = BlockKey(block_id);
+    Invalidate(key);
+    bool ok = client_->SetAdd(key, std::to_string(BlockEngine::StockId(stock_code)));
+    Invalidate(key);
+    return ok;
+}
+
+bool RedisKVStore::BlockContains(uint32_t block_id, std::string_view stock_code) {
+    return LoadBlock(block_id)->Contains(BlockEngine::StockId(stock_code));
+}
+
+uint64_t RedisKVStore::BlockSize(uint32_t block_id) {
+    return LoadBlock(block_id)->Cardinality();
+}
+
+uint64_t RedisKVStore::BlockCombinedSize(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) {
+    std::vector<std::shared_ptr<const BlockBitmap>> bitmaps;
+    bitmaps.reserve(block_ids.size());
+    for (uint32_t block_id : block_ids) bitmaps.push_back(LoadBlock(block_id));
+    return BlockEngine::CombinedSizeOf(op, bitmaps);
+}
+
+BlockBitmap RedisKVStore::BlockCombine(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) {
+    std::vector<std::shared_ptr<const BlockBitmap>> bitmaps;
+    bitmaps.reserve(block_ids.size());
+    for (uint32_t block_id : block_ids) bitmaps.push_back(LoadBlock(block_id));
+    return BlockEngine::CombineBitmaps(op, std::move(bitmaps));
+}
+
+bool RedisKVStore::ResetBlocks() {
+    return DeleteKeys(kBlockPrefix);
+}
+
+RedisKVStore::Stats RedisKVStore::GetStats() const {
+    Stats stats;
+    stats.tracking = client_ && client_->IsTracking();
+    for (const Shard& shard : shards_) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        stats.entries += shard.entries.size();
+    }
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.invalidations = invalidations_.load(std::memory_order_relaxed);
+    return stats;
+}
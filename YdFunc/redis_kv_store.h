@@ -0,0 +1,108 @@
+﻿#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include "kv_store.h"
+
+class RedisClient;
+
+// Redis 后端：多台机器上的 Yd 实例共用 GET_KEY 系列和板块状态
+// 1. 标量存为文本（%.17g），ADD_KEY 用 INCRBYFLOAT，多个实例同时累加不会丢更新
+// 2. 板块为集合 blkset:<板块号>，成员为 StockId 的十进制文本；查询和集合运算在本地位图上做
+// 3. 读经本地缓存（包括“不存在”），失效靠 RESP3 CLIENT TRACKING 广播模式推送：任何实例改了 key:/blkset: 下的 key，
+//    所有实例都会收到通知；跟踪连接未建立（或 Redis 6 以下）时不缓存，每次读都访问 Redis
+// 4. 读己之写：写之前和写完之后都把本地条目作废；每个分片有代数，读 Redis 期间分片被作废过时读到的值不进缓存
+class RedisKVStore : public KVStore {
+public:
+    struct Stats {
+        bool tracking = false;
+        size_t entries = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t invalidations = 0;   // 收到的失效 key 数
+    };
+
+    RedisKVStore(const RedisKVStore&) = delete;
+    RedisKVStore& operator=(const RedisKVStore&) = delete;
+
+    static RedisKVStore& GetInstance() {
+        static RedisKVStore instance;
+        return instance;
+    }
+
+    // 必须在第一次读写之前调用；client 可以尚未初始化（之后初始化成功时再开启跟踪），但不能是只读的
+    // cache 为 false 时不缓存；max_entries 为本地缓存条目上限，分片满了整片清空
+    void Configure(RedisClient* client, bool cache, size_t max_entries);
+
+    bool GetDouble(const std::string& key, double* value) override;
+    bool PutDouble(const std::string& key, double value) override;
+    bool IncrementDouble(const std::string& key, double delta) override;
+    bool Delete(const std::string& key) override;
+    bool DeleteKeys(const std::string& prefix) override;
+    bool AggregateDoubles(const std::string& prefix, Aggregate* result) override;
+
+    bool BlockAdd(uint32_t block_id, std::string_view stock_code) override;
+    bool BlockContains(uint32_t block_id, std::string_view stock_code) override;
+    uint64_t BlockSize(uint32_t block_id) override;
+    uint64_t BlockCombinedSize(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) override;
+    BlockBitmap BlockCombine(BlockEngine::SetOp op, std::span<const uint32_t> block_ids) override;
+    bool ResetBlocks() override;
+
+    // 写都是同步的，没有排队
+    bool Flush(std::chrono::milliseconds) override { return true; }
+
+    const char* Name() const override { return "redis"; }
+
+    Stats GetStats() const;
+
+private:
+    static constexpr size_t kShards = 64;
+
+    struct Entry {
+        bool exists = false;
+        double value = 0;
+        std::shared_ptr<const BlockBitmap> members;   // 板块条目
+    };
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+        uint64_t epoch = 0;   // 每次作废加一
+    };
+
+    RedisKVStore() = default;
+
+    static std::string BlockKey(uint32_t block_id);
+
+    // 跟踪连接建立后才使用缓存；第一次在客户端已初始化时启动跟踪
+    bool CacheUsable();
+    Shard& ShardOf(const std::string& key);
+    bool Find(const std::string& key, Entry* entry);
+    // 返回读 Redis 之前的分片代数，Insert 时代数不变才写入
+    uint64_t Epoch(const std::string& key);
+    void Insert(const std::string& key, Entry entry, uint64_t epoch);
+    void Invalidate(const std::string& key);
+    void InvalidateAll();
+    void OnInvalidate(const std::vector<std::string>& keys, bool flush_all);
+
+    std::shared_ptr<const BlockBitmap> LoadBlock(uint32_t block_id);
+
+    RedisClient* client_ = nullptr;
+    bool cache_enabled_ = true;
+    size_t max_shard_entries_ = 1024;
+
+    std::mutex tracking_mutex_;
+    std::atomic<bool> tracking_started_{ false };
+
+    std::array<Shard, kShards> shards_;
+
+    std::atomic<uint64_t> hits_{ 0 };
+    std::atomic<uint64_t> misses_{ 0 };
+    std::atomic<uint64_t> invalidations_{ 0 };
+};
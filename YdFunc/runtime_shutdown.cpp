@@ -0,0 +1,44 @@
+﻿#include "runtime_shutdown.h"
+#include "curl_multi_engine.h"
+#include "latency_metrics.h"
+#include "order_batcher.h"
+#include "order_executor.h"
+#include "RedisClient.h"
+#include "shm_transport.h"
+#include "write_combiner.h"
+#include <algorithm>
+
+bool ShutdownRuntime(std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    // 每一步只能用剩下的时间；超时之后的步骤仍然执行，只是不再等待
+    auto remaining = [deadline]() {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        return (std::max)(left, std::chrono::milliseconds(0));
+    };
+
+    bool drained = true;
+    RedisClient& redis = RedisClient::GetInstance();
+
+    // 1. 回报输入；读线程可能阻塞在 XREADGROUP BLOCK 里
+    redis.StopStreams(remaining());
+    drained &= redis.DrainSubscriber(remaining());
+
+    // 2. 合批窗口
+    OrderBatcher::GetInstance().Drain(remaining());
+
+    // 3. 两种传输都排空，未使用的那个直接返回
+    drained &= CurlMultiEngine::GetInstance().Drain(remaining());
+    drained &= ShmTransport::GetInstance().Drain(remaining());
+
+    // 4. 完成回调
+    drained &= OrderExecutor::GetInstance().Drain(remaining());
+
+    // 5. 回调产生的写
+    drained &= WriteCombiner::GetInstance().Drain(remaining());
+
+    // 6. 与请求无关的后台线程
+    redis.StopTracking(remaining());
+    LatencyMetrics::GetInstance().StopReporter(remaining());
+
+    return drained;
+}
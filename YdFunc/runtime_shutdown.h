@@ -0,0 +1,16 @@
+﻿#pragma once
+
+#include <chrono>
+
+// 进程内后台组件的统一排空入口，导出函数 SHUTDOWN 和单元测试的 main 调用
+// DllMain 里不能 join，也等不到后台线程退出（见 dllmain.cpp），所以排空只能由这里显式完成
+// 按依赖顺序执行，前一步产生的工作由后一步接着排空：
+// 1. Redis 订阅 / Streams：停止接收回报，已收到的回调执行完（回调可能再向 OrderExecutor 提交对账）
+// 2. OrderBatcher：窗口里剩余的委托立即发出
+// 3. CurlMultiEngine / ShmTransport：等已提交的请求完成，完成回调交给 OrderExecutor
+// 4. OrderExecutor：等回调执行完（回调里有合并写）
+// 5. WriteCombiner：等回调产生的写全部落地
+// 6. Redis 客户端缓存跟踪线程、耗时上报线程
+// timeout 是全部步骤合计的上限；返回 true 表示每一步都在期限内排空
+// 之后下单、撤单、查询请求都会被拒绝（键值写改为同步落库），直到进程重启；重复调用无害
+bool ShutdownRuntime(std::chrono::milliseconds timeout);
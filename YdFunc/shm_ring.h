@@ -0,0 +1,120 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <string>
+#include <string_view>
+
+// 放在共享内存里的单生产者单消费者字节环
+// 帧格式：[u32 长度][内容]，写入时可以分段拼成一帧，读出时一次取一整帧
+// head / tail 为累计字节数，只增不减，下标取 pos & (capacity - 1)
+struct ShmRingHeader {
+    alignas(64) std::atomic<uint64_t> head;  // 生产者独占写
+    alignas(64) std::atomic<uint64_t> tail;  // 消费者独占写
+    alignas(64) uint32_t capacity;           // 数据区字节数，2 的幂
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "跨进程共享要求 64 位原子无锁");
+
+class ShmRing {
+public:
+    static constexpr size_t kFrameHeader = sizeof(uint32_t);
+
+    static size_t RegionSize(uint32_t capacity) {
+        return sizeof(ShmRingHeader) + capacity;
+    }
+
+    // 由创建共享内存的一方调用一次
+    static void Init(void* region, uint32_t capacity) {
+        auto* header = new (region) ShmRingHeader();
+        header->head.store(0, std::memory_order_relaxed);
+        header->tail.store(0, std::memory_order_relaxed);
+        header->capacity = capacity;
+    }
+
+    ShmRing() = default;
+    explicit ShmRing(void* region)
+        : header_(static_cast<ShmRingHeader*>(region)),
+          data_(static_cast<uint8_t*>(region) + sizeof(ShmRingHeader)),
+          mask_(header_->capacity - 1) {}
+
+    bool Valid() const { return header_ != nullptr; }
+
+    // 单帧上限
+    size_t MaxFrame() const { return header_ ? header_->capacity - kFrameHeader : 0; }
+
+    // 生产者：把 parts 拼成一帧写入；空间不足返回 false，不写入任何字节
+    bool Write(std::initializer_list<std::string_view> parts) {
+        size_t len = 0;
+        for (auto part : parts) len += part.size();
+        if (len > MaxFrame()) return false;
+
+        uint64_t head = header_->head.load(std::memory_order_relaxed);
+        uint64_t tail = header_->tail.load(std::memory_order_acquire);
+        // tail 由对方写，越过 head 或落后超过一整环都说明环已损坏，不写
+        if (tail > head || head - tail > header_->capacity) return false;
+        if (header_->capacity - (head - tail) < kFrameHeader + len) return false;
+
+        uint32_t len32 = static_cast<uint32_t>(len);
+        Copy(head, &len32, kFrameHeader);
+        uint64_t pos = head + kFrameHeader;
+        for (auto part : parts) {
+            Copy(pos, part.data(), part.size());
+            pos += part.size();
+        }
+        header_->head.store(pos, std::memory_order_release);
+        return true;
+    }
+
+    // 消费者：取出一帧（不含长度前缀）；没有数据返回 false
+    // head 和帧长都由对方写，不可信：长度越过可读范围时丢弃环里现有的全部数据（tail 追到 head），返回 false
+    bool Read(std::string& frame) {
+        uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        uint64_t head = header_->head.load(std::memory_order_acquire);
+        if (head == tail) return false;
+
+        uint64_t readable = head - tail;
+        if (readable > header_->capacity || readable < kFrameHeader) {
+            Reset(head);
+            return false;
+        }
+
+        uint32_t len = 0;
+        Fetch(tail, &len, kFrameHeader);
+        if (len > MaxFrame() || kFrameHeader + static_cast<uint64_t>(len) > readable) {
+            Reset(head);
+            return false;
+        }
+        frame.resize(len);
+        Fetch(tail + kFrameHeader, frame.data(), len);
+        header_->tail.store(tail + kFrameHeader + len, std::memory_order_release);
+        return true;
+    }
+
+private:
+    void Reset(uint64_t head) {
+        header_->tail.store(head, std::memory_order_release);
+    }
+
+    void Copy(uint64_t pos, const void* src, size_t n) {
+        size_t offset = static_cast<size_t>(pos & mask_);
+        size_t first = (n < header_->capacity - offset) ? n : header_->capacity - offset;
+        std::memcpy(data_ + offset, src, first);
+        std::memcpy(data_, static_cast<const uint8_t*>(src) + first, n - first);
+    }
+
+    void Fetch(uint64_t pos, void* dst, size_t n) const {
+        size_t offset = static_cast<size_t>(pos & mask_);
+        size_t first = (n < header_->capacity - offset) ? n : header_->capacity - offset;
+        std::memcpy(dst, data_ + offset, first);
+        std::memcpy(static_cast<uint8_t*>(dst) + first, data_, n - first);
+    }
+
+    ShmRingHeader* header_ = nullptr;
+    uint8_t* data_ = nullptr;
+    uint64_t mask_ = 0;
+};
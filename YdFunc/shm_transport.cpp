@@ -0,0 +1,350 @@
+﻿#include "stdafx.h"
+#include "shm_transport.h"
+#include "shm_ring.h"
+#include "mpsc_queue.h"
+#include <deque>
+#include <unordered_map>
+
+namespace {
+
+// 映射区开头的控制块，创建方初始化完两个环之后最后写 magic
+// next_request_id / producer_pid 只由本端（请求环的生产者）使用，服务端不读写；映射新建时为 0
+struct ShmControl {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t ring_bytes;
+    uint32_t reserved;
+    std::atomic<uint64_t> next_request_id;  // 最后写入的请求号；DLL 重新加载后从这里续号，不会与环里的旧响应撞号
+    std::atomic<uint32_t> producer_pid;     // 当前生产者进程，0 表示没有
+};
+constexpr size_t kControlSize = 64;
+static_assert(sizeof(ShmControl) <= kControlSize, "控制块超过预留大小");
+
+constexpr size_t kRequestHeader = sizeof(uint64_t) + 2 * sizeof(uint8_t) + sizeof(uint16_t);
+constexpr size_t kResponseHeader = sizeof(uint64_t) + sizeof(uint32_t);
+
+uint32_t RoundUpPow2(uint32_t v) {
+    uint32_t p = 4096;
+    while (p < v && p < (1u << 30)) p <<= 1;
+    return p;
+}
+
+bool ProcessAlive(DWORD pid) {
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid);
+    // 没有权限打开说明进程存在
+    if (!process) return GetLastError() == ERROR_ACCESS_DENIED;
+    DWORD code = 0;
+    bool alive = GetExitCodeProcess(process, &code) && code == STILL_ACTIVE;
+    CloseHandle(process);
+    return alive;
+}
+
+// 请求环是单生产者：另一个仍在运行的进程（例如第二个易得）已经接入时拒绝
+bool ClaimProducer(ShmControl* control) {
+    uint32_t self = GetCurrentProcessId();
+    uint32_t owner = control->producer_pid.load(std::memory_order_acquire);
+    while (true) {
+        if (owner == self) return true;
+        if (owner != 0 && ProcessAlive(owner)) return false;
+        if (control->producer_pid.compare_exchange_strong(owner, self, std::memory_order_acq_rel)) return true;
+    }
+}
+
+} // namespace
+
+struct ShmTransport::Call {
+    Request request;
+    Completion done;
+    uint64_t id = 0;
+    std::chrono::steady_clock::time_point submitted_at;
+    std::chrono::steady_clock::time_point written_at;
+    std::chrono::steady_clock::time_point deadline;
+};
+
+struct ShmTransport::State {
+    HANDLE mapping = nullptr;
+    HANDLE request_event = nullptr;   // 请求环有新帧，通知服务端
+    HANDLE response_event = nullptr;  // 响应环有新帧，由服务端置位
+    HANDLE wake_event = nullptr;      // Submit / Stop 唤醒 I/O 线程
+    void* view = nullptr;
+    ShmControl* control = nullptr;
+    ShmRing requests;
+    ShmRing responses;
+
+    MpscQueue<Call*> incoming;
+    std::deque<Call*> backlog;                   // 请求环暂时写不下的
+    std::unordered_map<uint64_t, Call*> waiting; // 已写入请求环，等待响应
+    uint64_t next_id = 0;
+    std::string frame;                           // 读响应的复用缓冲
+};
+
+ShmTransport::~ShmTransport() {
+    // 与 CurlMultiEngine 相同：析构处于 loader lock 下，只通知 I/O 线程退出并 detach
+    Stop(std::chrono::milliseconds(0));
+}
+
+void ShmTransport::Configure(const std::string& name, uint32_t ring_bytes, size_t max_pending) {
+    if (state_) return;
+    if (!name.empty()) name_ = name;
+    if (ring_bytes > 0) ring_bytes_ = RoundUpPow2(ring_bytes);
+    if (max_pending > 0) max_pending_ = max_pending;
+}
+
+void ShmTransport::EnsureStarted() {
+    std::call_once(start_flag_, [this]() {
+        state_ = new State();
+        if (!OpenMapping()) return;
+
+        io_running_ = true;
+        io_thread_ = std::thread(&ShmTransport::IoLoop, this);
+        });
+}
+
+bool ShmTransport::OpenMapping() {
+    size_t total = kControlSize + 2 * ShmRing::RegionSize(ring_bytes_);
+    state_->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        0, static_cast<DWORD>(total), name_.c_str());
+    if (!state_->mapping) return false;
+    bool created = GetLastError() != ERROR_ALREADY_EXISTS;
+
+    // 长度传 0 映射整个区段，服务端先创建时区段可能比本端配置的大
+    state_->view = MapViewOfFile(state_->mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!state_->view) return false;
+
+    auto* base = static_cast<uint8_t*>(state_->view);
+    auto* control = reinterpret_cast<ShmControl*>(base);
+    if (created) {
+        control->version = kVersion;
+        control->ring_bytes = ring_bytes_;
+        ShmRing::Init(base + kControlSize, ring_bytes_);
+        ShmRing::Init(base + kControlSize + ShmRing::RegionSize(ring_bytes_), ring_bytes_);
+        control->magic.store(kMagic, std::memory_order_release);
+    }
+    else {
+        // 对方刚创建、还没初始化完，稍等
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+        while (control->magic.load(std::memory_order_acquire) != kMagic) {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (control->version != kVersion) return false;
+        ring_bytes_ = control->ring_bytes;
+    }
+
+    if (!ClaimProducer(control)) return false;
+    state_->control = control;
+    state_->next_id = control->next_request_id.load(std::memory_order_relaxed);
+
+    state_->requests = ShmRing(base + kControlSize);
+    state_->responses = ShmRing(base + kControlSize + ShmRing::RegionSize(ring_bytes_));
+
+    state_->request_event = CreateEventA(nullptr, FALSE, FALSE, (name_ + "_req").c_str());
+    state_->response_event = CreateEventA(nullptr, FALSE, FALSE, (name_ + "_rsp").c_str());
+    state_->wake_event = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+    return state_->request_event && state_->response_event && state_->wake_event;
+}
+
+bool ShmTransport::Submit(Request request, Completion done) {
+    if (!done || !accepting_.load(std::memory_order_acquire)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    EnsureStarted();
+    if (!io_running_.load(std::memory_order_acquire)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    size_t pending = pending_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (pending > max_pending_) {
+        pending_.fetch_sub(1, std::memory_order_acq_rel);
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto* call = new Call();
+    call->request = std::move(request);
+    call->done = std::move(done);
+    call->submitted_at = std::chrono::steady_clock::now();
+    call->deadline = call->submitted_at + std::chrono::milliseconds(call->request.timeout_ms);
+
+    state_->incoming.Push(call);
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+    SetEvent(state_->wake_event);
+    return true;
+}
+
+void ShmTransport::IoLoop() {
+    HANDLE handles[2] = { state_->response_event, state_->wake_event };
+    auto next_expire = std::chrono::steady_clock::now();
+
+    while (!stopping_.load(std::memory_order_acquire)) {
+        Call* call = nullptr;
+        while (state_->incoming.Pop(call)) {
+            const Request& req = call->request;
+            if (kRequestHeader + req.endpoint.size() + req.body.size() > state_->requests.MaxFrame()) {
+                Result result;
+                result.error = kFrameTooLargeError;
+                result.phase = SendPhase::NotSent;
+                Complete(call, result);
+                continue;
+            }
+            state_->backlog.push_back(call);
+        }
+
+        bool wrote = false;
+        while (!state_->backlog.empty() && WriteFrame(state_->backlog.front())) {
+            state_->backlog.pop_front();
+            wrote = true;
+        }
+        if (wrote) SetEvent(state_->request_event);
+
+        ReadResponses();
+
+        auto now = std::chrono::steady_clock::now();
+        if (now >= next_expire) {
+            ExpireCalls(now);
+            next_expire = now + std::chrono::milliseconds(10);
+        }
+
+        // 请求环写满时服务端读走后不会通知本端，短间隔重试
+        DWORD wait_ms = state_->backlog.empty() ? 10 : 1;
+        WaitForMultipleObjects(2, handles, FALSE, wait_ms);
+    }
+
+    io_running_.store(false, std::memory_order_release);
+}
+
+bool ShmTransport::WriteFrame(Call* call) {
+    const Request& req = call->request;
+    uint8_t header[kRequestHeader];
+    uint64_t id = ++state_->next_id;
+    uint16_t endpoint_len = static_cast<uint16_t>(req.endpoint.size());
+    std::memcpy(header, &id, sizeof(id));
+    header[8] = (req.method == "GET") ? 0 : 1;
+    header[9] = 0;
+    std::memcpy(header + 10, &endpoint_len, sizeof(endpoint_len));
+
+    bool ok = state_->requests.Write({
+        std::string_view(reinterpret_cast<const char*>(header), sizeof(header)),
+        req.endpoint,
+        req.body });
+    if (!ok) {
+        --state_->next_id;
+        return false;
+    }
+
+    state_->control->next_request_id.store(id, std::memory_order_relaxed);
+    call->id = id;
+    call->written_at = std::chrono::steady_clock::now();
+    state_->waiting.emplace(id, call);
+    in_flight_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void ShmTransport::ReadResponses() {
+    std::string& frame = state_->frame;
+    while (state_->responses.Read(frame)) {
+        if (frame.size() < kResponseHeader) continue;
+
+        uint64_t id = 0;
+        uint32_t status = 0;
+        std::memcpy(&id, frame.data(), sizeof(id));
+        std::memcpy(&status, frame.data() + sizeof(id), sizeof(status));
+
+        auto it = state_->waiting.find(id);
+        if (it == state_->waiting.end()) continue; // 已超时的迟到响应
+        Call* call = it->second;
+        state_->waiting.erase(it);
+        in_flight_.fetch_sub(1, std::memory_order_relaxed);
+
+        Result result;
+        result.ok = true;
+        result.http_code = status;
+        result.body.assign(frame, kResponseHeader, std::string::npos);
+        // 没有建连阶段；首字节即服务端处理 + 两次环形缓冲区拷贝
+        result.queue_us = std::chrono::duration_cast<std::chrono::microseconds>(call->written_at - call->submitted_at).count();
+        result.first_byte_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - call->written_at).count();
+        Complete(call, result);
+    }
+}
+
+void ShmTransport::ExpireCalls(std::chrono::steady_clock::time_point now) {
+    for (auto it = state_->waiting.begin(); it != state_->waiting.end();) {
+        Call* call = it->second;
+        if (call->deadline > now) {
+            ++it;
+            continue;
+        }
+        it = state_->waiting.erase(it);
+        in_flight_.fetch_sub(1, std::memory_order_relaxed);
+
+        Result result;
+        result.error = "Timeout was reached";
+        Complete(call, result);
+    }
+
+    // 服务端不读请求环时，排队的请求同样按期限失败
+    while (!state_->backlog.empty() && state_->backlog.front()->deadline <= now) {
+        Call* call = state_->backlog.front();
+        state_->backlog.pop_front();
+
+        // 还没写进请求环，服务端没见过这个请求
+        Result result;
+        result.error = "Timeout was reached";
+        result.phase = SendPhase::NotSent;
+        Complete(call, result);
+    }
+}
+
+void ShmTransport::Complete(Call* call, Result& result) {
+    try {
+        call->done(result);
+    }
+    catch (...) {
+        // 回调异常不能打断 I/O 线程
+    }
+    delete call;
+
+    completed_.fetch_add(1, std::memory_order_relaxed);
+    pending_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool ShmTransport::Drain(std::chrono::milliseconds timeout) {
+    accepting_.store(false, std::memory_order_release);
+    if (!state_) return true;
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (pending_.load(std::memory_order_acquire) > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    bool drained = pending_.load(std::memory_order_acquire) == 0;
+
+    Stop(std::chrono::milliseconds(200));
+    return drained;
+}
+
+void ShmTransport::Stop(std::chrono::milliseconds grace) {
+    if (stopping_.exchange(true, std::memory_order_acq_rel)) return;
+    if (!state_) return;
+
+    if (state_->wake_event) SetEvent(state_->wake_event);
+
+    // 析构时处于 loader lock 下，不能 join；映射和句柄随进程回收
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (io_running_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (io_thread_.joinable()) io_thread_.detach();
+}
+
+ShmTransport::Stats ShmTransport::GetStats() const {
+    Stats stats;
+    stats.pending = pending_.load(std::memory_order_relaxed);
+    stats.in_flight = in_flight_.load(std::memory_order_relaxed);
+    stats.submitted = submitted_.load(std::memory_order_relaxed);
+    stats.completed = completed_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    return stats;
+}
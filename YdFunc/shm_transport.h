@@ -0,0 +1,79 @@
+﻿#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "message_transport.h"
+
+// 共享内存传输：DLL 与 qmt_api 在同一台机器上时，绕开 TCP 协议栈和 HTTP 头解析
+// 1. 命名文件映射里放两个 SPSC 字节环（请求 / 响应各一个），只传带长度前缀的 protobuf 帧
+//      请求帧：[u64 请求号][u8 方法 0=GET 1=POST][u8 保留][u16 endpoint 长度][endpoint][protobuf]
+//      响应帧：[u64 请求号][u32 状态码][protobuf]
+// 2. 本端只有 I/O 线程写请求环、读响应环，Submit 通过无锁队列交给 I/O 线程，满足 SPSC
+// 3. 有新帧时置对方的命名事件（<name>_req / <name>_rsp），不轮询
+// 4. 服务端按环内顺序处理请求，ordering_key 相同的请求自然保持先后顺序
+// 5. 请求号保存在映射里，DLL 重新加载后接着编号；同一时间只允许一个进程接入，另一个进程已接入时 Submit 全部拒绝
+class ShmTransport : public MessageTransport {
+public:
+    static constexpr uint32_t kMagic = 0x51544D53;  // "SMTQ"
+    static constexpr uint32_t kVersion = 1;
+    static constexpr const char* kFrameTooLargeError = "Frame larger than shared memory ring";
+
+    ShmTransport(const ShmTransport&) = delete;
+    ShmTransport& operator=(const ShmTransport&) = delete;
+
+    static ShmTransport& GetInstance() {
+        static ShmTransport instance;
+        return instance;
+    }
+
+    // 必须在第一次 Submit 之前调用
+    // name: 文件映射和事件的名字前缀；ring_bytes: 每个方向的环大小，向上取整到 2 的幂
+    // 映射已由服务端创建时，以服务端的环大小为准
+    void Configure(const std::string& name, uint32_t ring_bytes, size_t max_pending);
+
+    bool Submit(Request request, Completion done) override;
+    bool Drain(std::chrono::milliseconds timeout) override;
+    Stats GetStats() const override;
+    const char* Name() const override { return "shm"; }
+
+private:
+    ShmTransport() = default;
+    ~ShmTransport();
+
+    struct State;
+    struct Call;
+
+    void EnsureStarted();
+    bool OpenMapping();
+    void Stop(std::chrono::milliseconds grace);
+
+    // 以下只在 I/O 线程上调用
+    void IoLoop();
+    bool WriteFrame(Call* call);
+    void ReadResponses();
+    void ExpireCalls(std::chrono::steady_clock::time_point now);
+    void Complete(Call* call, Result& result);
+
+    std::string name_ = "qmt_api_shm";
+    uint32_t ring_bytes_ = 1u << 20;
+    size_t max_pending_ = 4096;
+
+    std::once_flag start_flag_;
+    State* state_ = nullptr;   // Windows 句柄等，定义在 cpp 中
+    std::thread io_thread_;
+
+    std::atomic<bool> accepting_{ true };
+    std::atomic<bool> stopping_{ false };
+    std::atomic<bool> io_running_{ false };
+
+    std::atomic<size_t> pending_{ 0 };
+    std::atomic<size_t> in_flight_{ 0 };
+    std::atomic<uint64_t> submitted_{ 0 };
+    std::atomic<uint64_t> completed_{ 0 };
+    std::atomic<uint64_t> rejected_{ 0 };
+};
@@ -1,16 +1,16 @@
-// stdafx.h : ׼ϵͳļİļ
-// Ǿʹõĵ
-// ضĿİļ
+// stdafx.h : 标准系统包含文件的包含文件，
+// 或是经常使用但不常更改的
+// 特定于项目的包含文件
 //
 
 #pragma once
 
 #include "targetver.h"
 
-#define WIN32_LEAN_AND_MEAN             //   Windows ͷļųʹõϢ
-// Windows ͷļ:
+#define WIN32_LEAN_AND_MEAN             //  从 Windows 头文件中排除极少使用的信息
+// Windows 头文件:
 #include <windows.h>
-#include <string>    // std::string
+#include <string>    // 用于std::string
 #include <iomanip>
 #include <iostream>
 #include <ctime>
@@ -18,4 +18,4 @@
 
 
 
-// TODO: ڴ˴óҪͷļ
+// TODO: 在此处引用程序需要的其他头文件
@@ -1,8 +1,8 @@
 #pragma once
 
-//  SDKDDKVer.h õ߰汾 Windows ƽ̨
+// 包括 SDKDDKVer.h 将定义可用的最高版本的 Windows 平台。
 
-// ҪΪǰ Windows ƽ̨Ӧó WinSDKVer.h
-// WIN32_WINNT ΪҪֵ֧ƽ̨Ȼٰ SDKDDKVer.h
+// 如果要为以前的 Windows 平台生成应用程序，请包括 WinSDKVer.h，并将
+// WIN32_WINNT 宏设置为要支持的平台，然后再包括 SDKDDKVer.h。
 
 #include <SDKDDKVer.h>
@@ -0,0 +1,439 @@
+﻿#include "write_combiner.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <unordered_map>
+#include <utility>
+
+// 线程私有：记录本线程已入队、尚未提交的变更，按 key 分组、按入队顺序排列
+struct WriteCombiner::Overlay {
+    // 已提交的最大序号，由提交线程写
+    std::atomic<uint64_t> committed{ 0 };
+    // 以下只由所属线程访问
+    uint64_t next_seq = 0;
+    std::unordered_map<std::string, std::deque<std::pair<uint64_t, LMDBClient::Mutation>>> pending;
+};
+
+struct WriteCombiner::Pending {
+    LMDBClient::Mutation mutation;
+    std::shared_ptr<Overlay> owner;
+    uint64_t seq = 0;
+    std::shared_ptr<std::promise<void>> barrier; // 非空表示 Flush 屏障，不携带变更
+};
+
+namespace {
+
+using PendingEntries = std::deque<std::pair<uint64_t, LMDBClient::Mutation>>;
+
+void DropCommitted(PendingEntries& entries, uint64_t committed) {
+    while (!entries.empty() && entries.front().first <= committed) entries.pop_front();
+}
+
+// overlay 里的 key 只在本线程再次读写它时清理，写过大量不同 key 之后整体清一次
+constexpr size_t kOverlaySweepThreshold = 4096;
+
+} // namespace
+
+WriteCombiner::~WriteCombiner() {
+    // 与 OrderExecutor 相同：析构处于 loader lock 下，只通知提交线程退出并 detach
+    Stop(std::chrono::milliseconds(0));
+}
+
+void WriteCombiner::Configure(LMDBClient* db, bool enabled, size_t max_batch, int interval_ms, ReadCache* cache) {
+    if (committer_running_.load(std::memory_order_acquire)) return;
+    db_ = db;
+    cache_ = (cache && cache->Enabled()) ? cache : nullptr;
+    if (max_batch > 0) max_batch_ = max_batch;
+    if (interval_ms >= 0) interval_ = std::chrono::milliseconds(interval_ms);
+    accepting_.store(enabled && db != nullptr, std::memory_order_release);
+}
+
+void WriteCombiner::SetDropCallback(DropCallback callback) {
+    if (committer_running_.load(std::memory_order_acquire)) return;
+    drop_callback_ = std::move(callback);
+}
+
+std::shared_ptr<WriteCombiner::Overlay>& WriteCombiner::LocalOverlay() {
+    thread_local std::shared_ptr<Overlay> overlay;
+    return overlay;
+}
+
+void WriteCombiner::EnsureStarted() {
+    std::call_once(start_flag_, [this]() {
+        committer_running_ = true;
+        committer_ = std::thread(&WriteCombiner::CommitLoop, this);
+        });
+}
+
+// === 写 ===
+
+bool WriteCombiner::Enqueue(LMDBClient::Mutation mutation) {
+    if (!db_) return false;
+    if (!accepting_.load(std::memory_order_acquire)) {
+        return db_->ApplyMutations(std::span<const LMDBClient::Mutation>(&mutation, 1));
+    }
+    EnsureStarted();
+
+    std::shared_ptr<Overlay>& overlay = LocalOverlay();
+    if (!overlay) overlay = std::make_shared<Overlay>();
+
+    uint64_t committed = overlay->committed.load(std::memory_order_acquire);
+    if (overlay->pending.size() > kOverlaySweepThreshold) {
+        for (auto it = overlay->pending.begin(); it != overlay->pending.end();) {
+            DropCommitted(it->second, committed);
+            if (it->second.empty()) it = overlay->pending.erase(it);
+            else ++it;
+        }
+    }
+
+    uint64_t seq = ++overlay->next_seq;
+    PendingEntries& entries = overlay->pending[mutation.key];
+    DropCommitted(entries, committed);
+    entries.emplace_back(seq, mutation);
+
+    auto* pending = new Pending();
+    pending->mutation = std::move(mutation);
+    pending->owner = overlay;
+    pending->seq = seq;
+
+    pending_.fetch_add(1, std::memory_order_acq_rel);
+    enqueued_.fetch_add(1, std::memory_order_relaxed);
+    queue_.Push(pending);
+    signal_.release();
+    return true;
+}
+
+bool WriteCombiner::Put(const std::string& key, std::string value) {
+    LMDBClient::Mutation mutation;
+    mutation.op = LMDBClient::Mutation::Op::Put;
+    mutation.key = key;
+    mutation.value = std::move(value);
+    return Enqueue(std::move(mutation));
+}
+
+bool WriteCombiner::PutDouble(const std::string& key, double value) {
+    return Put(key, LMDBClient::DoubleToBytes(value));
+}
+
+bool WriteCombiner::Delete(const std::string& key) {
+    LMDBClient::Mutation mutation;
+    mutation.op = LMDBClient::Mutation::Op::Delete;
+    mutation.key = key;
+    return Enqueue(std::move(mutation));
+}
+
+bool WriteCombiner::SetStringBit(const std::string& key, int bit_index, bool set) {
+    if (bit_index < 0 || bit_index > LMDBClient::MAX_BIT_INDEX) return false;
+    LMDBClient::Mutation mutation;
+    mutation.op = set ? LMDBClient::Mutation::Op::SetBit : LMDBClient::Mutation::Op::ClearBit;
+    mutation.key = key;
+    mutation.bit_index = bit_index;
+    return Enqueue(std::move(mutation));
+}
+
+bool WriteCombiner::Increment(const std::string& key, int delta) {
+    LMDBClient::Mutation mutation;
+    mutation.op = LMDBClient::Mutation::Op::Increment;
+    mutation.key = key;
+    mutation.delta = delta;
+    return Enqueue(std::move(mutation));
+}
+
+bool WriteCombiner::IncrementDouble(const std::string& key, double delta) {
+    LMDBClient::Mutation mutation;
+    mutation.op = LMDBClient::Mutation::Op::IncrementDouble;
+    mutation.key = key;
+    mutation.delta_double = delta;
+    return Enqueue(std::move(mutation));
+}
+
+bool WriteCombiner::UpdateBitmap(const std::string& key, uint32_t member, bool add) {
+    LMDBClient::Mutation mutation;
+    mutation.op = add ? LMDBClient::Mutation::Op::BitmapAdd : LMDBClient::Mutation::Op::BitmapRemove;
+    mutation.key = key;
+    mutation.member = member;
+    return Enqueue(std::move(mutation));
+}
+
+// === 读 ===
+
+bool WriteCombiner::ReadThrough(const std::string& key, std::string* value, bool* exists) {
+    std::shared_ptr<Overlay>& overlay = LocalOverlay();
+    if (!overlay || overlay->pending.empty()) return false;
+    auto it = overlay->pending.find(key);
+    if (it == overlay->pending.end()) return false;
+
+    // 库中的值和已提交序号必须来自同一时刻，否则同一条增量可能被叠加两次或漏掉
+    std::string stored;
+    bool found = false;
+    uint64_t committed = 0;
+    while (true) {
+        uint64_t epoch = commit_epoch_.load(std::memory_order_seq_cst);
+        if (epoch & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+        found = db_->Get(key, &stored);
+        committed = overlay->committed.load(std::memory_order_seq_cst);
+        if (commit_epoch_.load(std::memory_order_seq_cst) == epoch) break;
+    }
+
+    DropCommitted(it->second, committed);
+    for (const auto& [seq, mutation] : it->second) {
+        LMDBClient::ApplyMutation(mutation, &stored, &found);
+    }
+    if (it->second.empty()) overlay->pending.erase(it);
+
+    *value = std::move(stored);
+    *exists = found;
+    return true;
+}
+
+bool WriteCombiner::AggregateDoubles(const std::string& prefix, LMDBClient::Aggregate* result) {
+    if (!db_) return false;
+
+    // 本线程在 prefix 下还有未提交变更的 key；通常为空，直接走库里的汇总
+    std::vector<std::pair<std::string_view, PendingEntries*>> local;
+    std::shared_ptr<Overlay>& overlay = LocalOverlay();
+    if (overlay && !overlay->pending.empty()) {
+        uint64_t committed = overlay->committed.load(std::memory_order_acquire);
+        for (auto& [key, entries] : overlay->pending) {
+            if (key.compare(0, prefix.size(), prefix) != 0) continue;
+            DropCommitted(entries, committed);
+            if (!entries.empty()) local.emplace_back(std::string_view(key).substr(prefix.size()), &entries);
+        }
+    }
+    if (local.empty()) return db_->AggregateDoubles(prefix, result);
+
+    std::sort(local.begin(), local.end());
+    std::vector<std::string_view> skip;
+    skip.reserve(local.size());
+    for (const auto& item : local) skip.push_back(item.first);
+
+    // 与 ReadThrough 相同：汇总、库中的值和已提交序号必须来自同一时刻
+    LMDBClient::Aggregate aggregate;
+    std::vector<std::pair<std::string, bool>> stored(local.size());
+    uint64_t committed = 0;
+    while (true) {
+        uint64_t epoch = commit_epoch_.load(std::memory_order_seq_cst);
+        if (epoch & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (!db_->AggregateDoubles(prefix, &aggregate, skip)) return false;
+        for (size_t i = 0; i < local.size(); ++i) {
+            stored[i].second = db_->Get(prefix + std::string(local[i].first), &stored[i].first);
+        }
+        committed = overlay->committed.load(std::memory_order_seq_cst);
+        if (commit_epoch_.load(std::memory_order_seq_cst) == epoch) break;
+    }
+
+    for (size_t i = 0; i < local.size(); ++i) {
+        std::string& value = stored[i].first;
+        bool exists = stored[i].second;
+        for (const auto& [seq, mutation] : *local[i].second) {
+            if (seq > committed) LMDBClient::ApplyMutation(mutation, &value, &exists);
+        }
+        if (exists && value.size() == sizeof(double)) aggregate.Add(LMDBClient::BytesToDouble(value));
+    }
+    *result = aggregate;
+    return true;
+}
+
+bool WriteCombiner::HasPending(const std::string& key) const {
+    const std::shared_ptr<Overlay>& overlay = LocalOverlay();
+    if (!overlay || overlay->pending.empty()) return false;
+    auto it = overlay->pending.find(key);
+    if (it == overlay->pending.end() || it->second.empty()) return false;
+    return it->second.back().first > overlay->committed.load(std::memory_order_acquire);
+}
+
+bool WriteCombiner::Get(const std::string& key, std::string* value) {
+    std::string raw;
+    bool exists = false;
+    if (!ReadThrough(key, &raw, &exists)) return db_ && db_->Get(key, value);
+    if (!exists) return false;
+    if (value) *value = std::move(raw);
+    return true;
+}
+
+bool WriteCombiner::GetDouble(const std::string& key, double* value) {
+    std::string raw;
+    bool exists = false;
+    if (!ReadThrough(key, &raw, &exists)) return cache_ ? cache_->GetDouble(key, value) : db_ && db_->GetDouble(key, value);
+    if (!exists || raw.size() != sizeof(double)) return false;
+    if (value) std::memcpy(value, raw.data(), sizeof(double));
+    return true;
+}
+
+bool WriteCombiner::GetInt(const std::string& key, int* value) {
+    std::string raw;
+    bool exists = false;
+    if (!ReadThrough(key, &raw, &exists)) return cache_ ? cache_->GetInt(key, value) : db_ && db_->GetInt(key, value);
+    if (!exists || raw.size() != sizeof(int)) return false;
+    if (value) std::memcpy(value, raw.data(), sizeof(int));
+    return true;
+}
+
+bool WriteCombiner::GetStringBit(const std::string& key, int bit_index, bool* bit_value) {
+    if (bit_index < 0 || bit_index > LMDBClient::MAX_BIT_INDEX) return false;
+    std::string raw;
+    bool exists = false;
+    if (!ReadThrough(key, &raw, &exists)) {
+        return cache_ ? cache_->GetStringBit(key, bit_index, bit_value) : db_ && db_->GetStringBit(key, bit_index, bit_value);
+    }
+    if (!exists) return false;
+
+    size_t byte_offset = bit_index / 8;
+    if (bit_value) {
+        *bit_value = raw.size() > byte_offset &&
+            ((static_cast<unsigned char>(raw[byte_offset]) >> (bit_index % 8)) & 1);
+    }
+    return true;
+}
+
+// === 提交线程 ===
+
+WriteCombiner::Pending* WriteCombiner::PopOne() {
+    Pending* pending = nullptr;
+    bool got = queue_.Pop(pending);
+    while (!got && !stopping_.load(std::memory_order_acquire)) {
+        // 生产者已计数但还没链接完节点，稍等即可
+        std::this_thread::yield();
+        got = queue_.Pop(pending);
+    }
+    return got ? pending : nullptr;
+}
+
+void WriteCombiner::CommitLoop() {
+    std::vector<Pending*> batch;
+    batch.reserve(max_batch_);
+
+    while (true) {
+        if (!signal_.try_acquire_for(std::chrono::milliseconds(100))) {
+            if (stopping_.load(std::memory_order_acquire)) break;
+            continue;
+        }
+        Pending* first = PopOne();
+        if (!first) break;
+        batch.push_back(first);
+
+        // 第一条到达后再等一个时间片凑批；遇到屏障立即提交
+        auto deadline = std::chrono::steady_clock::now() + interval_;
+        while (batch.size() < max_batch_ && !batch.back()->barrier) {
+            if (!signal_.try_acquire_until(deadline)) break;
+            Pending* next = PopOne();
+            if (!next) break;
+            batch.push_back(next);
+        }
+
+        Commit(batch);
+        batch.clear();
+    }
+
+    committer_running_.store(false, std::memory_order_release);
+}
+
+void WriteCombiner::Commit(std::vector<Pending*>& batch) {
+    std::vector<LMDBClient::Mutation> mutations;
+    mutations.reserve(batch.size());
+    for (Pending* pending : batch) {
+        if (!pending->barrier) mutations.push_back(std::move(pending->mutation));
+    }
+
+    if (!mutations.empty()) {
+        commit_epoch_.fetch_add(1, std::memory_order_seq_cst);
+        bool ok = db_->ApplyMutations(mutations);
+        std::vector<std::string> dropped;
+        if (!ok) {
+            // 整批已回滚：按原顺序逐条各用一个事务重放，只丢弃单独也提交不了的那几条
+            for (const LMDBClient::Mutation& mutation : mutations) {
+                if (!db_->ApplyMutations(std::span<const LMDBClient::Mutation>(&mutation, 1))) {
+                    dropped.push_back(mutation.key);
+                }
+            }
+        }
+        // 丢弃的变更同样推进序号，overlay 不再叠加
+        for (Pending* pending : batch) {
+            if (pending->owner) pending->owner->committed.store(pending->seq, std::memory_order_seq_cst);
+        }
+        commit_epoch_.fetch_add(1, std::memory_order_seq_cst);
+
+        batches_.fetch_add(1, std::memory_order_relaxed);
+        if (!ok) failed_batches_.fetch_add(1, std::memory_order_relaxed);
+        committed_.fetch_add(mutations.size() - dropped.size(), std::memory_order_relaxed);
+        if (!dropped.empty()) {
+            dropped_.fetch_add(dropped.size(), std::memory_order_relaxed);
+            if (drop_callback_) drop_callback_(dropped);
+        }
+
+        size_t peak = max_batch_seen_.load(std::memory_order_relaxed);
+        while (mutations.size() > peak &&
+            !max_batch_seen_.compare_exchange_weak(peak, mutations.size(), std::memory_order_relaxed)) {
+        }
+    }
+
+    for (Pending* pending : batch) {
+        if (pending->barrier) pending->barrier->set_value();
+        else pending_.fetch_sub(1, std::memory_order_acq_rel);
+        delete pending;
+    }
+}
+
+// === 屏障 / 停止 ===
+
+bool WriteCombiner::Flush(std::chrono::milliseconds timeout) {
+    if (!committer_running_.load(std::memory_order_acquire)) return true;
+
+    uint64_t dropped_before = dropped_.load(std::memory_order_relaxed);
+    auto barrier = std::make_shared<std::promise<void>>();
+    std::future<void> done = barrier->get_future();
+
+    auto* pending = new Pending();
+    pending->barrier = std::move(barrier);
+    queue_.Push(pending);
+    signal_.release();
+
+    if (done.wait_for(timeout) != std::future_status::ready) return false;
+    return dropped_.load(std::memory_order_relaxed) == dropped_before;
+}
+
+bool WriteCombiner::Drain(std::chrono::milliseconds timeout) {
+    accepting_.store(false, std::memory_order_release);
+    if (!committer_running_.load(std::memory_order_acquire)) return true;
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (pending_.load(std::memory_order_acquire) > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    bool drained = pending_.load(std::memory_order_acquire) == 0;
+
+    Stop(std::chrono::milliseconds(200));
+    return drained;
+}
+
+void WriteCombiner::Stop(std::chrono::milliseconds grace) {
+    if (stopping_.exchange(true, std::memory_order_acq_rel)) return;
+    signal_.release();
+
+    // 析构时处于 loader lock 下，不能 join
+    auto deadline = std::chrono::steady_clock::now() + grace;
+    while (committer_running_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (committer_.joinable()) committer_.detach();
+}
+
+WriteCombiner::Stats WriteCombiner::GetStats() const {
+    Stats stats;
+    stats.enabled = accepting_.load(std::memory_order_relaxed);
+    stats.pending = pending_.load(std::memory_order_relaxed);
+    stats.enqueued = enqueued_.load(std::memory_order_relaxed);
+    stats.committed = committed_.load(std::memory_order_relaxed);
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    stats.failed_batches = failed_batches_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.max_batch_seen = max_batch_seen_.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,128 @@
+﻿#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <vector>
+#include "LMDBClient.h"
+#include "mpsc_queue.h"
+#include "read_cache.h"
+
+// LMDB 写合并：导出函数的写操作入队，由后台线程把一批（或一个时间片内的）变更合并成一个写事务提交
+// 1. 入队无锁（MPSC 队列），股池扫描时几百次 ADD_TO_BLOCK 只付几次 commit
+// 2. 读己之写：本线程已入队、尚未提交的变更记在线程私有的 overlay 里，本线程读同一 key 时叠加在库里的值上；
+//    其他线程要等提交后才能看到
+// 3. Flush 是屏障：返回 true 时，屏障之前入队的变更（包括其他线程的）都已提交
+// 未启用或已停止时所有操作直接同步读写 LMDB，调用方不需要区分
+class WriteCombiner {
+public:
+    struct Stats {
+        bool enabled = false;
+        size_t pending = 0;
+        uint64_t enqueued = 0;
+        uint64_t committed = 0;       // 已提交的变更条数
+        uint64_t batches = 0;
+        uint64_t failed_batches = 0;  // 整批提交失败、改为逐条重放的批次
+        uint64_t dropped = 0;         // 逐条重放仍提交不了而丢弃的变更条数
+        size_t max_batch_seen = 0;
+    };
+
+    WriteCombiner(const WriteCombiner&) = delete;
+    WriteCombiner& operator=(const WriteCombiner&) = delete;
+
+    static WriteCombiner& GetInstance() {
+        static WriteCombiner instance;
+        return instance;
+    }
+
+    // 必须在第一次读写之前调用
+    // max_batch: 一个事务最多合并的变更数；interval_ms: 收到第一条变更后最多再等多久凑批
+    // cache 非空时，没有未提交变更的读经过它（已 Configure 的 ReadCache）
+    void Configure(LMDBClient* db, bool enabled, size_t max_batch, int interval_ms, ReadCache* cache = nullptr);
+    bool Enabled() const { return accepting_.load(std::memory_order_acquire); }
+
+    // 有变更被丢弃时在提交线程上回调，参数为丢弃的 key（按入队顺序，可能重复）；同样在第一次写之前设置
+    using DropCallback = std::function<void(const std::vector<std::string>& keys)>;
+    void SetDropCallback(DropCallback callback);
+
+    // === 写 ===
+    bool Put(const std::string& key, std::string value);
+    bool PutDouble(const std::string& key, double value);
+    bool Delete(const std::string& key);
+    bool SetStringBit(const std::string& key, int bit_index, bool set);
+    bool Increment(const std::string& key, int delta);
+    bool IncrementDouble(const std::string& key, double delta);
+    // 值为 BlockBitmap 序列化格式，删空后整条删除
+    bool UpdateBitmap(const std::string& key, uint32_t member, bool add);
+
+    // === 读（叠加本线程未提交的变更），返回值与 LMDBClient 同名函数一致 ===
+    bool Get(const std::string& key, std::string* value);
+    bool GetDouble(const std::string& key, double* value);
+    bool GetInt(const std::string& key, int* value);
+    bool GetStringBit(const std::string& key, int bit_index, bool* bit_value);
+    bool AggregateDoubles(const std::string& prefix, LMDBClient::Aggregate* result);
+
+    // 本线程对 key 是否还有未提交的变更；有时读方应走 Get 而不是自己的缓存
+    bool HasPending(const std::string& key) const;
+
+    // 等待此前入队的变更全部提交；超时或期间有变更被丢弃返回 false
+    bool Flush(std::chrono::milliseconds timeout);
+
+    // 停止接收（之后的写直接同步落库），把队列里的变更提交完（最多 timeout）；由 ShutdownRuntime 调用
+    bool Drain(std::chrono::milliseconds timeout);
+
+    Stats GetStats() const;
+
+private:
+    WriteCombiner() = default;
+    ~WriteCombiner();
+
+    struct Overlay;
+    struct Pending;
+
+    // 本线程的 overlay，第一次写入时创建
+    static std::shared_ptr<Overlay>& LocalOverlay();
+
+    bool Enqueue(LMDBClient::Mutation mutation);
+    // 读 key 在库中的值并叠加本线程未提交的变更；没有未提交变更时返回 false，调用方直接读库
+    bool ReadThrough(const std::string& key, std::string* value, bool* exists);
+
+    void EnsureStarted();
+    void Stop(std::chrono::milliseconds grace);
+    void CommitLoop();
+    void Commit(std::vector<Pending*>& batch);
+    Pending* PopOne();
+
+    LMDBClient* db_ = nullptr;
+    ReadCache* cache_ = nullptr;
+    DropCallback drop_callback_;
+    size_t max_batch_ = 256;
+    std::chrono::milliseconds interval_{ 2 };
+
+    std::once_flag start_flag_;
+    MpscQueue<Pending*> queue_;
+    std::counting_semaphore<> signal_{ 0 };
+    std::thread committer_;
+
+    std::atomic<bool> accepting_{ false };
+    std::atomic<bool> stopping_{ false };
+    std::atomic<bool> committer_running_{ false };
+
+    // 提交期间为奇数；读者据此判断“库中的值”和“已提交序号”是否来自同一时刻（seqlock）
+    std::atomic<uint64_t> commit_epoch_{ 0 };
+
+    std::atomic<size_t> pending_{ 0 };
+    std::atomic<uint64_t> enqueued_{ 0 };
+    std::atomic<uint64_t> committed_{ 0 };
+    std::atomic<uint64_t> batches_{ 0 };
+    std::atomic<uint64_t> failed_batches_{ 0 };
+    std::atomic<uint64_t> dropped_{ 0 };
+    std::atomic<size_t> max_batch_seen_{ 0 };
+};
@@ -0,0 +1,201 @@
+﻿#include "bitset_kernels.h"
+#include "block_bitmap.h"
+#include "block_engine.h"
+#include "test_util.h"
+#include "write_combiner.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using Reference = std::set<uint32_t>;
+
+std::vector<uint32_t> Members(const BlockBitmap& bitmap) {
+    std::vector<uint32_t> members;
+    bitmap.ForEach([&](uint32_t value) { members.push_back(value); });
+    return members;
+}
+
+std::vector<uint32_t> Sorted(const Reference& reference) {
+    return std::vector<uint32_t>(reference.begin(), reference.end());
+}
+
+// 前两个桶放 dense 个（超过 4096 为位图容器），再散布 300 个到其他桶
+std::shared_ptr<BlockBitmap> Random(uint32_t seed, size_t dense, Reference* reference) {
+    auto bitmap = std::make_shared<BlockBitmap>();
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<uint32_t> low(0, 0x1FFFF);
+    std::uniform_int_distribution<uint32_t> any(0, 0x7FFFF);
+    for (size_t i = 0; i < dense; ++i) {
+        uint32_t value = low(rng);
+        bitmap->Add(value);
+        reference->insert(value);
+    }
+    for (size_t i = 0; i < 300; ++i) {
+        uint32_t value = any(rng);
+        bitmap->Add(value);
+        reference->insert(value);
+    }
+    return bitmap;
+}
+
+Reference Intersect(const Reference& a, const Reference& b) {
+    Reference out;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::inserter(out, out.end()));
+    return out;
+}
+
+Reference Unite(const Reference& a, const Reference& b) {
+    Reference out;
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::inserter(out, out.end()));
+    return out;
+}
+
+Reference Subtract(const Reference& a, const Reference& b) {
+    Reference out;
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::inserter(out, out.end()));
+    return out;
+}
+
+// 结束时恢复 SIMD 开关
+class SimdGuard {
+public:
+    SimdGuard() : enabled_(BitsetSimdEnabled()) {}
+    ~SimdGuard() { SetBitsetSimd(enabled_); }
+
+private:
+    bool enabled_;
+};
+
+} // namespace
+
+// === 位集内核 ===
+
+TEST(BitsetKernels, SimdAndScalarPathsAgree) {
+    SimdGuard guard;
+    std::mt19937_64 rng(7);
+    // 长度不是 4 的倍数，覆盖 256 位之后的尾部
+    const size_t words = 1027;
+    std::vector<uint64_t> a(words), b(words);
+    for (size_t i = 0; i < words; ++i) {
+        a[i] = rng();
+        b[i] = rng() & rng();
+    }
+
+    for (BitOp op : { BitOp::And, BitOp::Or, BitOp::AndNot }) {
+        std::vector<uint64_t> expected(words);
+        uint64_t expected_count = 0;
+        for (size_t i = 0; i < words; ++i) {
+            expected[i] = op == BitOp::And ? a[i] & b[i] : op == BitOp::Or ? a[i] | b[i] : a[i] & ~b[i];
+            expected_count += std::popcount(expected[i]);
+        }
+
+        for (bool simd : { false, true }) {
+            SetBitsetSimd(simd);
+            std::vector<uint64_t> out(words);
+            EXPECT_EQ(BitsetCombine(op, a.data(), b.data(), out.data(), words), expected_count);
+            EXPECT_EQ(out, expected);
+            // 只计数
+            EXPECT_EQ(BitsetCombine(op, a.data(), b.data(), nullptr, words), expected_count);
+            EXPECT_EQ(BitsetPopcount(expected.data(), words), expected_count);
+        }
+    }
+
+    // out 与 a 相同
+    std::vector<uint64_t> in_place = a;
+    uint64_t count = BitsetCombine(BitOp::And, in_place.data(), b.data(), in_place.data(), words);
+    EXPECT_EQ(BitsetPopcount(in_place.data(), words), count);
+}
+
+// === 位图集合运算 ===
+
+TEST(BlockBitmap, SetOperationsMatchReference) {
+    SimdGuard guard;
+    for (bool simd : { false, true }) {
+        SetBitsetSimd(simd);
+        // 位图 × 位图、位图 × 数组、数组 × 数组
+        for (auto [dense_a, dense_b] : { std::pair<size_t, size_t>{ 20000, 15000 }, { 20000, 1000 }, { 800, 1200 } }) {
+            Reference ra, rb;
+            auto a = Random(1, dense_a, &ra);
+            auto b = Random(2, dense_b, &rb);
+
+            EXPECT_EQ(BlockBitmap::AndCardinality(*a, *b), Intersect(ra, rb).size());
+
+            BlockBitmap both = *a;
+            both.And(*b);
+            EXPECT_EQ(Members(both), Sorted(Intersect(ra, rb)));
+            EXPECT_EQ(both.Cardinality(), Intersect(ra, rb).size());
+
+            BlockBitmap either = *a;
+            either.Or(*b);
+            EXPECT_EQ(Members(either), Sorted(Unite(ra, rb)));
+
+            BlockBitmap only = *a;
+            only.AndNot(*b);
+            EXPECT_EQ(Members(only), Sorted(Subtract(ra, rb)));
+        }
+    }
+}
+
+TEST(BlockEngine, CombineBitmapsMatchesReference) {
+    Reference ra, rb, rc;
+    std::vector<std::shared_ptr<const BlockBitmap>> bitmaps{
+        Random(11, 9000, &ra), Random(12, 3000, &rb), Random(13, 20000, &rc) };
+
+    Reference all = Intersect(Intersect(ra, rb), rc);
+    Reference any = Unite(Unite(ra, rb), rc);
+    Reference first = Subtract(Subtract(ra, rb), rc);
+
+    using SetOp = BlockEngine::SetOp;
+    EXPECT_EQ(Members(BlockEngine::CombineBitmaps(SetOp::Intersect, bitmaps)), Sorted(all));
+    EXPECT_EQ(Members(BlockEngine::CombineBitmaps(SetOp::Union, bitmaps)), Sorted(any));
+    EXPECT_EQ(Members(BlockEngine::CombineBitmaps(SetOp::Difference, bitmaps)), Sorted(first));
+    EXPECT_EQ(BlockEngine::CombinedSizeOf(SetOp::Intersect, bitmaps), all.size());
+    EXPECT_EQ(BlockEngine::CombinedSizeOf(SetOp::Union, bitmaps), any.size());
+    EXPECT_EQ(BlockEngine::CombinedSizeOf(SetOp::Difference, bitmaps), first.size());
+
+    // 两个位图时只计数
+    bitmaps.pop_back();
+    EXPECT_EQ(BlockEngine::CombinedSizeOf(SetOp::Intersect, bitmaps), Intersect(ra, rb).size());
+    EXPECT_EQ(BlockEngine::CombinedSizeOf(SetOp::Difference, bitmaps), Subtract(ra, rb).size());
+    EXPECT_EQ(BlockEngine::CombinedSizeOf(SetOp::Union, {}), 0u);
+}
+
+TEST(BlockEngine, CombinesStoredBlocks) {
+    BlockEngine& blocks = BlockEngine::GetInstance();
+    WriteCombiner& writes = WriteCombiner::GetInstance();
+    blocks.Configure(&SharedDb(), &writes);
+
+    const uint32_t bank = 9001, large = 9002, empty = 9003;
+    ASSERT_TRUE(blocks.Add(bank, "600000"));
+    ASSERT_TRUE(blocks.Add(bank, "601398"));
+    ASSERT_TRUE(blocks.Add(bank, "000001"));
+    ASSERT_TRUE(blocks.Add(large, "600000"));
+    ASSERT_TRUE(blocks.Add(large, "601398"));
+    ASSERT_TRUE(blocks.Add(large, "600519"));
+    ASSERT_TRUE(writes.Flush(1s));
+
+    using SetOp = BlockEngine::SetOp;
+    const uint32_t pair[] = { bank, large };
+    EXPECT_EQ(blocks.CombinedSize(SetOp::Intersect, pair), 2u);
+    EXPECT_EQ(blocks.CombinedSize(SetOp::Union, pair), 4u);
+    EXPECT_EQ(blocks.CombinedSize(SetOp::Difference, pair), 1u);
+    EXPECT_EQ(Members(blocks.Combine(SetOp::Difference, pair)),
+        std::vector<uint32_t>{ BlockEngine::StockId("000001") });
+
+    // 不存在的板块按空集处理
+    const uint32_t with_empty[] = { bank, large, empty };
+    EXPECT_EQ(blocks.CombinedSize(SetOp::Intersect, with_empty), 0u);
+    EXPECT_EQ(blocks.CombinedSize(SetOp::Union, with_empty), 4u);
+    EXPECT_EQ(blocks.CombinedSize(SetOp::Intersect, {}), 0u);
+}
@@ -0,0 +1,159 @@
+﻿#include "block_bitmap.h"
+#include "block_engine.h"
+#include "LMDBClient.h"
+#include "test_util.h"
+#include "write_combiner.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::vector<uint32_t> Members(const BlockBitmap& bitmap) {
+    std::vector<uint32_t> members;
+    bitmap.ForEach([&](uint32_t value) { members.push_back(value); });
+    return members;
+}
+
+// 同一个桶里放 count 个元素（超过 4096 时为位图容器），另外散布一些到别的桶
+void Fill(uint32_t seed, size_t count, BlockBitmap* bitmap, std::set<uint32_t>* reference) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<uint32_t> low(0, 0xFFFF);
+    std::uniform_int_distribution<uint32_t> any(0, 0x3FFFFF);
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t value = 0x10000 | low(rng);
+        bitmap->Add(value);
+        reference->insert(value);
+    }
+    for (size_t i = 0; i < 300; ++i) {
+        uint32_t value = any(rng);
+        bitmap->Add(value);
+        reference->insert(value);
+    }
+}
+
+} // namespace
+
+// === BlockBitmap ===
+
+TEST(BlockBitmap, AddRemoveContains) {
+    BlockBitmap bitmap;
+    EXPECT_TRUE(bitmap.Empty());
+    EXPECT_TRUE(bitmap.Add(600000));
+    EXPECT_FALSE(bitmap.Add(600000));
+    EXPECT_TRUE(bitmap.Add(1));
+    EXPECT_TRUE(bitmap.Add(0x80001234u));
+    EXPECT_EQ(bitmap.Cardinality(), 3u);
+    EXPECT_TRUE(bitmap.Contains(600000));
+    EXPECT_FALSE(bitmap.Contains(600001));
+
+    EXPECT_TRUE(bitmap.Remove(600000));
+    EXPECT_FALSE(bitmap.Remove(600000));
+    EXPECT_EQ(Members(bitmap), (std::vector<uint32_t>{ 1, 0x80001234u }));
+    bitmap.Clear();
+    EXPECT_TRUE(bitmap.Empty());
+}
+
+TEST(BlockBitmap, ConvertsBetweenArrayAndBitmapContainers) {
+    BlockBitmap bitmap;
+    for (uint32_t i = 0; i < 5000; ++i) bitmap.Add(i * 7 % 65536);
+    EXPECT_EQ(bitmap.Cardinality(), 5000u);
+    for (uint32_t i = 0; i < 5000; ++i) ASSERT_TRUE(bitmap.Contains(i * 7 % 65536));
+
+    // 删到 4096 以下转回数组，内容不变
+    for (uint32_t i = 0; i < 2000; ++i) bitmap.Remove(i * 7 % 65536);
+    EXPECT_EQ(bitmap.Cardinality(), 3000u);
+    std::vector<uint32_t> members = Members(bitmap);
+    ASSERT_EQ(members.size(), 3000u);
+    EXPECT_TRUE(std::is_sorted(members.begin(), members.end()));
+    EXPECT_FALSE(bitmap.Contains(0));
+    EXPECT_TRUE(bitmap.Contains(2000 * 7));
+}
+
+TEST(BlockBitmap, SerializeRoundTrip) {
+    BlockBitmap bitmap;
+    std::set<uint32_t> reference;
+    Fill(1, 6000, &bitmap, &reference);
+
+    std::string bytes;
+    bitmap.Serialize(&bytes);
+    BlockBitmap restored;
+    ASSERT_TRUE(BlockBitmap::Deserialize(bytes, &restored));
+    EXPECT_EQ(Members(restored), std::vector<uint32_t>(reference.begin(), reference.end()));
+
+    // 格式不对时不改动输出
+    BlockBitmap untouched;
+    untouched.Add(42);
+    EXPECT_FALSE(BlockBitmap::Deserialize("garbage", &untouched));
+    EXPECT_FALSE(BlockBitmap::Deserialize(std::string_view(bytes).substr(0, bytes.size() - 1), &untouched));
+    EXPECT_EQ(Members(untouched), std::vector<uint32_t>{ 42 });
+
+    BlockBitmap empty;
+    empty.Serialize(&bytes);
+    ASSERT_TRUE(BlockBitmap::Deserialize(bytes, &restored));
+    EXPECT_TRUE(restored.Empty());
+}
+
+// === BlockEngine ===
+
+TEST(BlockEngine, StockIdKeepsSixDigitCodesNumeric) {
+    EXPECT_EQ(BlockEngine::StockId("600000"), 600000u);
+    EXPECT_EQ(BlockEngine::StockId("000001"), 1u);
+    EXPECT_NE(BlockEngine::StockId("SZ0001") & 0x80000000u, 0u);
+    EXPECT_NE(BlockEngine::StockId("60000"), 60000u);
+    EXPECT_EQ(BlockEngine::StockId("HK00700"), BlockEngine::StockId("HK00700"));
+}
+
+TEST(BlockEngine, MigratesLegacyBitStrings) {
+    LMDBClient& db = SharedDb();
+    // 旧格式：BLK_<代码> 的第 n 位表示属于板块 n
+    ASSERT_TRUE(db.AtomicSetStringBit("BLK_600000", 3, true));
+    ASSERT_TRUE(db.AtomicSetStringBit("BLK_600000", 200, true));
+    ASSERT_TRUE(db.AtomicSetStringBit("BLK_000001", 3, true));
+    ASSERT_TRUE(db.AtomicIncrement("blk_size:3", 2));
+
+    BlockEngine& blocks = BlockEngine::GetInstance();
+    blocks.Configure(&db, &WriteCombiner::GetInstance());
+    EXPECT_GE(blocks.GetStats().migrated, 3u);
+
+    EXPECT_TRUE(blocks.Contains(3, "600000"));
+    EXPECT_TRUE(blocks.Contains(3, "000001"));
+    EXPECT_TRUE(blocks.Contains(200, "600000"));
+    EXPECT_FALSE(blocks.Contains(200, "000001"));
+    EXPECT_EQ(blocks.Size(3), 2u);
+    EXPECT_FALSE(db.Exists("BLK_600000"));
+    EXPECT_FALSE(db.Exists("blk_size:3"));
+}
+
+TEST(BlockEngine, AddIsVisibleBeforeCommitAndIdempotent) {
+    LMDBClient& db = SharedDb();
+    WriteCombiner& writes = WriteCombiner::GetInstance();
+    BlockEngine& blocks = BlockEngine::GetInstance();
+    blocks.Configure(&db, &writes);
+
+    // 板块号不再受旧位串 255 的限制
+    const uint32_t block = 123456789;
+    ASSERT_TRUE(blocks.Add(block, "600000"));
+    ASSERT_TRUE(blocks.Add(block, "600000"));
+    ASSERT_TRUE(blocks.Add(block, "SZ0001"));
+    EXPECT_TRUE(blocks.Contains(block, "600000"));
+    EXPECT_TRUE(blocks.Contains(block, "SZ0001"));
+    EXPECT_EQ(blocks.Size(block), 2u);
+
+    ASSERT_TRUE(writes.Flush(1s));
+    EXPECT_EQ(blocks.Size(block), 2u);
+
+    ASSERT_TRUE(blocks.Remove(block, "600000"));
+    ASSERT_TRUE(blocks.Remove(block, "SZ0001"));
+    EXPECT_EQ(blocks.Size(block), 0u);
+    ASSERT_TRUE(writes.Flush(1s));
+    // 删空后整条删除
+    EXPECT_FALSE(db.Exists("blkmap:" + std::to_string(block)));
+}
@@ -0,0 +1,181 @@
+﻿#include "block_engine.h"
+#include "kv_store.h"
+#include "lmdb_kv_store.h"
+#include "redis_kv_store.h"
+#include "RedisClient.h"
+#include "test_util.h"
+#include "write_combiner.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+// 两个后端跑同一组用例（见 kv_store.h 对实现的要求）
+// redis 后端连 YD_TEST_REDIS 指定的地址（默认 127.0.0.1:6379），连不上时跳过；用例只动 key:kvtest: 和 9100 起的板块
+
+namespace {
+
+constexpr uint32_t kFirstBlock = 9100;
+constexpr uint32_t kBlockCount = 4;
+
+KVStore* OpenLmdb() {
+    static std::once_flag flag;
+    std::call_once(flag, []() {
+        LMDBClient& db = SharedDb();
+        WriteCombiner& writes = WriteCombiner::GetInstance();
+        BlockEngine& blocks = BlockEngine::GetInstance();
+        blocks.Configure(&db, &writes);
+        LmdbKVStore::GetInstance().Configure(&db, &writes, &blocks);
+        });
+    return &LmdbKVStore::GetInstance();
+}
+
+KVStore* OpenRedis() {
+    static KVStore* store = []() -> KVStore* {
+        const char* uri = std::getenv("YD_TEST_REDIS");
+        RedisClient& client = RedisClient::GetInstance();
+        if (!client.Initialize(uri && *uri ? uri : "127.0.0.1:6379", false)) return nullptr;
+        RedisKVStore& redis_store = RedisKVStore::GetInstance();
+        redis_store.Configure(&client, true, 4096);
+        return &redis_store;
+    }();
+    return store;
+}
+
+} // namespace
+
+class KVStoreTest : public ::testing::TestWithParam<std::string> {
+protected:
+    void SetUp() override {
+        store_ = GetParam() == "redis" ? OpenRedis() : OpenLmdb();
+        if (!store_) GTEST_SKIP() << "Redis not reachable";
+        // 清掉上一个用例和上次运行（共享的 Redis）留下的数据；与 RESET_STATUS 一样先等排队的写落地
+        ASSERT_TRUE(store_->Flush(1s));
+        ASSERT_TRUE(store_->DeleteKeys("key:kvtest:"));
+        if (GetParam() == "redis") {
+            for (uint32_t i = 0; i < kBlockCount; ++i) RedisClient::GetInstance().Delete("blkset:" + std::to_string(kFirstBlock + i));
+        }
+    }
+
+    KVStore* store_ = nullptr;
+};
+
+TEST_P(KVStoreTest, ReadsOwnWrites) {
+    KVStore& store = *store_;
+    EXPECT_STREQ(store.Name(), GetParam().c_str());
+
+    double value = -1;
+    EXPECT_FALSE(store.GetDouble("key:kvtest:cash", &value));
+    EXPECT_EQ(value, 0);
+
+    ASSERT_TRUE(store.PutDouble("key:kvtest:cash", 100.5));
+    ASSERT_TRUE(store.GetDouble("key:kvtest:cash", &value));
+    EXPECT_EQ(value, 100.5);
+
+    // 缓存过的值在写之后立即更新
+    ASSERT_TRUE(store.PutDouble("key:kvtest:cash", 0.1));
+    ASSERT_TRUE(store.GetDouble("key:kvtest:cash", &value));
+    EXPECT_EQ(value, 0.1);
+
+    ASSERT_TRUE(store.Delete("key:kvtest:cash"));
+    EXPECT_FALSE(store.GetDouble("key:kvtest:cash", &value));
+}
+
+TEST_P(KVStoreTest, IncrementsFromManyThreadsAreNotLost) {
+    KVStore& store = *store_;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&store]() {
+            for (int i = 0; i < 100; ++i) store.IncrementDouble("key:kvtest:count", 0.5);
+            });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // 其他线程的写只保证 Flush 之后可见
+    ASSERT_TRUE(store.Flush(1s));
+    double value = 0;
+    ASSERT_TRUE(store.GetDouble("key:kvtest:count", &value));
+    EXPECT_EQ(value, 200);
+    ASSERT_TRUE(store.IncrementDouble("key:kvtest:count", -50));
+    ASSERT_TRUE(store.GetDouble("key:kvtest:count", &value));
+    EXPECT_EQ(value, 150);
+}
+
+TEST_P(KVStoreTest, AggregatesAndDeletesByPrefix) {
+    KVStore& store = *store_;
+    ASSERT_TRUE(store.PutDouble("key:kvtest:a", 1));
+    ASSERT_TRUE(store.PutDouble("key:kvtest:b", -2));
+    ASSERT_TRUE(store.PutDouble("key:kvtest:c", 7));
+    ASSERT_TRUE(store.PutDouble("key:kvtestx", 100));
+
+    KVStore::Aggregate aggregate;
+    ASSERT_TRUE(store.AggregateDoubles("key:kvtest:", &aggregate));
+    EXPECT_EQ(aggregate.count, 3u);
+    EXPECT_EQ(aggregate.sum, 6);
+    EXPECT_EQ(aggregate.min, -2);
+    EXPECT_EQ(aggregate.max, 7);
+
+    ASSERT_TRUE(store.Flush(1s));
+    ASSERT_TRUE(store.DeleteKeys("key:kvtest:"));
+    double value = 0;
+    EXPECT_FALSE(store.GetDouble("key:kvtest:a", &value));
+    ASSERT_TRUE(store.GetDouble("key:kvtestx", &value));
+    EXPECT_EQ(value, 100);
+    ASSERT_TRUE(store.AggregateDoubles("key:kvtest:", &aggregate));
+    EXPECT_EQ(aggregate.count, 0u);
+    ASSERT_TRUE(store.Delete("key:kvtestx"));
+}
+
+TEST_P(KVStoreTest, BlocksSupportMembershipAndSetAlgebra) {
+    KVStore& store = *store_;
+    const uint32_t a = kFirstBlock, b = kFirstBlock + 1, missing = kFirstBlock + 2;
+
+    EXPECT_FALSE(store.BlockContains(a, "600000"));
+    ASSERT_TRUE(store.BlockAdd(a, "600000"));
+    ASSERT_TRUE(store.BlockAdd(a, "000001"));
+    ASSERT_TRUE(store.BlockAdd(a, "000001"));
+    ASSERT_TRUE(store.BlockAdd(b, "600000"));
+    ASSERT_TRUE(store.BlockAdd(b, "HK00700"));
+
+    // 本线程写完立即可见，包括之前缓存过的“不在板块内”
+    EXPECT_TRUE(store.BlockContains(a, "600000"));
+    EXPECT_FALSE(store.BlockContains(a, "HK00700"));
+    EXPECT_EQ(store.BlockSize(a), 2u);
+    EXPECT_EQ(store.BlockSize(missing), 0u);
+
+    using SetOp = BlockEngine::SetOp;
+    const uint32_t pair[] = { a, b };
+    EXPECT_EQ(store.BlockCombinedSize(SetOp::Intersect, pair), 1u);
+    EXPECT_EQ(store.BlockCombinedSize(SetOp::Union, pair), 3u);
+    EXPECT_EQ(store.BlockCombinedSize(SetOp::Difference, pair), 1u);
+
+    BlockBitmap both = store.BlockCombine(SetOp::Intersect, pair);
+    EXPECT_EQ(both.Cardinality(), 1u);
+    EXPECT_TRUE(both.Contains(BlockEngine::StockId("600000")));
+
+    const uint32_t with_missing[] = { a, missing };
+    EXPECT_EQ(store.BlockCombinedSize(SetOp::Intersect, with_missing), 0u);
+    EXPECT_EQ(store.BlockCombinedSize(SetOp::Union, with_missing), 2u);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, KVStoreTest, ::testing::Values("lmdb", "redis"),
+    [](const ::testing::TestParamInfo<std::string>& info) { return info.param; });
+
+// ResetBlocks 会清空后端的全部板块，只在测试专用的 LMDB 库上跑
+TEST(LmdbKVStore, ResetBlocksClearsEverything) {
+    KVStore& store = *OpenLmdb();
+    const uint32_t block = kFirstBlock + 3;
+    ASSERT_TRUE(store.BlockAdd(block, "600000"));
+    ASSERT_TRUE(store.Flush(1s));
+    EXPECT_EQ(store.BlockSize(block), 1u);
+
+    ASSERT_TRUE(store.ResetBlocks());
+    EXPECT_EQ(store.BlockSize(block), 0u);
+    EXPECT_FALSE(store.BlockContains(block, "600000"));
+}
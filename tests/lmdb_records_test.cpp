@@ -0,0 +1,121 @@
+﻿#include "LMDBClient.h"
+#include "lmdb_records.h"
+#include "test_util.h"
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <gtest/gtest.h>
+
+using lmdb_records::AccountRecord;
+using lmdb_records::PositionRecord;
+
+// === 解码 ===
+
+TEST(LmdbRecords, DecodeRejectsShortOrUnversioned) {
+    PositionRecord record;
+    record.vol = 100;
+    EXPECT_FALSE(lmdb_records::Decode(&record, lmdb_records::kMinRecordSize - 1, &record));
+
+    PositionRecord zero{};
+    zero.version = 0;
+    EXPECT_FALSE(lmdb_records::Decode(&zero, sizeof(zero), &record));
+    EXPECT_EQ(record.vol, 100);
+}
+
+TEST(LmdbRecords, DecodeOlderRecordFillsMissingFieldsWithZero) {
+    // 只有 version / updated_ms 和第一个字段的旧版本记录
+    AccountRecord written;
+    written.updated_ms = 1700000000000;
+    written.total_asset = 12345.5;
+    written.cash = 999;
+    size_t old_size = offsetof(AccountRecord, frozen_cash);
+
+    AccountRecord read;
+    read.cash = -1;
+    ASSERT_TRUE(lmdb_records::Decode(&written, old_size, &read));
+    EXPECT_EQ(read.updated_ms, written.updated_ms);
+    EXPECT_EQ(read.total_asset, 12345.5);
+    EXPECT_EQ(read.frozen_cash, 0);
+    EXPECT_EQ(read.cash, 0);
+}
+
+TEST(LmdbRecords, DecodeNewerRecordKeepsKnownPart) {
+    // 比本地定义多追加了字段的记录
+    struct NewerPosition {
+        PositionRecord known;
+        double appended;
+    } newer{};
+    newer.known.version = lmdb_records::kPositionVersion + 1;
+    newer.known.vol = 300;
+    newer.known.avg_cost = 10.25;
+    newer.appended = 42;
+
+    PositionRecord read;
+    ASSERT_TRUE(lmdb_records::Decode(&newer, sizeof(newer), &read));
+    EXPECT_EQ(read.version, lmdb_records::kPositionVersion + 1);
+    EXPECT_EQ(read.vol, 300);
+    EXPECT_EQ(read.avg_cost, 10.25);
+}
+
+// === LMDBClient 读写 ===
+
+TEST(LmdbRecords, PutAndGetRoundTrip) {
+    LMDBClient db;
+    ASSERT_TRUE(db.Initialize(FreshDbPath("records_round_trip"), 16));
+
+    PositionRecord position;
+    position.vol = 1000;
+    position.available_vol = 600;
+    position.avg_cost = 8.88;
+    ASSERT_TRUE(db.PutPosition("600000", position));
+
+    PositionRecord read_position;
+    ASSERT_TRUE(db.GetPosition("600000", &read_position));
+    EXPECT_EQ(read_position.version, lmdb_records::kPositionVersion);
+    EXPECT_NE(read_position.updated_ms, 0);
+    EXPECT_EQ(read_position.vol, 1000);
+    EXPECT_EQ(read_position.available_vol, 600);
+    EXPECT_EQ(read_position.avg_cost, 8.88);
+    EXPECT_FALSE(db.GetPosition("000001", &read_position));
+
+    AccountRecord account;
+    account.total_asset = 100000;
+    account.cash = 40000;
+    account.updated_ms = 123;
+    ASSERT_TRUE(db.PutAccount(account));
+    AccountRecord read_account;
+    ASSERT_TRUE(db.GetAccount(&read_account));
+    EXPECT_EQ(read_account.updated_ms, 123);
+    EXPECT_EQ(read_account.total_asset, 100000);
+    EXPECT_EQ(read_account.cash, 40000);
+    db.Close();
+}
+
+TEST(LmdbRecords, FallsBackToLegacyKeysAndMigrates) {
+    LMDBClient db;
+    ASSERT_TRUE(db.Initialize(FreshDbPath("records_legacy"), 16));
+    ASSERT_TRUE(db.PutDouble("positions:600000:vol", 500));
+    ASSERT_TRUE(db.PutDouble("positions:600000:avg_cost", 12.5));
+    ASSERT_TRUE(db.PutDouble("account:cash", 2000));
+
+    PositionRecord position;
+    ASSERT_TRUE(db.GetPosition("600000", &position));
+    EXPECT_EQ(position.vol, 500);
+    EXPECT_EQ(position.available_vol, 0);
+    EXPECT_EQ(position.avg_cost, 12.5);
+    AccountRecord account;
+    ASSERT_TRUE(db.GetAccount(&account));
+    EXPECT_EQ(account.cash, 2000);
+
+    // 一条持仓、一条账户
+    EXPECT_EQ(db.MigrateLegacyRecords(true), 2);
+    EXPECT_FALSE(db.Exists("positions:600000:vol"));
+    EXPECT_FALSE(db.Exists("account:cash"));
+    EXPECT_TRUE(db.Exists(lmdb_records::PositionKey("600000")));
+
+    PositionRecord migrated;
+    ASSERT_TRUE(db.GetPosition("600000", &migrated));
+    EXPECT_EQ(migrated.vol, 500);
+    EXPECT_EQ(migrated.avg_cost, 12.5);
+    db.Close();
+}
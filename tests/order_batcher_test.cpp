@@ -0,0 +1,100 @@
+﻿#include "order_batcher.h"
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// 没有服务端：连接立即被拒，每一批都以错误完成，顺序只取决于 OrderBatcher
+OrderBatcher& WindowedBatcher() {
+    OrderBatcher& batcher = OrderBatcher::GetInstance();
+    ProtobufHttpClient::Config http;
+    http.base_url = "http://127.0.0.1:1";
+    http.timeout_ms = 5000;
+    // 窗口足够长，委托只会由 FlushGroup / FlushAll 发出
+    batcher.Configure(http, 60000, 32, 8);
+    return batcher;
+}
+
+PlaceOrder MakeOrder(const std::string& stock_code) {
+    PlaceOrder order;
+    order.set_stock_code(stock_code);
+    order.set_order_type("buy");
+    order.set_place_type("vol");
+    order.set_how_many(100);
+    order.set_price(10);
+    return order;
+}
+
+// 两只不在同一分组的股票
+std::pair<std::string, std::string> CodesInTwoGroups(const OrderBatcher& batcher) {
+    std::string first = "600000";
+    for (int code = 600001; code < 601000; ++code) {
+        std::string second = std::to_string(code);
+        if (batcher.OrderingKey(second) != batcher.OrderingKey(first)) return { first, second };
+    }
+    return { first, first };
+}
+
+} // namespace
+
+TEST(OrderBatcher, CancelAllRunsAfterEveryGroupsBatch) {
+    OrderBatcher& batcher = WindowedBatcher();
+    ASSERT_TRUE(batcher.Enabled());
+    auto [first, second] = CodesInTwoGroups(batcher);
+    ASSERT_NE(batcher.OrderingKey(first), batcher.OrderingKey(second));
+
+    std::mutex mutex;
+    std::vector<std::string> events;
+    auto record = [&mutex, &events](const std::string& event) {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back(event);
+    };
+
+    uint64_t batches_before = batcher.GetStats().batches;
+    ASSERT_TRUE(batcher.Add(MakeOrder(first), [&record, first](auto, const std::string&, auto) { record(first); }));
+    ASSERT_TRUE(batcher.Add(MakeOrder(second), [&record, second](auto, const std::string&, auto) { record(second); }));
+
+    auto done = std::make_shared<std::promise<void>>();
+    batcher.FlushAll([&record, done]() {
+        record("cancel");
+        done->set_value();
+        });
+    ASSERT_EQ(done->get_future().wait_for(15s), std::future_status::ready);
+
+    EXPECT_EQ(batcher.GetStats().batches - batches_before, 2u);
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events.back(), "cancel");
+}
+
+TEST(OrderBatcher, FlushAllRunsAtOnceWhenNothingIsOutstanding) {
+    OrderBatcher& batcher = WindowedBatcher();
+    bool ran = false;
+    batcher.FlushAll([&ran]() { ran = true; });
+    EXPECT_TRUE(ran);
+}
+
+// 连接被拒：请求没有离开本进程，每笔委托都应收到 NotSent，AUTO_TRADE 据此撤销去重登记
+TEST(OrderBatcher, RefusedBatchReportsNotSent) {
+    OrderBatcher& batcher = WindowedBatcher();
+    using SendPhase = ProtobufHttpClient::SendPhase;
+
+    auto done = std::make_shared<std::promise<std::pair<std::string, SendPhase>>>();
+    ASSERT_TRUE(batcher.Add(MakeOrder("600000"), [done](auto response, const std::string& error, SendPhase phase) {
+        done->set_value({ error, phase });
+        }));
+    batcher.FlushGroup("600000");
+
+    auto future = done->get_future();
+    ASSERT_EQ(future.wait_for(15s), std::future_status::ready);
+    auto [error, phase] = future.get();
+    EXPECT_FALSE(error.empty());
+    EXPECT_EQ(phase, SendPhase::NotSent);
+}
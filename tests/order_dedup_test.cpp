@@ -0,0 +1,86 @@
+﻿#include "LMDBClient.h"
+#include "order_dedup.h"
+#include "test_util.h"
+#include "write_combiner.h"
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr int kTradeDate = 20261016;
+constexpr size_t kSlots = 1024;
+
+// 表只有 1024 个槽位，指纹持久化到共享库
+OrderDedup& Dedup() {
+    OrderDedup& dedup = OrderDedup::GetInstance();
+    dedup.Configure(true, kSlots, &SharedDb(), &WriteCombiner::GetInstance());
+    return dedup;
+}
+
+// 起始槽位为 home 的第 n 个指纹；各用例用不同的 tag 区分
+uint64_t FingerprintAt(uint64_t tag, uint64_t n, size_t home) {
+    return (tag << 48) | (n << 10) | home;
+}
+
+} // namespace
+
+TEST(OrderDedup, ReleasedSlotsAreReused) {
+    OrderDedup& dedup = Dedup();
+    uint64_t overflow_before = dedup.GetStats().overflow;
+
+    // 同一条探测链上反复登记、撤销，远超探测长度；墓碑不复用时很快就表满
+    for (uint64_t n = 1; n <= 2000; ++n) {
+        uint64_t fingerprint = FingerprintAt(1, n, 261);
+        ASSERT_TRUE(dedup.TryClaim(fingerprint, kTradeDate));
+        EXPECT_FALSE(dedup.TryClaim(fingerprint, kTradeDate));
+        dedup.Release(fingerprint);
+    }
+    EXPECT_EQ(dedup.GetStats().overflow, overflow_before);
+
+    // 撤销后可以再次登记
+    uint64_t fingerprint = FingerprintAt(1, 1, 261);
+    EXPECT_TRUE(dedup.TryClaim(fingerprint, kTradeDate));
+    EXPECT_FALSE(dedup.TryClaim(fingerprint, kTradeDate));
+    dedup.Release(fingerprint);
+}
+
+TEST(OrderDedup, ManyTombstonesTriggerRehash) {
+    OrderDedup& dedup = Dedup();
+    uint64_t rehashes_before = dedup.GetStats().rehashes;
+
+    uint64_t kept = FingerprintAt(2, 1, 7);
+    ASSERT_TRUE(dedup.TryClaim(kept, kTradeDate));
+    for (size_t home = 0; home < kSlots / 2; ++home) {
+        uint64_t fingerprint = FingerprintAt(2, 2, home);
+        ASSERT_TRUE(dedup.TryClaim(fingerprint, kTradeDate));
+        dedup.Release(fingerprint);
+    }
+    EXPECT_GT(dedup.GetStats().rehashes, rehashes_before);
+
+    // 重排后仍然登记着的指纹照样被拦下
+    EXPECT_FALSE(dedup.TryClaim(kept, kTradeDate));
+    dedup.Release(kept);
+}
+
+TEST(OrderDedup, PersistsThroughWriteCombiner) {
+    OrderDedup& dedup = Dedup();
+    LMDBClient& db = SharedDb();
+    WriteCombiner& writes = WriteCombiner::GetInstance();
+
+    uint64_t fingerprint = FingerprintAt(3, 1, 100);
+    std::string key = std::format("dedup:{:016x}", fingerprint);
+    ASSERT_TRUE(dedup.TryClaim(fingerprint, kTradeDate));
+    ASSERT_TRUE(writes.Flush(1s));
+    std::string value;
+    ASSERT_TRUE(db.Get(key, &value));
+    EXPECT_EQ(value, LMDBClient::IntToBytes(kTradeDate));
+
+    dedup.Release(fingerprint);
+    ASSERT_TRUE(writes.Flush(1s));
+    EXPECT_FALSE(db.Get(key, &value));
+}
@@ -0,0 +1,109 @@
+﻿#include "LMDBClient.h"
+#include "read_cache.h"
+#include "test_util.h"
+#include "write_combiner.h"
+#include <chrono>
+#include <thread>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// 写入放到另一个线程，与其他进程提交一样，只能靠事务号发现
+template <typename Fn>
+void WriteFromOtherThread(Fn fn) {
+    std::thread writer(fn);
+    writer.join();
+}
+
+} // namespace
+
+TEST(ReadCache, RepeatedReadsHit) {
+    LMDBClient& db = SharedDb();
+    ReadCache& cache = ReadCache::GetInstance();
+    ASSERT_TRUE(cache.Enabled());
+    ASSERT_TRUE(db.PutDouble("key:rc:hot", 4.25));
+
+    // 线程私有计数每 1024 次汇总一次，读满两轮
+    ReadCache::Stats before = cache.GetStats();
+    double value = 0;
+    for (int i = 0; i < 2048; ++i) {
+        ASSERT_TRUE(cache.GetDouble("key:rc:hot", &value));
+        ASSERT_EQ(value, 4.25);
+    }
+    ReadCache::Stats after = cache.GetStats();
+    EXPECT_GE(after.hits - before.hits, 1000u);
+    EXPECT_LE(after.misses - before.misses, 2u);
+}
+
+TEST(ReadCache, CommitInvalidatesCachedValues) {
+    LMDBClient& db = SharedDb();
+    ReadCache& cache = ReadCache::GetInstance();
+    ASSERT_TRUE(db.PutDouble("key:rc:price", 10));
+    ASSERT_TRUE(db.Put("rc:count", LMDBClient::IntToBytes(1)));
+    ASSERT_TRUE(db.AtomicSetStringBit("rc:bits", 5, true));
+
+    double price = 0;
+    int count = 0;
+    bool bit = false;
+    ASSERT_TRUE(cache.GetDouble("key:rc:price", &price));
+    ASSERT_TRUE(cache.GetInt("rc:count", &count));
+    ASSERT_TRUE(cache.GetStringBit("rc:bits", 5, &bit));
+    EXPECT_EQ(price, 10);
+    EXPECT_EQ(count, 1);
+    EXPECT_TRUE(bit);
+
+    WriteFromOtherThread([&db]() {
+        db.PutDouble("key:rc:price", 11);
+        db.AtomicIncrement("rc:count", 2);
+        db.AtomicSetStringBit("rc:bits", 5, false);
+        });
+
+    ASSERT_TRUE(cache.GetDouble("key:rc:price", &price));
+    ASSERT_TRUE(cache.GetInt("rc:count", &count));
+    ASSERT_TRUE(cache.GetStringBit("rc:bits", 5, &bit));
+    EXPECT_EQ(price, 11);
+    EXPECT_EQ(count, 3);
+    EXPECT_FALSE(bit);
+
+    // 删除同样可见
+    WriteFromOtherThread([&db]() { db.Delete("key:rc:price"); });
+    EXPECT_FALSE(cache.GetDouble("key:rc:price", &price));
+}
+
+TEST(ReadCache, MissingKeyBecomesVisibleAfterWrite) {
+    LMDBClient& db = SharedDb();
+    ReadCache& cache = ReadCache::GetInstance();
+
+    double value = 0;
+    EXPECT_FALSE(cache.GetDouble("key:rc:late", &value));
+    EXPECT_FALSE(cache.GetDouble("key:rc:late", &value));
+
+    WriteFromOtherThread([&db]() { db.PutDouble("key:rc:late", 7); });
+    ASSERT_TRUE(cache.GetDouble("key:rc:late", &value));
+    EXPECT_EQ(value, 7);
+}
+
+TEST(ReadCache, CombinedWritesInvalidateAfterCommit) {
+    ReadCache& cache = ReadCache::GetInstance();
+    WriteCombiner& writes = WriteCombiner::GetInstance();
+    ASSERT_TRUE(writes.PutDouble("key:rc:combined", 1));
+    ASSERT_TRUE(writes.Flush(1s));
+
+    double value = 0;
+    ASSERT_TRUE(writes.GetDouble("key:rc:combined", &value));
+    ASSERT_TRUE(cache.GetDouble("key:rc:combined", &value));
+    EXPECT_EQ(value, 1);
+
+    // 未提交时经 WriteCombiner 读到新值，缓存里仍是库里的值；提交后缓存失效
+    ASSERT_TRUE(writes.PutDouble("key:rc:combined", 2));
+    ASSERT_TRUE(writes.GetDouble("key:rc:combined", &value));
+    EXPECT_EQ(value, 2);
+    ASSERT_TRUE(cache.GetDouble("key:rc:combined", &value));
+    EXPECT_EQ(value, 1);
+
+    ASSERT_TRUE(writes.Flush(1s));
+    ASSERT_TRUE(cache.GetDouble("key:rc:combined", &value));
+    EXPECT_EQ(value, 2);
+}
@@ -0,0 +1,107 @@
+﻿#include "LMDBClient.h"
+#include "test_util.h"
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace {
+
+std::vector<std::pair<std::string, std::string>> Collect(LMDBClient::PrefixCursor cursor) {
+    std::vector<std::pair<std::string, std::string>> entries;
+    for (const auto& [suffix, value] : cursor) entries.emplace_back(suffix, value);
+    return entries;
+}
+
+} // namespace
+
+TEST(ReadScope, ReadsViewsFromOneSnapshot) {
+    LMDBClient db;
+    ASSERT_TRUE(db.Initialize(FreshDbPath("read_scope_snapshot"), 16));
+    ASSERT_TRUE(db.Put("plain", "hello"));
+    ASSERT_TRUE(db.PutDouble("key:acct:cash", 12.5));
+    ASSERT_TRUE(db.Put("blk_size:7", LMDBClient::IntToBytes(3)));
+
+    LMDBClient::ReadScope scope(db);
+    ASSERT_TRUE(scope.ok());
+    EXPECT_EQ(scope.TxnId(), db.LastTxnId());
+
+    std::string_view text;
+    ASSERT_TRUE(scope.Get("plain", &text));
+    EXPECT_EQ(text, "hello");
+    double number = 0;
+    ASSERT_TRUE(scope.GetDouble("key:acct:cash", &number));
+    EXPECT_EQ(number, 12.5);
+    int integer = 0;
+    ASSERT_TRUE(scope.GetInt("blk_size:7", &integer));
+    EXPECT_EQ(integer, 3);
+    EXPECT_FALSE(scope.Get("missing", &text));
+    // 长度不对不算 double
+    EXPECT_FALSE(scope.GetDouble("plain", &number));
+
+    // 其他线程提交之后，scope 仍读原快照；本线程的普通读也钉在同一快照上
+    std::thread writer([&db]() { db.Put("plain", "changed"); });
+    writer.join();
+    EXPECT_GT(db.LastTxnId(), scope.TxnId());
+    ASSERT_TRUE(scope.Get("plain", &text));
+    EXPECT_EQ(text, "hello");
+    std::string copy;
+    ASSERT_TRUE(db.Get("plain", &copy));
+    EXPECT_EQ(copy, "hello");
+}
+
+TEST(ReadScope, SeesLatestCommitAfterScopeEnds) {
+    LMDBClient db;
+    ASSERT_TRUE(db.Initialize(FreshDbPath("read_scope_renew"), 16));
+    ASSERT_TRUE(db.Put("plain", "v1"));
+    {
+        LMDBClient::ReadScope scope(db);
+        std::string_view text;
+        ASSERT_TRUE(scope.Get("plain", &text));
+        EXPECT_EQ(text, "v1");
+    }
+    std::thread writer([&db]() { db.Put("plain", "v2"); });
+    writer.join();
+
+    std::string value;
+    ASSERT_TRUE(db.Get("plain", &value));
+    EXPECT_EQ(value, "v2");
+    LMDBClient::ReadScope scope(db);
+    EXPECT_EQ(scope.TxnId(), db.LastTxnId());
+}
+
+TEST(ReadScope, PrefixCursorWalksNamespaces) {
+    LMDBClient db;
+    ASSERT_TRUE(db.Initialize(FreshDbPath("read_scope_prefix"), 16));
+    ASSERT_TRUE(db.PutDouble("key:acct:b", 2));
+    ASSERT_TRUE(db.PutDouble("key:acct:a", 1));
+    ASSERT_TRUE(db.PutDouble("key:other:a", 9));
+    ASSERT_TRUE(db.Put("BLK_600001", "y"));
+    ASSERT_TRUE(db.Put("BLK_600000", "x"));
+    ASSERT_TRUE(db.Put("BLK_000001", "z"));
+    ASSERT_TRUE(db.Put("positions:600000:vol", "p"));
+
+    LMDBClient::ReadScope scope(db);
+    ASSERT_TRUE(scope.ok());
+
+    auto user = Collect(scope.Prefix("key:acct:"));
+    ASSERT_EQ(user.size(), 2u);
+    EXPECT_EQ(user[0].first, "a");
+    EXPECT_EQ(user[1].first, "b");
+    EXPECT_EQ(LMDBClient::BytesToDouble(user[1].second), 2);
+
+    // 整数 key 的命名空间按数值顺序，suffix 还原成原来的文本
+    auto blocks = Collect(scope.Prefix("BLK_6"));
+    ASSERT_EQ(blocks.size(), 2u);
+    EXPECT_EQ(blocks[0].first, "00000");
+    EXPECT_EQ(blocks[0].second, "x");
+    EXPECT_EQ(blocks[1].first, "00001");
+
+    auto legacy = Collect(scope.Prefix("positions:"));
+    ASSERT_EQ(legacy.size(), 1u);
+    EXPECT_EQ(legacy[0].first, "600000:vol");
+
+    EXPECT_TRUE(Collect(scope.Prefix("nothing:")).empty());
+}
@@ -0,0 +1,41 @@
+﻿// YdFuncTests：DLL 内部组件的单元测试（gtest）
+// 在 YdFunc.sln 里编译 YdFuncTests 项目后直接运行 YdFuncTests.exe，或在 VS 的测试资源管理器里运行
+#include "test_util.h"
+#include "LMDBClient.h"
+#include "read_cache.h"
+#include "runtime_shutdown.h"
+#include "write_combiner.h"
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <system_error>
+#include <gtest/gtest.h>
+
+std::string FreshDbPath(const std::string& name) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "yd_func_tests" / name;
+    std::error_code ec;
+    std::filesystem::remove_all(path, ec);
+    std::filesystem::create_directories(path, ec);
+    return path.string();
+}
+
+LMDBClient& SharedDb() {
+    LMDBClient& db = LMDBClient::GetInstance();
+    static std::once_flag flag;
+    std::call_once(flag, [&db]() {
+        db.Initialize(FreshDbPath("shared"), 64);
+        ReadCache& cache = ReadCache::GetInstance();
+        cache.Configure(&db, true, 4096);
+        WriteCombiner::GetInstance().Configure(&db, true, 256, 20, &cache);
+        });
+    return db;
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    // 与导出函数 SHUTDOWN 相同的排空顺序；后台线程全部退出之后再析构单例、关库
+    ShutdownRuntime(std::chrono::seconds(10));
+    LMDBClient::GetInstance().Close();
+    return result;
+}
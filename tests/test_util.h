@@ -0,0 +1,13 @@
+﻿#pragma once
+
+#include <string>
+
+class LMDBClient;
+
+// 系统临时目录下 yd_func_tests\<name> 的空目录（已有内容先删掉），测试在里面打开 LMDB 环境
+// 每个用例用不同的 name，互不影响
+std::string FreshDbPath(const std::string& name);
+
+// 单例组件（ReadCache / WriteCombiner）共用的库：LMDBClient::GetInstance()，第一次调用时在 FreshDbPath("shared") 打开，
+// 按 GetWrites 的方式配置读缓存和合并写；合并写开启、凑批时间片 20ms，写完立即读基本都落在未提交的 overlay 上
+LMDBClient& SharedDb();
@@ -0,0 +1,71 @@
+﻿#include "protobuf_http_client.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+
+// transport = unix 的冒烟测试：经 tools/mock_qmt_api.py --unix 走一遍真实的 HTTP 往返
+// YD_TEST_QMT_UNIX 为 mock 监听的套接字路径，未设置时跳过：
+//     python tools/mock_qmt_api.py --unix qmt_api.sock
+//     set YD_TEST_QMT_UNIX=qmt_api.sock
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::unique_ptr<ProtobufHttpClient> UnixClient() {
+    const char* path = std::getenv("YD_TEST_QMT_UNIX");
+    if (!path || !*path) return nullptr;
+    ProtobufHttpClient::Config config;
+    config.base_url = "http://qmt_api";   // 主机名只用于 Host 头
+    config.timeout_ms = 5000;
+    config.transport = "unix";
+    config.unix_socket_path = path;
+    return std::make_unique<ProtobufHttpClient>(config);
+}
+
+PlaceOrder MakeOrder(const std::string& stock_code) {
+    PlaceOrder order;
+    order.set_stock_code(stock_code);
+    order.set_order_type("buy");
+    order.set_how_many(100);
+    order.set_price(10);
+    return order;
+}
+
+} // namespace
+
+TEST(UnixTransport, PlacesSingleOrder) {
+    auto client = UnixClient();
+    if (!client) GTEST_SKIP() << "YD_TEST_QMT_UNIX not set";
+
+    auto response = client->post<PlaceOrder, PlaceOrderResponse>("/place_order/vol", MakeOrder("600000"));
+    ASSERT_NE(response, nullptr);
+    EXPECT_EQ(response->status(), "success");
+    EXPECT_NE(response->msg().find("600000"), std::string::npos);
+}
+
+// 合批走异步路径（与 OrderBatcher 相同）
+TEST(UnixTransport, PlacesBatchAsync) {
+    auto client = UnixClient();
+    if (!client) GTEST_SKIP() << "YD_TEST_QMT_UNIX not set";
+
+    PlaceOrderBatch batch;
+    batch.set_batch_id("unix-smoke");
+    *batch.add_orders() = MakeOrder("600000");
+    *batch.add_orders() = MakeOrder("000001");
+    auto done = std::make_shared<std::promise<std::unique_ptr<PlaceOrderBatchResponse>>>();
+    client->async_post<PlaceOrderBatch, PlaceOrderBatchResponse>("/place_order/batch", batch,
+        [done](std::unique_ptr<PlaceOrderBatchResponse> response, const std::string& error, ProtobufHttpClient::SendPhase) {
+            EXPECT_EQ(error, "");
+            done->set_value(std::move(response));
+        });
+    auto future = done->get_future();
+    ASSERT_EQ(future.wait_for(10s), std::future_status::ready);
+    auto response = future.get();
+    ASSERT_NE(response, nullptr);
+    EXPECT_EQ(response->status(), "success");
+    EXPECT_EQ(response->results_size(), 2);
+}
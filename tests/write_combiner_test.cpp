@@ -0,0 +1,111 @@
+﻿#include "LMDBClient.h"
+#include "test_util.h"
+#include "write_combiner.h"
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+// === 读己之写 ===
+
+TEST(WriteCombiner, ReadsOwnPendingWrites) {
+    LMDBClient& db = SharedDb();
+    WriteCombiner& writes = WriteCombiner::GetInstance();
+    ASSERT_TRUE(writes.Enabled());
+
+    ASSERT_TRUE(writes.PutDouble("key:wc:a", 1.5));
+    ASSERT_TRUE(writes.IncrementDouble("key:wc:a", 2.0));
+    ASSERT_TRUE(writes.Increment("wc:count", 3));
+    ASSERT_TRUE(writes.Increment("wc:count", 4));
+    ASSERT_TRUE(writes.SetStringBit("wc:bits", 9, true));
+
+    double number = 0;
+    int integer = 0;
+    bool bit = false;
+    ASSERT_TRUE(writes.GetDouble("key:wc:a", &number));
+    EXPECT_EQ(number, 3.5);
+    ASSERT_TRUE(writes.GetInt("wc:count", &integer));
+    EXPECT_EQ(integer, 7);
+    ASSERT_TRUE(writes.GetStringBit("wc:bits", 9, &bit));
+    EXPECT_TRUE(bit);
+    ASSERT_TRUE(writes.GetStringBit("wc:bits", 8, &bit));
+    EXPECT_FALSE(bit);
+
+    ASSERT_TRUE(writes.Delete("key:wc:a"));
+    EXPECT_FALSE(writes.GetDouble("key:wc:a", &number));
+
+    ASSERT_TRUE(writes.Flush(1s));
+    EXPECT_FALSE(db.Exists("key:wc:a"));
+    ASSERT_TRUE(db.GetInt("wc:count", &integer));
+    EXPECT_EQ(integer, 7);
+}
+
+TEST(WriteCombiner, AggregateIncludesPendingWrites) {
+    LMDBClient& db = SharedDb();
+    WriteCombiner& writes = WriteCombiner::GetInstance();
+    ASSERT_TRUE(db.PutDouble("key:agg:x", 1));
+    ASSERT_TRUE(db.PutDouble("key:agg:y", 2));
+
+    // y 被改写、z 新增，都还没提交
+    ASSERT_TRUE(writes.PutDouble("key:agg:y", 5));
+    ASSERT_TRUE(writes.PutDouble("key:agg:z", 10));
+
+    LMDBClient::Aggregate aggregate;
+    ASSERT_TRUE(writes.AggregateDoubles("key:agg:", &aggregate));
+    EXPECT_EQ(aggregate.count, 3u);
+    EXPECT_EQ(aggregate.sum, 16);
+    EXPECT_EQ(aggregate.min, 1);
+    EXPECT_EQ(aggregate.max, 10);
+    ASSERT_TRUE(writes.Flush(1s));
+}
+
+// === 多线程 ===
+
+TEST(WriteCombiner, FlushCommitsOtherThreadsWrites) {
+    LMDBClient& db = SharedDb();
+    WriteCombiner& writes = WriteCombiner::GetInstance();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&writes]() {
+            for (int i = 0; i < 500; ++i) writes.IncrementDouble("key:wc:total", 1.0);
+            });
+    }
+    for (auto& thread : threads) thread.join();
+
+    ASSERT_TRUE(writes.Flush(5s));
+    double total = 0;
+    ASSERT_TRUE(db.GetDouble("key:wc:total", &total));
+    EXPECT_EQ(total, 2000);
+}
+
+// === 提交失败 ===
+
+TEST(WriteCombiner, FailedMutationIsDroppedAlone) {
+    LMDBClient& db = SharedDb();
+    WriteCombiner& writes = WriteCombiner::GetInstance();
+    WriteCombiner::Stats before = writes.GetStats();
+
+    // 超过 LMDB 的 key 长度上限（511 字节），单独提交也会失败；同一批里的其他变更不受影响
+    std::string bad(600, 'x');
+    ASSERT_TRUE(writes.PutDouble("key:wc:ok1", 1));
+    ASSERT_TRUE(writes.PutDouble(bad, 2));
+    ASSERT_TRUE(writes.PutDouble("key:wc:ok2", 3));
+    writes.Flush(1s);
+
+    WriteCombiner::Stats after = writes.GetStats();
+    EXPECT_EQ(after.dropped - before.dropped, 1u);
+    EXPECT_GE(after.failed_batches - before.failed_batches, 1u);
+
+    double value = 0;
+    ASSERT_TRUE(db.GetDouble("key:wc:ok1", &value));
+    EXPECT_EQ(value, 1);
+    ASSERT_TRUE(db.GetDouble("key:wc:ok2", &value));
+    EXPECT_EQ(value, 3);
+    // 丢弃之后 overlay 不再叠加它
+    EXPECT_FALSE(writes.HasPending(bad));
+    EXPECT_FALSE(writes.GetDouble(bad, &value));
+}
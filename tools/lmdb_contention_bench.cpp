@@ -0,0 +1,124 @@
+﻿// LMDBClient 读写争用压测
+//
+// N 个读线程循环 GetAccount 读账户记录，1 个写线程循环 PutAccount 改写 cash，
+// 统计固定时长内的读 / 写吞吐和读延迟分位数。用来对比读路径去掉 shared_mutex 前后的差别：
+// 分别在改动前后的提交上编译运行，参数相同，比较输出即可。
+//
+// 编译（x64 Native Tools 命令行，vcpkg 已安装 lmdb）：
+//   cl /std:c++latest /O2 /EHsc /utf-8 /I..\YdFunc /I%VCPKG_ROOT%\installed\x64-windows\include
+//      lmdb_contention_bench.cpp ..\YdFunc\LMDBClient.cpp ..\YdFunc\block_bitmap.cpp ..\YdFunc\bitset_kernels.cpp
+//      /link /LIBPATH:%VCPKG_ROOT%\installed\x64-windows\lib lmdb.lib
+//
+// 运行：lmdb_contention_bench.exe <db_path> [readers=8] [seconds=5] [writer=1]
+//   writer=0 时只测纯读，可以单独看读锁本身的开销
+
+#include "LMDBClient.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct ReaderResult {
+    uint64_t reads = 0;
+    std::vector<uint32_t> samples_ns; // 每 64 次读采样一次延迟
+};
+
+double Percentile(std::vector<uint32_t>& samples, double q) {
+    if (samples.empty()) return 0.0;
+    size_t index = static_cast<size_t>(q * (samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <db_path> [readers=8] [seconds=5] [writer=1]\n", argv[0]);
+        return 1;
+    }
+    const std::string db_path = argv[1];
+    const int readers = argc > 2 ? std::atoi(argv[2]) : 8;
+    const int seconds = argc > 3 ? std::atoi(argv[3]) : 5;
+    const bool with_writer = argc > 4 ? std::atoi(argv[4]) != 0 : true;
+
+    LMDBClient& db = LMDBClient::GetInstance();
+    if (!db.Initialize(db_path, 256)) {
+        std::fprintf(stderr, "Initialize failed: %s\n", db_path.c_str());
+        return 1;
+    }
+    lmdb_records::AccountRecord seed;
+    seed.total_asset = seed.frozen_cash = seed.cash = seed.market_value = 1.0;
+    db.PutAccount(seed);
+
+    std::atomic<bool> start{ false };
+    std::atomic<bool> stop{ false };
+    std::vector<ReaderResult> results(readers);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < readers; ++i) {
+        threads.emplace_back([&, i]() {
+            ReaderResult& result = results[i];
+            lmdb_records::AccountRecord account;
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            while (!stop.load(std::memory_order_relaxed)) {
+                if ((result.reads & 63) == 0) {
+                    auto t0 = std::chrono::steady_clock::now();
+                    db.GetAccount(&account);
+                    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - t0).count();
+                    result.samples_ns.push_back(static_cast<uint32_t>(std::min<long long>(ns, UINT32_MAX)));
+                }
+                else {
+                    db.GetAccount(&account);
+                }
+                ++result.reads;
+            }
+            });
+    }
+
+    uint64_t writes = 0;
+    std::thread writer;
+    if (with_writer) {
+        writer = std::thread([&]() {
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            while (!stop.load(std::memory_order_relaxed)) {
+                lmdb_records::AccountRecord account;
+                db.GetAccount(&account);
+                account.cash += 1.0;
+                if (db.PutAccount(account)) ++writes;
+            }
+            });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& t : threads) t.join();
+    if (writer.joinable()) writer.join();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    uint64_t reads = 0;
+    std::vector<uint32_t> samples;
+    for (auto& r : results) {
+        reads += r.reads;
+        samples.insert(samples.end(), r.samples_ns.begin(), r.samples_ns.end());
+    }
+
+    std::printf("readers=%d seconds=%.2f writer=%d\n", readers, elapsed, with_writer ? 1 : 0);
+    std::printf("reads:  %.0f/s (%.0f/s per thread)\n", reads / elapsed, reads / elapsed / std::max(readers, 1));
+    std::printf("writes: %.0f/s\n", writes / elapsed);
+    std::printf("read latency ns: p50=%.0f p99=%.0f p999=%.0f\n",
+        Percentile(samples, 0.50), Percentile(samples, 0.99), Percentile(samples, 0.999));
+
+    db.Close();
+    return 0;
+}
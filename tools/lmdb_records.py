@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+LMDB 持仓 / 账户定长记录的打包与解包，与 YdFunc/lmdb_records.h 保持一致。
+
+写入方（qmt_api）用一次 put 写整条记录即可原子更新：
+
+    from lmdb_records import position_key, pack_position, ACCOUNT_KEY, pack_account
+    with env.begin(write=True) as txn:
+        txn.put(position_key("SH.600000"), pack_position(vol=1000, available_vol=800, avg_cost=10.5))
+        txn.put(ACCOUNT_KEY, pack_account(total_asset=1e6, frozen_cash=0, cash=5e5, market_value=5e5))
+
+布局（小端）：u16 version, u16 reserved, u32 reserved, i64 updated_ms, 之后为 double 字段。
+字段只追加不修改，追加时 version 加一。
+"""
+
+import struct
+import time
+
+POSITION_VERSION = 1
+ACCOUNT_VERSION = 1
+
+POSITION_PREFIX = b"record:position:"
+ACCOUNT_KEY = b"record:account"
+
+_HEADER = "<HHIq"
+_POSITION = struct.Struct(_HEADER + "3d")   # 40 字节
+_ACCOUNT = struct.Struct(_HEADER + "4d")    # 48 字节
+
+POSITION_FIELDS = ("vol", "available_vol", "avg_cost")
+ACCOUNT_FIELDS = ("total_asset", "frozen_cash", "cash", "market_value")
+
+
+def _now_ms():
+    return int(time.time() * 1000)
+
+
+def position_key(stock_code):
+    return POSITION_PREFIX + stock_code.encode("ascii")
+
+
+def pack_position(vol, available_vol, avg_cost, updated_ms=None):
+    return _POSITION.pack(POSITION_VERSION, 0, 0, updated_ms or _now_ms(),
+                          float(vol), float(available_vol), float(avg_cost))
+
+
+def pack_account(total_asset, frozen_cash, cash, market_value, updated_ms=None):
+    return _ACCOUNT.pack(ACCOUNT_VERSION, 0, 0, updated_ms or _now_ms(),
+                         float(total_asset), float(frozen_cash), float(cash), float(market_value))
+
+
+def _unpack(layout, fields, data):
+    # 与 C++ 端相同：按实际长度读取，缺的字段补 0，更新版本多出的字段忽略
+    if len(data) < 16:
+        raise ValueError("record too short: %d bytes" % len(data))
+    padded = bytes(data[:layout.size]).ljust(layout.size, b"\0")
+    version, _, _, updated_ms, *values = layout.unpack(padded)
+    if version == 0:
+        raise ValueError("record version is 0")
+    record = dict(zip(fields, values))
+    record["version"] = version
+    record["updated_ms"] = updated_ms
+    return record
+
+
+def unpack_position(data):
+    return _unpack(_POSITION, POSITION_FIELDS, data)
+
+
+def unpack_account(data):
+    return _unpack(_ACCOUNT, ACCOUNT_FIELDS, data)
@@ -0,0 +1,387 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+qmt_api 本地替身，用于离线调试 YdFunc 的下单路径（逐笔和合批）。
+
+只依赖 Python 标准库，按 little_goal.proto 手工编解码，不需要 protoc 生成代码。
+
+    python tools/mock_qmt_api.py --port 8000 --delay-ms 1
+    python tools/mock_qmt_api.py --unix qmt_api.sock        # 对应 transport = unix，需要支持 AF_UNIX 的 Python
+    python tools/mock_qmt_api.py --shm qmt_api_shm          # 仅 Windows，对应 transport = shm
+
+config.ini:
+    [http]
+    base_url = http://127.0.0.1:8000
+    batch_window_ms = 2
+    batch_max = 32
+    transport = shm          ; 可选 tcp / unix / shm
+    unix_socket_path = qmt_api.sock   ; 与 --unix 一致；base_url 的主机名仍写在 Host 头里
+    shm_name = qmt_api_shm
+    shm_ring_kb = 1024       ; 需与 --shm-ring-kb 一致
+
+支持的接口：
+    POST /place_order/amount|vol|percent   PlaceOrder      -> PlaceOrderResponse
+    POST /place_order/batch                PlaceOrderBatch -> PlaceOrderBatchResponse
+    GET  /stats                            纯文本统计
+"""
+
+import argparse
+import os
+import socket
+import socketserver
+import struct
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+
+# === protobuf 编解码（仅覆盖本文件用到的字段类型） ===
+
+def _read_varint(buf, pos):
+    result = shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        result |= (b & 0x7F) << shift
+        if not b & 0x80:
+            return result, pos
+        shift += 7
+
+
+def _write_varint(value):
+    out = bytearray()
+    value &= (1 << 64) - 1
+    while True:
+        b = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def decode(buf):
+    """返回 {field_number: [raw_value, ...]}，length-delimited 字段保留为 bytes"""
+    fields = {}
+    pos = 0
+    while pos < len(buf):
+        key, pos = _read_varint(buf, pos)
+        number, wire = key >> 3, key & 7
+        if wire == 0:
+            value, pos = _read_varint(buf, pos)
+        elif wire == 1:
+            value = struct.unpack_from("<d", buf, pos)[0]
+            pos += 8
+        elif wire == 2:
+            length, pos = _read_varint(buf, pos)
+            value = bytes(buf[pos:pos + length])
+            pos += length
+        elif wire == 5:
+            value = buf[pos:pos + 4]
+            pos += 4
+        else:
+            raise ValueError("unsupported wire type %d" % wire)
+        fields.setdefault(number, []).append(value)
+    return fields
+
+
+def _string(number, value):
+    data = value.encode("utf-8")
+    return _write_varint(number << 3 | 2) + _write_varint(len(data)) + data
+
+
+def _message(number, data):
+    return _write_varint(number << 3 | 2) + _write_varint(len(data)) + data
+
+
+def _last_str(fields, number):
+    return fields.get(number, [b""])[-1].decode("utf-8")
+
+
+def _last_int(fields, number):
+    value = fields.get(number, [0])[-1]
+    return value - (1 << 64) if value >= 1 << 63 else value
+
+
+def _last_double(fields, number):
+    return fields.get(number, [0.0])[-1]
+
+
+def parse_place_order(buf):
+    f = decode(buf)
+    return {
+        "account_id": _last_str(f, 1),
+        "stock_code": _last_str(f, 2),
+        "how_many": _last_int(f, 3),
+        "price": _last_double(f, 4),
+        "order_type": _last_str(f, 5),
+        "place_type": _last_str(f, 6),
+    }
+
+
+def encode_place_order_response(status, msg):
+    return _string(1, status) + _string(2, msg)
+
+
+# === 服务端 ===
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.requests = 0
+        self.batches = 0
+        self.orders = 0
+        self.max_batch = 0
+
+    def record(self, orders, batch):
+        with self.lock:
+            self.requests += 1
+            self.orders += orders
+            if batch:
+                self.batches += 1
+                self.max_batch = max(self.max_batch, orders)
+
+    def text(self):
+        with self.lock:
+            return "requests=%d orders=%d batches=%d max_batch=%d\n" % (
+                self.requests, self.orders, self.batches, self.max_batch)
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # keep-alive，与客户端的连接复用一致
+    stats = Stats()
+    delay_ms = 0.0
+    reject_every = 0
+    verbose = False
+    _seq = 0
+    _seq_lock = threading.Lock()
+
+    @classmethod
+    def _next_seq(cls):
+        with cls._seq_lock:
+            cls._seq += 1
+            return cls._seq
+
+    def _reply(self, code, body, content_type="application/protobuf"):
+        self.send_response(code)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    @classmethod
+    def _place(cls, order):
+        """模拟单笔委托，reject_every > 0 时每 N 笔拒绝一笔"""
+        seq = cls._next_seq()
+        if cls.verbose:
+            print("order #%d %s" % (seq, order))
+        if cls.reject_every and seq % cls.reject_every == 0:
+            return encode_place_order_response("error", "mock reject #%d" % seq)
+        return encode_place_order_response(
+            "success", "%s %s %s x%d #%d" % (order["place_type"], order["order_type"],
+                                             order["stock_code"], order["how_many"], seq))
+
+    @classmethod
+    def dispatch(cls, method, path, body):
+        """HTTP 和共享内存两种传输共用的路由，返回 (状态码, 响应体)"""
+        if method == "GET":
+            if path == "/stats":
+                return 200, cls.stats.text().encode()
+            return 404, b""
+
+        if cls.delay_ms:
+            time.sleep(cls.delay_ms / 1000.0)
+
+        if path == "/place_order/batch":
+            f = decode(body)
+            orders = [parse_place_order(raw) for raw in f.get(2, [])]
+            results = b"".join(_message(2, cls._place(o)) for o in orders)
+            cls.stats.record(len(orders), batch=True)
+            if cls.verbose:
+                print("batch %s: %d orders" % (_last_str(f, 1), len(orders)))
+            return 200, _string(1, "success") + results
+        if path.startswith("/place_order/"):
+            order = parse_place_order(body)
+            order["place_type"] = path.rsplit("/", 1)[-1]
+            cls.stats.record(1, batch=False)
+            return 200, cls._place(order)
+        return 404, b""
+
+    def do_GET(self):
+        code, body = self.dispatch("GET", self.path, b"")
+        self._reply(code, body, "text/plain" if self.path == "/stats" else "application/protobuf")
+
+    def do_POST(self):
+        body = self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        code, body = self.dispatch("POST", self.path, body)
+        self._reply(code, body)
+
+    def log_message(self, fmt, *args):
+        if self.verbose:
+            BaseHTTPRequestHandler.log_message(self, fmt, *args)
+
+    def address_string(self):
+        # AF_UNIX 连接的对端地址是空字符串
+        return self.client_address[0] if self.client_address else "unix"
+
+
+# === unix 域套接字（与 transport = unix 对应，HTTP 报文与 TCP 完全相同） ===
+
+if hasattr(socket, "AF_UNIX"):
+    class ThreadingUnixHTTPServer(socketserver.ThreadingMixIn, socketserver.UnixStreamServer):
+        daemon_threads = True
+
+
+def serve_unix(path):
+    if not hasattr(socket, "AF_UNIX"):
+        raise SystemExit("this Python has no AF_UNIX support, use --port or --shm")
+    # 上次异常退出留下的套接字文件会让 bind 失败
+    if os.path.exists(path):
+        os.unlink(path)
+    server = ThreadingUnixHTTPServer(path, Handler)
+    print("mock qmt_api listening on unix:%s" % path, flush=True)
+    try:
+        server.serve_forever()
+    finally:
+        server.server_close()
+        os.unlink(path)
+
+
+# === 共享内存传输（与 YdFunc/shm_transport.h 的布局一致） ===
+
+SHM_MAGIC = 0x51544D53
+SHM_VERSION = 1
+SHM_CONTROL = 64        # 控制块：magic, version, ring_bytes；16 起为 DLL 端的请求号和生产者进程号，这里不动
+RING_HEADER = 192       # head @0, tail @64, capacity @128
+
+
+class ShmRingView:
+    """映射区里的一个 SPSC 字节环，本端只做单方向的读或写"""
+
+    def __init__(self, mm, offset):
+        self.mm = mm
+        self.offset = offset
+        self.capacity = struct.unpack_from("<I", mm, offset + 128)[0]
+        self.data = offset + RING_HEADER
+
+    def _u64(self, off):
+        return struct.unpack_from("<Q", self.mm, self.offset + off)[0]
+
+    def _copy_in(self, pos, payload):
+        i = pos % self.capacity
+        first = min(len(payload), self.capacity - i)
+        self.mm[self.data + i:self.data + i + first] = payload[:first]
+        if first < len(payload):
+            self.mm[self.data:self.data + len(payload) - first] = payload[first:]
+
+    def _copy_out(self, pos, n):
+        i = pos % self.capacity
+        first = min(n, self.capacity - i)
+        out = self.mm[self.data + i:self.data + i + first]
+        if first < n:
+            out += self.mm[self.data:self.data + n - first]
+        return out
+
+    def read(self):
+        tail, head = self._u64(64), self._u64(0)
+        if head == tail:
+            return None
+        length = struct.unpack("<I", self._copy_out(tail, 4))[0]
+        frame = self._copy_out(tail + 4, length)
+        struct.pack_into("<Q", self.mm, self.offset + 64, tail + 4 + length)
+        return frame
+
+    def write(self, frame):
+        head, tail = self._u64(0), self._u64(64)
+        if self.capacity - (head - tail) < 4 + len(frame):
+            return False
+        self._copy_in(head, struct.pack("<I", len(frame)) + frame)
+        struct.pack_into("<Q", self.mm, self.offset, head + 4 + len(frame))
+        return True
+
+
+def serve_shm(name, ring_bytes):
+    import ctypes
+    import mmap
+
+    kernel32 = ctypes.windll.kernel32
+    kernel32.CreateEventW.restype = ctypes.c_void_p
+    kernel32.SetEvent.argtypes = [ctypes.c_void_p]
+    kernel32.WaitForSingleObject.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+
+    region = RING_HEADER + ring_bytes
+    mm = mmap.mmap(-1, SHM_CONTROL + 2 * region, tagname=name)
+    magic, version, existing = struct.unpack_from("<III", mm, 0)
+    if magic == SHM_MAGIC:
+        if version != SHM_VERSION or existing != ring_bytes:
+            raise SystemExit("shm %s exists with ring_bytes=%d, restart with matching --shm-ring-kb" % (name, existing))
+    else:
+        for off in (SHM_CONTROL, SHM_CONTROL + region):
+            mm[off:off + RING_HEADER] = bytes(RING_HEADER)
+            struct.pack_into("<I", mm, off + 128, ring_bytes)
+        struct.pack_into("<II", mm, 4, SHM_VERSION, ring_bytes)
+        struct.pack_into("<I", mm, 0, SHM_MAGIC)
+
+    requests = ShmRingView(mm, SHM_CONTROL)
+    responses = ShmRingView(mm, SHM_CONTROL + region)
+    request_event = kernel32.CreateEventW(None, False, False, name + "_req")
+    response_event = kernel32.CreateEventW(None, False, False, name + "_rsp")
+
+    print("mock qmt_api serving shared memory %s (ring %d bytes)" % (name, ring_bytes))
+    while True:
+        frame = requests.read()
+        if frame is None:
+            kernel32.WaitForSingleObject(request_event, 10)
+            continue
+        req_id = frame[:8]
+        method = "GET" if frame[8] == 0 else "POST"
+        endpoint_len = struct.unpack_from("<H", frame, 10)[0]
+        endpoint = bytes(frame[12:12 + endpoint_len]).decode("utf-8")
+        code, body = Handler.dispatch(method, endpoint, bytes(frame[12 + endpoint_len:]))
+        reply = req_id + struct.pack("<I", code) + body
+        while not responses.write(reply):
+            time.sleep(0.0005)
+        kernel32.SetEvent(response_event)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="qmt_api 本地替身")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8000)
+    parser.add_argument("--delay-ms", type=float, default=0.0, help="每个请求的模拟处理延迟")
+    parser.add_argument("--reject-every", type=int, default=0, help="每 N 笔委托拒绝一笔，0 表示不拒绝")
+    parser.add_argument("--unix", metavar="PATH", help="改为监听 unix 域套接字")
+    parser.add_argument("--shm", metavar="NAME", help="改用共享内存传输（仅 Windows）")
+    parser.add_argument("--shm-ring-kb", type=int, default=1024, help="单向环大小，与 config.ini shm_ring_kb 一致")
+    parser.add_argument("-v", "--verbose", action="store_true")
+    args = parser.parse_args()
+
+    Handler.delay_ms = args.delay_ms
+    Handler.reject_every = args.reject_every
+    Handler.verbose = args.verbose
+
+    if args.shm or args.unix:
+        try:
+            if args.shm:
+                serve_shm(args.shm, args.shm_ring_kb * 1024)
+            else:
+                serve_unix(args.unix)
+        except KeyboardInterrupt:
+            pass
+        finally:
+            print(Handler.stats.text(), end="")
+        return
+
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    print("mock qmt_api listening on http://%s:%d" % (args.host, args.port))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        print(Handler.stats.text(), end="")
+
+
+if __name__ == "__main__":
+    main()